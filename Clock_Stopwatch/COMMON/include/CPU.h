@@ -0,0 +1,115 @@
+#ifndef _CPU_H
+#define _CPU_H
+
+
+/********************************************************Includes:************************************************/
+#include <stdint.h>
+
+
+/********************************************************Defines:*************************************************/
+/*the registers of the Cortex-M4 core the drivers of both boards use: the PRIMASK critical sections, the PendSV of the
+  schedulers and the DWT cycle counter, they are kept here once and the drivers reach them through their CFG files*/
+#define CPU_SCB_ICSR                (*((volatile uint32_t*)0xE000ED04))
+#define CPU_SCB_SHPR3               (*((volatile uint32_t*)0xE000ED20))
+#define CPU_DEMCR                   (*((volatile uint32_t*)0xE000EDFC))
+#define CPU_DWT_CTRL                (*((volatile uint32_t*)0xE0001000))
+#define CPU_DWT_CYCCNT              (*((volatile uint32_t*)0xE0001004))
+
+#define CPU_SCB_ICSR_PENDSVSET      (1UL << 28)
+#define CPU_SCB_SHPR3_PENDSV_LOWEST (0xFFUL << 16)
+#define CPU_DEMCR_TRCENA            (1UL << 24)
+#define CPU_DWT_CTRL_CYCCNTENA      (1UL << 0)
+
+
+/********************************************************APIs:****************************************************/
+
+/**
+ * @brief mask the interrupts and return the previous mask state, so it is safe to call it from an ISR.
+ * @param NoThing
+ * @return uint32_t : the PRIMASK before masking, to be given to CPU_ExitCritical
+ */
+static inline uint32_t CPU_EnterCritical (void)
+{
+    uint32_t Primask = 0;
+    __asm volatile ("mrs %0, primask" : "=r" (Primask));
+    __asm volatile ("cpsid i" ::: "memory");
+    return Primask;
+}
+
+/**
+ * @brief restore the interrupts mask saved by CPU_EnterCritical.
+ * @param Primask : the state returned by CPU_EnterCritical
+ * @return NoThing
+ */
+static inline void CPU_ExitCritical (uint32_t Primask)
+{
+    __asm volatile ("msr primask, %0" : : "r" (Primask) : "memory");
+}
+
+/**
+ * @brief mask the interrupts without saving the state, for the sleep of the tickless scheduler.
+ * @param NoThing
+ * @return NoThing
+ */
+static inline void CPU_DisableInterrupts (void)
+{
+    __asm volatile ("cpsid i" ::: "memory");
+}
+
+static inline void CPU_EnableInterrupts (void)
+{
+    __asm volatile ("cpsie i" ::: "memory");
+}
+
+/**
+ * @brief sleep till an interrupt is pending, it wakes even with the interrupts masked.
+ * @param NoThing
+ * @return NoThing
+ */
+static inline void CPU_WaitForInterrupt (void)
+{
+    __asm volatile ("wfi");
+}
+
+/**
+ * @brief pend PendSV, it runs when no other interrupt is active if it has the lowest priority.
+ * @param NoThing
+ * @return NoThing
+ */
+static inline void CPU_PendSV (void)
+{
+    CPU_SCB_ICSR = CPU_SCB_ICSR_PENDSVSET;
+}
+
+/**
+ * @brief give PendSV the lowest priority, so it preempts only the super loop.
+ * @param NoThing
+ * @return NoThing
+ */
+static inline void CPU_SetPendSVLowest (void)
+{
+    CPU_SCB_SHPR3 |= CPU_SCB_SHPR3_PENDSV_LOWEST;
+}
+
+/**
+ * @brief start the DWT cycle counter, it counts the core clock and keeps its value if it is already counting.
+ * @param NoThing
+ * @return NoThing
+ */
+static inline void CPU_StartCycleCounter (void)
+{
+    CPU_DEMCR |= CPU_DEMCR_TRCENA;
+    CPU_DWT_CTRL |= CPU_DWT_CTRL_CYCCNTENA;
+}
+
+/**
+ * @brief read the DWT cycle counter, it wraps every 2^32 core clock cycles.
+ * @param NoThing
+ * @return uint32_t : the cycles
+ */
+static inline uint32_t CPU_GetCycles (void)
+{
+    return CPU_DWT_CYCCNT;
+}
+
+#endif
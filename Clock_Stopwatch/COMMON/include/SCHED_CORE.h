@@ -0,0 +1,164 @@
+#ifndef _SCHED_CORE_H
+#define _SCHED_CORE_H
+
+
+/********************************************************Includes:************************************************/
+#include <stdint.h>
+/*each board has its own configuration of the core in its include path*/
+#include "CFG/SCHED_CORE_cfg.h"
+
+
+/********************************************************Defines:*************************************************/
+#define SCHED_CORE_QUEUE_HEAP       0           //min-heap of the next releases, O(log n) a release
+#define SCHED_CORE_QUEUE_SCAN       1           //list of the next releases scanned at the ticks that release, O(n)
+
+/*the release bookkeeping of COMMON/SCHED_KERNEL, the scheduler shared by both boards. The core keeps the next
+  release of every active runnable of each class in a min-heap (SCHED_CORE_QUEUE_HEAP, a release costs a sift of
+  O(log n)) or in a list in the order of the IDs that each dispatch walks once (SCHED_CORE_QUEUE_SCAN, a tick that
+  releases costs a check of every runnable). Both check the earliest release before the critical section, so a tick
+  that releases nothing costs O(1) with the interrupts enabled. tools/sched_bench measures both in host cycles, which
+  depend on the machine, so only the trend counts: at 5 and 20 runnables their mean tick is about the same, at 100
+  the scan's is about 2/3 of the heap's, its p99 and worst tick are half of the heap's or less from 20 runnables on and
+  the idle ticks cost both a few tens of cycles at most whatever the count. A sift costs more than some tens of checks, so
+  the heap only pays off with long tables of slow runnables where a tick releases few of them. The boards scan.
+  Run it with both queues from Clock_Stopwatch to check the trend on another host:
+      gcc -O2 -Itools/sched_bench -ICOMMON/include tools/sched_bench/sched_bench.c COMMON/src/SCHED_CORE.c -o sched_bench
+      (and -DSCHED_CORE_QUEUE=SCHED_CORE_QUEUE_SCAN for the scan), ./sched_bench
+
+  SCHED_CORE_cfg.h of the board must define:
+    SCHED_CORE_MAX_RUNNABLES        size of the runnables table (254 at most)
+    SCHED_CORE_CLASSES              number of scheduling classes (heaps)
+    SCHED_CORE_QUEUE                SCHED_CORE_QUEUE_HEAP or SCHED_CORE_QUEUE_SCAN
+    SCHED_CORE_ENTER_CRITICAL()     mask the interrupts and return the previous state as a uint32_t
+    SCHED_CORE_EXIT_CRITICAL(State) restore the state returned by SCHED_CORE_ENTER_CRITICAL*/
+
+
+/********************************************************Types:***************************************************/
+/*what to do with the releases missed while the scheduler was late, the backlog policies of both boards keep this order*/
+typedef enum
+{
+    SCHED_CORE_BACKLOG_RUN_ALL,                 //call the runnable once for every missed release
+    SCHED_CORE_BACKLOG_COALESCE,                //call the runnable once for all the missed releases
+    SCHED_CORE_BACKLOG_SKIP                     //drop the late releases and wait for the next period
+}SCHED_CoreBacklog_t;
+
+/*a release taken by SCHED_CoreTakeDue*/
+typedef struct
+{
+    uint32_t ID;                                //the runnable
+    uint32_t Time;                              //scheduler time (in ticks) of the release, for the start jitter
+    uint32_t Call;                              //0 if the BacklogPolicy skips it, the runnable must not be called
+}SCHED_CoreRelease_t;
+
+
+/********************************************************APIs:****************************************************/
+
+/**
+ * @brief empty the heaps, call it before adding the runnables.
+ * @param NoThing
+ * @return NoThing
+ */
+void SCHED_CoreInit (void);
+
+/**
+ * @brief add a runnable to the heap of its class, it is active from now.
+ * @param ID : index of the runnable in the table of the board (below SCHED_CORE_MAX_RUNNABLES)
+ * @param Class : the heap it is dispatched from (below SCHED_CORE_CLASSES)
+ * @param FirstRelease : scheduler time (in ticks) of its first release
+ * @param Periodicity : in ticks, 0 for a runnable that runs once
+ * @param BacklogPolicy : SCHED_CoreBacklog_t
+ * @return NoThing
+ */
+void SCHED_CoreAdd (uint32_t ID, uint32_t Class, uint32_t FirstRelease, uint32_t Periodicity, uint32_t BacklogPolicy);
+
+/**
+ * @brief take the release of the class that is due first if its time has come, apply the BacklogPolicy and set
+ *        the next release. The runnable stays in the heap while it is called so it can suspend itself or move
+ *        its release, a runnable without periodicity leaves it (it is suspended).
+ *        a dispatch calls it again till it returns 0 (the scan goes on from the last release it took), a runnable
+ *        late by more than its period (SCHED_CORE_BACKLOG_RUN_ALL) comes back for each missed release.
+ * @param Class : the class being dispatched
+ * @param Now : scheduler time (in ticks) of the class
+ * @param Pending : ticks that came after Now and are not dispatched yet, they count in the lag
+ * @param Release : pointer to the struct that will be filled with the release
+ * @return uint32_t : 1 if a release was taken, 0 if no runnable of the class is due
+ */
+uint32_t SCHED_CoreTakeDue (uint32_t Class, uint32_t Now, uint32_t Pending, SCHED_CoreRelease_t* Release);
+
+/**
+ * @brief check if no runnable of the class is due at Now, without masking the interrupts, so a dispatch that adds
+ *        its own critical section around SCHED_CoreTakeDue leaves the ticks that release nothing before it.
+ * @param Class : the class being dispatched
+ * @param Now : scheduler time (in ticks) of the class
+ * @return uint32_t : 1 if SCHED_CoreTakeDue would return 0, 0 if a release may be due
+ */
+uint32_t SCHED_CoreIsIdle (uint32_t Class, uint32_t Now);
+
+/**
+ * @brief take a runnable out of its heap, it is not released till SCHED_CoreResume or SCHED_CoreSetRelease.
+ * @param ID : the runnable
+ * @return NoThing
+ */
+void SCHED_CoreSuspend (uint32_t ID);
+
+/**
+ * @brief put a suspended runnable back in its heap, it keeps its phase so it is released at the first
+ *        FirstRelease + n * Periodicity that is not before Now, the releases that passed are not missed releases.
+ *        nothing is done if it is active.
+ * @param ID : the runnable
+ * @param Now : scheduler time (in ticks) of its class
+ * @return NoThing
+ */
+void SCHED_CoreResume (uint32_t ID, uint32_t Now);
+
+/**
+ * @brief move the next release of a runnable, a suspended runnable is made active, the periodic releases
+ *        continue from the new one.
+ * @param ID : the runnable
+ * @param Release : scheduler time (in ticks) of the next release
+ * @return NoThing
+ */
+void SCHED_CoreSetRelease (uint32_t ID, uint32_t Release);
+
+/**
+ * @brief change the periodicity of a runnable, the new value applies after its next release.
+ * @param ID : the runnable
+ * @param Periodicity : in ticks, 0 makes the next release the last one
+ * @return NoThing
+ */
+void SCHED_CoreSetPeriod (uint32_t ID, uint32_t Periodicity);
+
+/**
+ * @brief ticks from Offset to the first release of the class after Offset, both measured from Now, for the tickless
+ *        schedulers. A release that is already due is handled at the next dispatch, so it does not count.
+ *        the heap is walked only from its top down to the first releases after Offset, the scan checks them all.
+ * @param Class : the class
+ * @param Now : the time Offset and the result are measured from
+ * @param Offset : ticks after Now the result is measured from
+ * @param Limit : the result when no release of the class comes before Offset + Limit
+ * @return uint32_t : the ticks, Limit at most
+ */
+uint32_t SCHED_CoreNextDeadline (uint32_t Class, uint32_t Now, uint32_t Offset, uint32_t Limit);
+
+/**
+ * @brief check if a runnable is in its heap (added or resumed and not suspended).
+ * @param ID : the runnable
+ * @return uint32_t : 1 if it is active, 0 otherwise
+ */
+uint32_t SCHED_CoreIsActive (uint32_t ID);
+
+/**
+ * @brief get the periodicity of a runnable.
+ * @param ID : the runnable
+ * @return uint32_t : the periodicity in ticks
+ */
+uint32_t SCHED_CoreGetPeriod (uint32_t ID);
+
+/**
+ * @brief get the number of releases of a runnable that were coalesced or skipped by its BacklogPolicy.
+ * @param ID : the runnable
+ * @return uint32_t : the count
+ */
+uint32_t SCHED_CoreGetMissedReleases (uint32_t ID);
+
+#endif
@@ -0,0 +1,340 @@
+#ifndef _SCHED_KERNEL_H
+#define _SCHED_KERNEL_H
+
+
+/********************************************************Includes:************************************************/
+#include <stdint.h>
+#include "SCHED_CORE.h"
+
+
+/********************************************************Defines:*************************************************/
+/*the scheduler of both boards: the dispatchers of the cooperative class (super loop) and the preemptive class
+  (PendSV), the periodic, tickless and table modes, the events, the deferred work queue, the sleep, the statistics,
+  the load, the budgets and the sync of the scheduler time between the boards. The releases are kept by
+  COMMON/SCHED_CORE. The boards keep their own APIs, types and error status in MC1 SCHED.c and MC2 SCHED_prog.c on
+  top of it and map their configuration (SERVICE/SCHED.h, CFG/SCHED/SCHED_config.h) and their drivers in
+  CFG/SCHED_CORE_cfg.h.
+
+  The projects build the sources of their own folders only, so MC1/src/SERVICE/SCHED_COMMON.c and
+  MC2/src/SERVICES/SCHED/SCHED_common.c build COMMON/src and the COMMON headers are included by their paths, no
+  include path or linked folder is added to the projects.
+
+  SCHED_CORE_cfg.h of the board must define, with the ones of SCHED_CORE.h:
+    SCHED_KERNEL_TICK_US                    tick in us, 1000 or a divisor of it
+    SCHED_KERNEL_CYCLES_PER_US              core clock in MHz, the frequency of the cycle counter
+    SCHED_KERNEL_MODE                       SCHED_KERNEL_MODE_PERIODIC, SCHED_KERNEL_MODE_TICKLESS or SCHED_KERNEL_MODE_TABLE
+    SCHED_KERNEL_MAX_SLEEP_MS               longest systick interval in tickless mode
+    SCHED_KERNEL_TABLE                      release table of the table mode, bit n of entry t releases the ID n at tick t
+    SCHED_KERNEL_TABLE_LENGTH               its entries, SCHED_KERNEL_TABLE_PROLOGUE of them before the repeated part
+    SCHED_KERNEL_TABLE_RUNNABLES            the runnables it was generated for
+    SCHED_KERNEL_STATS                      SCHED_KERNEL_ENABLED or SCHED_KERNEL_DISABLED, the same for the 3 below
+    SCHED_KERNEL_LOAD                       with SCHED_KERNEL_LOAD_SHORT_WINDOW_MS and SCHED_KERNEL_LOAD_LONG_WINDOW_MS
+    SCHED_KERNEL_BUDGET                     with SCHED_KERNEL_BUDGET_STRIKES, SCHED_KERNEL_BUDGET_MAX_SLOWDOWN and
+                                            SCHED_KERNEL_BUDGET_RECOVERY_RUNS
+    SCHED_KERNEL_SLEEP                      SCHED_KernelSleep
+    SCHED_KERNEL_DEFER                      SCHED_KERNEL_DEFER_PREEMPTIVE or SCHED_KERNEL_DEFER_COOPERATIVE
+    SCHED_KERNEL_DEFER_QUEUE_SIZE           slots of the deferred work queue, a power of 2
+    SCHED_KERNEL_SYNC                       SCHED_KERNEL_SYNC_DISABLED, SCHED_KERNEL_SYNC_MASTER or SCHED_KERNEL_SYNC_SLAVE
+    SCHED_KERNEL_SYNC_PERIOD_MS             period of the sync frames
+    SCHED_KERNEL_SYNC_LATENCY_US            slave: time from the master tick that sends a frame to SCHED_KernelSync
+    SCHED_KERNEL_SYNC_DEADBAND_TICKS        slave: phase errors left alone
+    SCHED_KERNEL_TIMER_INIT(CallBack)       init the systick with its interrupt and callback, not started
+    SCHED_KERNEL_TIMER_SET_US(Us)           write the next systick interval
+    SCHED_KERNEL_TIMER_START()              start the periodic systick
+    SCHED_KERNEL_PREEMPTIVE_INIT()          give PendSV the lowest priority
+    SCHED_KERNEL_PEND_PREEMPTIVE()          pend PendSV
+    SCHED_KERNEL_CYCLES_INIT()              start the cycle counter
+    SCHED_KERNEL_CYCLES()                   read it
+    SCHED_KERNEL_IDLE_LOCK()                mask the interrupts before the check of the tickless sleep
+    SCHED_KERNEL_IDLE_WAIT()                sleep till an interrupt, it wakes with the interrupts masked
+    SCHED_KERNEL_IDLE_UNLOCK()              unmask them
+    SCHED_KERNEL_TRACE(Type, ID, Arg)       record RUNNABLE_START, RUNNABLE_END, DISPATCH_START or DISPATCH_END
+    SCHED_KERNEL_TRACE_PENDSV(Type)         record ISR_ENTRY or ISR_EXIT of PendSV*/
+
+#define SCHED_KERNEL_DISABLED               0
+#define SCHED_KERNEL_ENABLED                1
+
+#define SCHED_KERNEL_MODE_PERIODIC          0           //systick fires every tick
+#define SCHED_KERNEL_MODE_TICKLESS          1           //systick fires only at the next runnable deadline
+#define SCHED_KERNEL_MODE_TABLE             2           //systick fires every tick, the releases come from the table
+
+#define SCHED_KERNEL_DEFER_PREEMPTIVE       0           //run the deferred work in PendSV
+#define SCHED_KERNEL_DEFER_COOPERATIVE      1           //run the deferred work in the super loop
+
+#define SCHED_KERNEL_SYNC_DISABLED          0
+#define SCHED_KERNEL_SYNC_MASTER            1           //call the sync hook every SCHED_KERNEL_SYNC_PERIOD_MS
+#define SCHED_KERNEL_SYNC_SLAVE             2           //align the scheduler time on SCHED_KernelSync
+
+/*the classes of both boards*/
+#define SCHED_KERNEL_CLASS_COOPERATIVE      0
+#define SCHED_KERNEL_CLASS_PREEMPTIVE       1
+#define SCHED_KERNEL_CLASSES                2
+
+/*the scheduler counts the time in ticks, the periods and delays of the runnables are given in ms*/
+#define SCHED_KERNEL_TICKS_PER_MS           (1000 / SCHED_KERNEL_TICK_US)
+#define SCHED_KERNEL_MS_TO_TICKS(Ms)        ((Ms) * SCHED_KERNEL_TICKS_PER_MS)
+
+
+/********************************************************Types:***************************************************/
+typedef void (*SCHED_KernelCallBack_t) (void);
+
+/*work an ISR hands over by SCHED_KernelDefer, Arg is given back to it*/
+typedef void (*SCHED_KernelWork_t) (uint32_t Arg);
+
+typedef enum
+{
+    SCHED_KERNEL_OK,
+    SCHED_KERNEL_NULL_POINTER,
+    SCHED_KERNEL_INVALID_ID,                    //not registered (or without a CB for SCHED_KernelResume)
+    SCHED_KERNEL_INVALID_PERIOD,                //a periodicity or delay of 0
+    SCHED_KERNEL_INVALID_CLASS,
+    SCHED_KERNEL_INVALID_NAME,                  //no runnable has this name
+    SCHED_KERNEL_INVALID_WINDOW,
+    SCHED_KERNEL_FULL,                          //no room in the runnables table or in the deferred work queue
+    SCHED_KERNEL_NOT_SUPPORTED,                 //the release table fixes the releases
+    SCHED_KERNEL_NOT_READY                      //no load window is complete yet
+}SCHED_KernelStatus_t;
+
+/*a runnable as the boards give it, it is copied at the registration*/
+typedef struct
+{
+    const char* Name;
+    SCHED_KernelCallBack_t CB;                  //NULL takes an ID that is never released
+    uint32_t Class;                             //SCHED_KERNEL_CLASS_COOPERATIVE or SCHED_KERNEL_CLASS_PREEMPTIVE
+    uint32_t DelayMs;                           //delay before the first release
+    uint32_t PeriodicityMs;                     //0 runs it once
+    uint32_t PeriodicityUs;                     //replaces PeriodicityMs if not 0, rounded down to whole ticks but never to 0
+    uint32_t BacklogPolicy;                     //SCHED_CoreBacklog_t
+    uint32_t Events;                            //mask of the events that release it at once
+    uint32_t BudgetUs;                          //longest call before it is a budget overrun, 0 has no budget, the time
+                                                //of the interrupts in the middle is taken off (see SCHED_KernelEnterIsr)
+}SCHED_KernelRunnable_t;
+
+#if (SCHED_KERNEL_BUDGET == SCHED_KERNEL_ENABLED)
+typedef enum
+{
+    SCHED_KERNEL_BUDGET_KEEP,                   //keep calling it as it is
+    SCHED_KERNEL_BUDGET_SLOW_DOWN,              //call it at half of the periodic releases it is called at now, down to
+                                                //1 in SCHED_KERNEL_BUDGET_MAX_SLOWDOWN
+    SCHED_KERNEL_BUDGET_SUSPEND                 //stop dispatching it till SCHED_KernelResume
+}SCHED_KernelBudgetAction_t;
+
+/*budget policy, it gets the ID of the runnable and its budget overruns since the start and returns a
+  SCHED_KernelBudgetAction_t*/
+typedef uint32_t (*SCHED_KernelBudgetHook_t) (uint32_t ID, uint32_t Overruns);
+#endif
+
+#if (SCHED_KERNEL_STATS == SCHED_KERNEL_ENABLED)
+/*all the values are in core clock cycles*/
+typedef struct
+{
+    uint32_t Runs;                              //number of calls of the runnable
+    uint32_t MinExecCycles;                     //shortest execution time
+    uint32_t MaxExecCycles;                     //longest execution time
+    uint32_t MeanExecCycles;                    //average execution time
+    uint32_t MinStartJitter;                    //shortest delay between the release time and the call
+    uint32_t MaxStartJitter;                    //longest delay between the release time and the call
+    uint32_t Overruns;                          //calls that took longer than the periodicity
+}SCHED_KernelStats_t;
+#endif
+
+#if (SCHED_KERNEL_LOAD == SCHED_KERNEL_ENABLED)
+typedef enum
+{
+    SCHED_KERNEL_LOAD_WINDOW_SHORT,             //SCHED_KERNEL_LOAD_SHORT_WINDOW_MS
+    SCHED_KERNEL_LOAD_WINDOW_LONG,              //SCHED_KERNEL_LOAD_LONG_WINDOW_MS
+    _SCHED_KernelLoadWindowNumber               //please dont change this and keep it the last value in enum
+}SCHED_KernelLoadWindow_t;
+
+/*load of the last complete window, the cycles are core clock cycles and the utilisations are in 0.1 % (0 - 1000),
+  busy is the time in the dispatchers and the runnables of both classes, the other interrupts count as idle*/
+typedef struct
+{
+    uint32_t BusyCycles;                        //busy cycles of the window
+    uint32_t IdleCycles;                        //the rest of the window
+    uint32_t Utilisation;                       //busy share of the window
+    uint32_t PeakTickUtilisation;               //busy share of the busiest tick (systick interval in tickless mode)
+}SCHED_KernelLoad_t;
+#endif
+
+
+/********************************************************APIs:****************************************************/
+
+/**
+ * @brief init the systick, PendSV, the release queue and the cycle counter, call it before registering the runnables.
+ * @param NoThing
+ * @return NoThing
+ */
+void SCHED_KernelInit (void);
+
+/**
+ * @brief start the systick and run the super loop, it never returns.
+ * @param NoThing
+ * @return NoThing
+ */
+void SCHED_KernelStart (void);
+
+/**
+ * @brief add a runnable, it takes the next ID and is released first after its DelayMs from now.
+ * @param Runnable : the runnable, it is copied
+ * @param ID : pointer to the variable that will hold its ID
+ * @return SCHED_KernelStatus_t : SCHED_KERNEL_OK, SCHED_KERNEL_NULL_POINTER, SCHED_KERNEL_INVALID_CLASS,
+ *                                SCHED_KERNEL_FULL or SCHED_KERNEL_NOT_SUPPORTED after the runnables of the table
+ */
+SCHED_KernelStatus_t SCHED_KernelRegister (const SCHED_KernelRunnable_t* Runnable, uint32_t* ID);
+
+/**
+ * @brief post events from an ISR (or anywhere), every active runnable subscribed to one of them is called at the next
+ *        dispatch of its class without waiting for its periodic release.
+ * @param Events : mask of the posted events
+ * @return NoThing
+ */
+void SCHED_KernelPostEvent (uint32_t Events);
+
+/**
+ * @brief queue a function from an ISR (or anywhere), it is called at the priority of SCHED_KERNEL_DEFER in the
+ *        order of the calls, it never masks the interrupts.
+ * @param Work : the function to call
+ * @param Arg : the value given to the function
+ * @return SCHED_KernelStatus_t : SCHED_KERNEL_OK, SCHED_KERNEL_NULL_POINTER or SCHED_KERNEL_FULL (the work is dropped
+ *                                and counted)
+ */
+SCHED_KernelStatus_t SCHED_KernelDefer (SCHED_KernelWork_t Work, uint32_t Arg);
+
+/**
+ * @brief mark the entry of an ISR, the time till SCHED_KernelExitIsr is taken off the execution time of the runnable
+ *        it interrupted for its budget and its statistics. The systick and PendSV are marked by the kernel.
+ * @param NoThing
+ * @return uint32_t : the mark to give to SCHED_KernelExitIsr
+ */
+uint32_t SCHED_KernelEnterIsr (void);
+
+/**
+ * @brief mark the exit of the ISR, call it last in the ISR.
+ * @param Mark : the value returned by SCHED_KernelEnterIsr
+ * @return NoThing
+ */
+void SCHED_KernelExitIsr (uint32_t Mark);
+
+/**
+ * @brief get the number of works dropped by SCHED_KernelDefer because the queue was full.
+ * @param NoThing
+ * @return uint32_t : the count
+ */
+uint32_t SCHED_KernelGetDeferDrops (void);
+
+/**
+ * @brief stop dispatching a runnable till SCHED_KernelResume.
+ * @param ID : the runnable
+ * @return SCHED_KernelStatus_t : SCHED_KERNEL_OK or SCHED_KERNEL_INVALID_ID
+ */
+SCHED_KernelStatus_t SCHED_KernelSuspend (uint32_t ID);
+
+/**
+ * @brief dispatch a suspended runnable again, it keeps its phase so it is released at the first
+ *        DelayMs + n * Periodicity that is not in the past, it ends a sleep.
+ * @param ID : the runnable
+ * @return SCHED_KernelStatus_t : SCHED_KERNEL_OK or SCHED_KERNEL_INVALID_ID (not registered or without a CB)
+ */
+SCHED_KernelStatus_t SCHED_KernelResume (uint32_t ID);
+
+/**
+ * @brief change the periodicity of a runnable, the new value applies after its next release.
+ * @param ID : the runnable
+ * @param PeriodicityMs : the new periodicity, 0 is not allowed
+ * @return SCHED_KernelStatus_t : SCHED_KERNEL_OK, SCHED_KERNEL_INVALID_ID, SCHED_KERNEL_INVALID_PERIOD or
+ *                                SCHED_KERNEL_NOT_SUPPORTED in table mode
+ */
+SCHED_KernelStatus_t SCHED_KernelSetPeriod (uint32_t ID, uint32_t PeriodicityMs);
+
+/**
+ * @brief get the number of releases of a runnable that were coalesced or skipped by its BacklogPolicy.
+ * @param Name : the name of the runnable
+ * @param MissedReleases : pointer to the variable that will hold the count
+ * @return SCHED_KernelStatus_t : SCHED_KERNEL_OK, SCHED_KERNEL_NULL_POINTER or SCHED_KERNEL_INVALID_NAME
+ */
+SCHED_KernelStatus_t SCHED_KernelGetMissedReleases (const char* Name, uint32_t* MissedReleases);
+
+#if (SCHED_KERNEL_SLEEP == SCHED_KERNEL_ENABLED)
+/**
+ * @brief hold a runnable for a delay, it is not called by its period or by the events till the delay passes then
+ *        its periodic releases go on from the wake time. A runnable that sleeps while it runs is released again
+ *        at the wake time even if it has no periodicity.
+ * @param ID : the runnable
+ * @param DelayMs : the delay, 0 is not allowed
+ * @return SCHED_KernelStatus_t : SCHED_KERNEL_OK, SCHED_KERNEL_INVALID_ID, SCHED_KERNEL_INVALID_PERIOD or
+ *                                SCHED_KERNEL_NOT_SUPPORTED in table mode
+ */
+SCHED_KernelStatus_t SCHED_KernelSleep (uint32_t ID, uint32_t DelayMs);
+#endif
+
+#if (SCHED_KERNEL_BUDGET == SCHED_KERNEL_ENABLED)
+/**
+ * @brief replace the default budget policy, the hook is called from the dispatcher of the runnable class right
+ *        after the call that made SCHED_KERNEL_BUDGET_STRIKES overruns in a row, NULL goes back to the default one
+ *        (SCHED_KERNEL_BUDGET_SLOW_DOWN). A slowed down runnable comes back by halves after
+ *        SCHED_KERNEL_BUDGET_RECOVERY_RUNS calls in a row within its budget whatever the policy.
+ * @param Hook : the budget policy
+ * @return NoThing
+ */
+void SCHED_KernelSetBudgetHook (SCHED_KernelBudgetHook_t Hook);
+
+/**
+ * @brief get the number of calls of a runnable that took longer than its BudgetUs.
+ * @param Name : the name of the runnable
+ * @param Overruns : pointer to the variable that will hold the count
+ * @return SCHED_KernelStatus_t : SCHED_KERNEL_OK, SCHED_KERNEL_NULL_POINTER or SCHED_KERNEL_INVALID_NAME
+ */
+SCHED_KernelStatus_t SCHED_KernelGetBudgetOverruns (const char* Name, uint32_t* Overruns);
+#endif
+
+#if (SCHED_KERNEL_SYNC == SCHED_KERNEL_SYNC_MASTER)
+/**
+ * @brief set the function that sends the sync frame, it is called from the systick interrupt at every scheduler
+ *        time that is a multiple of SCHED_KERNEL_SYNC_PERIOD_MS.
+ * @param Hook : the function, NULL stops the sync frames
+ * @return NoThing
+ */
+void SCHED_KernelSetSyncHook (SCHED_KernelCallBack_t Hook);
+#endif
+
+#if (SCHED_KERNEL_SYNC == SCHED_KERNEL_SYNC_SLAVE)
+/**
+ * @brief align the scheduler time on the master, call it when a sync frame is received. The systick gives 2 ticks
+ *        (or 0) to the dispatchers instead of 1 till the phase error is made up, no release is skipped.
+ * @param NoThing
+ * @return NoThing
+ */
+void SCHED_KernelSync (void);
+#endif
+
+#if (SCHED_KERNEL_STATS == SCHED_KERNEL_ENABLED)
+/**
+ * @brief get the execution time and start jitter statistics of a runnable.
+ * @param Name : the name of the runnable
+ * @param Stats : pointer to the struct that will be filled with the statistics
+ * @return SCHED_KernelStatus_t : SCHED_KERNEL_OK, SCHED_KERNEL_NULL_POINTER or SCHED_KERNEL_INVALID_NAME
+ */
+SCHED_KernelStatus_t SCHED_KernelGetRunnableStats (const char* Name, SCHED_KernelStats_t* Stats);
+
+/**
+ * @brief get the worst release latency of a class in core clock cycles.
+ * @param Class : the class
+ * @param MaxLatency : pointer to the variable that will hold the latency
+ * @return SCHED_KernelStatus_t : SCHED_KERNEL_OK, SCHED_KERNEL_NULL_POINTER or SCHED_KERNEL_INVALID_CLASS
+ */
+SCHED_KernelStatus_t SCHED_KernelGetClassLatency (uint32_t Class, uint32_t* MaxLatency);
+#endif
+
+#if (SCHED_KERNEL_LOAD == SCHED_KERNEL_ENABLED)
+/**
+ * @brief get the CPU load measured over the last complete window.
+ * @param Window : SCHED_KERNEL_LOAD_WINDOW_SHORT or SCHED_KERNEL_LOAD_WINDOW_LONG
+ * @param Load : pointer to the struct that will be filled with the load
+ * @return SCHED_KernelStatus_t : SCHED_KERNEL_OK, SCHED_KERNEL_NULL_POINTER, SCHED_KERNEL_INVALID_WINDOW or
+ *                                SCHED_KERNEL_NOT_READY
+ */
+SCHED_KernelStatus_t SCHED_KernelGetLoad (uint32_t Window, SCHED_KernelLoad_t* Load);
+#endif
+
+#endif
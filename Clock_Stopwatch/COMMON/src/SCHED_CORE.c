@@ -0,0 +1,597 @@
+/*---------------------------------------------------------------------------------------------------*/
+/*                                           Includes:                                               */
+/*---------------------------------------------------------------------------------------------------*/
+/*included by its path so the boards build it without COMMON/include in their include paths*/
+#include "../include/SCHED_CORE.h"
+
+/*---------------------------------------------------------------------------------------------------*/
+/*                                           Defines:                                                */
+/*---------------------------------------------------------------------------------------------------*/
+/*position of a runnable that is not in a heap*/
+#define SCHED_CORE_OUT              0xFF
+
+/*---------------------------------------------------------------------------------------------------*/
+/*                                           Typedefs:                                               */
+/*---------------------------------------------------------------------------------------------------*/
+typedef struct
+{
+    uint32_t NextRelease;                       //scheduler time (in ticks) of the next release
+    uint32_t Periodicity;                       //in ticks, 0 for a runnable that runs once
+    uint32_t MissedReleases;                    //releases coalesced or skipped by the BacklogPolicy
+    uint8_t Class;
+    uint8_t BacklogPolicy;
+    uint8_t Position;                           //index in the heap of its class, SCHED_CORE_OUT while suspended
+}SCHED_CoreRunnable_t;
+
+/*node of a heap, the release is kept next to the ID so a comparison reads the heap only*/
+typedef struct
+{
+    uint32_t Release;                           //the NextRelease of the runnable
+    uint32_t ID;
+}SCHED_CoreNode_t;
+
+/*the IDs and the positions in the heaps are kept in 8 bits, SCHED_CORE_OUT is not a position*/
+typedef char SCHED_CoreSizeCheck_t [(SCHED_CORE_MAX_RUNNABLES < SCHED_CORE_OUT) ? 1 : -1];
+
+#if (SCHED_CORE_QUEUE != SCHED_CORE_QUEUE_HEAP) && (SCHED_CORE_QUEUE != SCHED_CORE_QUEUE_SCAN)
+#error "SCHED_CORE_QUEUE must be SCHED_CORE_QUEUE_HEAP or SCHED_CORE_QUEUE_SCAN"
+#endif
+
+/*---------------------------------------------------------------------------------------------------*/
+/*                                           Variables:                                              */
+/*---------------------------------------------------------------------------------------------------*/
+static SCHED_CoreRunnable_t SCHED_CoreRunnables [SCHED_CORE_MAX_RUNNABLES] ;
+
+/*the active runnables of each class, a min-heap ordered by their next release with the runnable due first at [0]
+  (SCHED_CORE_QUEUE_HEAP) or a list in the order of the IDs that is scanned (SCHED_CORE_QUEUE_SCAN). Every class changes the
+  heaps of the others (suspend, resume), so every change is done in a critical section*/
+static SCHED_CoreNode_t SCHED_CoreHeap [SCHED_CORE_CLASSES][SCHED_CORE_MAX_RUNNABLES] ;
+static uint32_t SCHED_CoreHeapSize [SCHED_CORE_CLASSES] ;
+
+#if (SCHED_CORE_QUEUE == SCHED_CORE_QUEUE_SCAN)
+/*position of the list the dispatch of each class checks next*/
+static uint32_t SCHED_CoreCursor [SCHED_CORE_CLASSES] ;
+
+/*no node of a class is released before its SCHED_CoreEarliest, so a dispatch returns before the walk on the ticks
+  that release nothing. The walk gathers the earliest release of the nodes it passes in SCHED_CoreScanEarliest and
+  it becomes SCHED_CoreEarliest when the walk ends, the nodes added or moved meanwhile are counted in both*/
+static uint32_t SCHED_CoreEarliest [SCHED_CORE_CLASSES] ;
+static uint32_t SCHED_CoreScanEarliest [SCHED_CORE_CLASSES] ;
+#endif
+
+/*the releases are compared by their signed difference, a release this far after Now is later than any other*/
+#define SCHED_CORE_LATEST(Now)      ((Now) + 0x7FFFFFFFUL)
+
+/*---------------------------------------------------------------------------------------------------*/
+/*                                           Static Function:                                        */
+/*---------------------------------------------------------------------------------------------------*/
+/*check if the first node is released before the second, the runnables released at the same time keep the priority
+  of their ID*/
+static inline uint32_t SCHED_CoreIsEarlier (const SCHED_CoreNode_t* First, const SCHED_CoreNode_t* Second)
+{
+    /*the signed difference keeps the comparison right when the time overflows*/
+    int32_t Difference = (int32_t)(First->Release - Second->Release);
+    return ((Difference < 0) || ((Difference == 0) && (First->ID < Second->ID)));
+}
+
+/*write a node at a position of a heap, the runnable keeps its position so it is removed without a search*/
+static inline void SCHED_CorePlace (SCHED_CoreNode_t* Heap, uint32_t Position, SCHED_CoreNode_t Node)
+{
+    Heap[Position] = Node;
+    SCHED_CoreRunnables[Node.ID].Position = (uint8_t)Position;
+}
+
+#if (SCHED_CORE_QUEUE == SCHED_CORE_QUEUE_HEAP)
+/*move the node at Position up till its parent comes before it, it is written once at its place*/
+static void SCHED_CoreSiftUp (uint32_t Class, uint32_t Position)
+{
+    SCHED_CoreNode_t* Heap = SCHED_CoreHeap[Class];
+    SCHED_CoreNode_t Node = Heap[Position];
+    while((Position > 0) && SCHED_CoreIsEarlier(&Node, &Heap[(Position - 1) / 2]))
+    {
+        SCHED_CorePlace(Heap, Position, Heap[(Position - 1) / 2]);
+        Position = (Position - 1) / 2;
+    }
+    SCHED_CorePlace(Heap, Position, Node);
+}
+
+/*move the node at Position down till its children come after it*/
+static void SCHED_CoreSiftDown (uint32_t Class, uint32_t Position)
+{
+    SCHED_CoreNode_t* Heap = SCHED_CoreHeap[Class];
+    SCHED_CoreNode_t Node = Heap[Position];
+    uint32_t Size = SCHED_CoreHeapSize[Class];
+    uint32_t Child = (2 * Position) + 1;
+    while(Child < Size)
+    {
+        if(((Child + 1) < Size) && SCHED_CoreIsEarlier(&Heap[Child + 1], &Heap[Child]))
+        {
+            Child++;
+        }
+        if(!SCHED_CoreIsEarlier(&Heap[Child], &Node))
+        {
+            break;
+        }
+        SCHED_CorePlace(Heap, Position, Heap[Child]);
+        Position = Child;
+        Child = (2 * Position) + 1;
+    }
+    SCHED_CorePlace(Heap, Position, Node);
+}
+
+static void SCHED_CorePush (uint32_t ID)
+{
+    uint32_t Class = SCHED_CoreRunnables[ID].Class;
+    SCHED_CoreHeap[Class][SCHED_CoreHeapSize[Class]].Release = SCHED_CoreRunnables[ID].NextRelease;
+    SCHED_CoreHeap[Class][SCHED_CoreHeapSize[Class]].ID = ID;
+    SCHED_CoreHeapSize[Class]++;
+    SCHED_CoreSiftUp(Class, SCHED_CoreHeapSize[Class] - 1);
+}
+
+static void SCHED_CoreRemove (uint32_t ID)
+{
+    uint32_t Class = SCHED_CoreRunnables[ID].Class;
+    uint32_t Position = SCHED_CoreRunnables[ID].Position;
+    SCHED_CoreNode_t Last;
+
+    SCHED_CoreRunnables[ID].Position = SCHED_CORE_OUT;
+    SCHED_CoreHeapSize[Class]--;
+    if(Position < SCHED_CoreHeapSize[Class])
+    {
+        /*the last node takes the place of the removed one then goes up or down to its place*/
+        Last = SCHED_CoreHeap[Class][SCHED_CoreHeapSize[Class]];
+        SCHED_CorePlace(SCHED_CoreHeap[Class], Position, Last);
+        SCHED_CoreSiftUp(Class, Position);
+        SCHED_CoreSiftDown(Class, SCHED_CoreRunnables[Last.ID].Position);
+    }
+}
+
+/*move a runnable of the heap to its place after its NextRelease changed*/
+static void SCHED_CoreMove (uint32_t ID)
+{
+    uint32_t Class = SCHED_CoreRunnables[ID].Class;
+    SCHED_CoreHeap[Class][SCHED_CoreRunnables[ID].Position].Release = SCHED_CoreRunnables[ID].NextRelease;
+    SCHED_CoreSiftUp(Class, SCHED_CoreRunnables[ID].Position);
+    SCHED_CoreSiftDown(Class, SCHED_CoreRunnables[ID].Position);
+}
+
+/*check if the top of the heap is due at Now, it is the position of the release to take*/
+static inline uint32_t SCHED_CoreFindDue (uint32_t Class, uint32_t Now, uint32_t* Position)
+{
+    *Position = 0;
+    return ((SCHED_CoreHeapSize[Class] > 0) && ((int32_t)(Now - SCHED_CoreHeap[Class][0].Release) >= 0));
+}
+
+/*the release at Position was taken and its node holds the next one*/
+static inline void SCHED_CoreTaken (uint32_t Class, uint32_t Position)
+{
+    SCHED_CoreSiftDown(Class, Position);
+}
+
+/*check if no runnable of the class is due at Now, the top of the heap is read without the critical section: the
+  other classes change the heap only when they preempt the dispatch and they are done before it goes on, a node
+  added meanwhile is taken at the next dispatch as if it was added after this one*/
+static inline uint32_t SCHED_CoreQueueIsIdle (uint32_t Class, uint32_t Now)
+{
+    return ((SCHED_CoreHeapSize[Class] == 0) || ((int32_t)(Now - SCHED_CoreHeap[Class][0].Release) < 0));
+}
+#else
+/*count a new or moved release in the earliest release of its class and in the one of the walk*/
+static inline void SCHED_CoreKeepEarliest (uint32_t Class, uint32_t Release)
+{
+    if((int32_t)(Release - SCHED_CoreEarliest[Class]) < 0)
+    {
+        SCHED_CoreEarliest[Class] = Release;
+    }
+    if((int32_t)(Release - SCHED_CoreScanEarliest[Class]) < 0)
+    {
+        SCHED_CoreScanEarliest[Class] = Release;
+    }
+}
+
+/*the nodes of a class are kept in the order of their IDs, a node is added or removed by moving the nodes after it*/
+static void SCHED_CorePush (uint32_t ID)
+{
+    uint32_t Class = SCHED_CoreRunnables[ID].Class;
+    SCHED_CoreNode_t* List = SCHED_CoreHeap[Class];
+    uint32_t Position = SCHED_CoreHeapSize[Class];
+    SCHED_CoreNode_t Node = {SCHED_CoreRunnables[ID].NextRelease, ID};
+
+    while((Position > 0) && (List[Position - 1].ID > ID))
+    {
+        SCHED_CorePlace(List, Position, List[Position - 1]);
+        Position--;
+    }
+    SCHED_CorePlace(List, Position, Node);
+    SCHED_CoreHeapSize[Class]++;
+    if(SCHED_CoreHeapSize[Class] == 1)
+    {
+        /*the nodes the walk passed before are all removed, the only node gives both*/
+        SCHED_CoreEarliest[Class] = Node.Release;
+        SCHED_CoreScanEarliest[Class] = Node.Release;
+    }
+    else
+    {
+        SCHED_CoreKeepEarliest(Class, Node.Release);
+    }
+    /*a runnable added before the scan position of a dispatch is checked in the same dispatch*/
+    if(Position < SCHED_CoreCursor[Class])
+    {
+        SCHED_CoreCursor[Class] = Position;
+    }
+}
+
+static void SCHED_CoreRemove (uint32_t ID)
+{
+    uint32_t Class = SCHED_CoreRunnables[ID].Class;
+    SCHED_CoreNode_t* List = SCHED_CoreHeap[Class];
+    uint32_t Position = SCHED_CoreRunnables[ID].Position;
+
+    SCHED_CoreRunnables[ID].Position = SCHED_CORE_OUT;
+    SCHED_CoreHeapSize[Class]--;
+    for(uint32_t itr = Position ; itr < SCHED_CoreHeapSize[Class] ; itr++)
+    {
+        SCHED_CorePlace(List, itr, List[itr + 1]);
+    }
+    /*the nodes after it moved back by one, the scan of a dispatch goes on from the same node. SCHED_CoreEarliest is
+      not raised, the next walk finds the new one*/
+    if(Position < SCHED_CoreCursor[Class])
+    {
+        SCHED_CoreCursor[Class]--;
+    }
+}
+
+static void SCHED_CoreMove (uint32_t ID)
+{
+    SCHED_CoreHeap[SCHED_CoreRunnables[ID].Class][SCHED_CoreRunnables[ID].Position].Release = SCHED_CoreRunnables[ID].NextRelease;
+    SCHED_CoreKeepEarliest(SCHED_CoreRunnables[ID].Class, SCHED_CoreRunnables[ID].NextRelease);
+}
+
+/*go on with the scan of the dispatch to the next node due at Now, a dispatch walks the list once so a tick costs one
+  check per runnable. The scan starts again from the first node after the last one*/
+static inline uint32_t SCHED_CoreFindDue (uint32_t Class, uint32_t Now, uint32_t* Position)
+{
+    uint32_t Found = 0;
+    while((Found == 0) && (SCHED_CoreCursor[Class] < SCHED_CoreHeapSize[Class]))
+    {
+        if((int32_t)(Now - SCHED_CoreHeap[Class][SCHED_CoreCursor[Class]].Release) >= 0)
+        {
+            Found = 1;
+            *Position = SCHED_CoreCursor[Class];
+        }
+        else
+        {
+            if((int32_t)(SCHED_CoreHeap[Class][SCHED_CoreCursor[Class]].Release - SCHED_CoreScanEarliest[Class]) < 0)
+            {
+                SCHED_CoreScanEarliest[Class] = SCHED_CoreHeap[Class][SCHED_CoreCursor[Class]].Release;
+            }
+            SCHED_CoreCursor[Class]++;
+        }
+    }
+    if(Found == 0)
+    {
+        /*every node was passed since the last walk ended or was counted when it was added or moved*/
+        SCHED_CoreCursor[Class] = 0;
+        SCHED_CoreEarliest[Class] = SCHED_CoreScanEarliest[Class];
+        SCHED_CoreScanEarliest[Class] = SCHED_CORE_LATEST(Now);
+    }
+    return Found;
+}
+
+/*the scan stays on the node, a runnable that is still due (SCHED_CORE_BACKLOG_RUN_ALL) is taken again at once*/
+static inline void SCHED_CoreTaken (uint32_t Class, uint32_t Position)
+{
+    (void)Class;
+    (void)Position;
+}
+
+/*check if no runnable of the class is due at Now before a dispatch walks the list, without the critical section: the
+  other classes change the list only when they preempt the dispatch and they are done before it goes on, a node
+  added meanwhile is taken at the next dispatch as if it was added after this one. A dispatch that is walking the
+  list (the cursor is not at its start) goes on*/
+static inline uint32_t SCHED_CoreQueueIsIdle (uint32_t Class, uint32_t Now)
+{
+    return ((SCHED_CoreCursor[Class] == 0) && ((int32_t)(Now - SCHED_CoreEarliest[Class]) < 0));
+}
+#endif
+
+/*first release of a runnable after Offset, Release is its next release and both are measured from the same time,
+  a runnable without periodicity has no release after Offset if its next release is not after it*/
+static inline uint32_t SCHED_CoreReleaseAfter (uint32_t ID, uint32_t Release, uint32_t Offset)
+{
+    while((Release <= Offset) && (SCHED_CoreRunnables[ID].Periodicity))
+    {
+        Release += SCHED_CoreRunnables[ID].Periodicity;
+    }
+    return Release;
+}
+
+/*---------------------------------------------------------------------------------------------------*/
+/*                                           APIs:                                                   */
+/*---------------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief empty the heaps, call it before adding the runnables.
+ * @param NoThing
+ * @return NoThing
+ */
+void SCHED_CoreInit (void)
+{
+    for(uint32_t itr = 0 ; itr < SCHED_CORE_MAX_RUNNABLES ; itr++)
+    {
+        SCHED_CoreRunnables[itr].Position = SCHED_CORE_OUT;
+    }
+    for(uint32_t itr = 0 ; itr < SCHED_CORE_CLASSES ; itr++)
+    {
+        SCHED_CoreHeapSize[itr] = 0;
+#if (SCHED_CORE_QUEUE == SCHED_CORE_QUEUE_SCAN)
+        SCHED_CoreCursor[itr] = 0;
+        /*the first node added sets both*/
+        SCHED_CoreEarliest[itr] = 0;
+        SCHED_CoreScanEarliest[itr] = 0;
+#endif
+    }
+}
+
+/**
+ * @brief add a runnable to the heap of its class, it is active from now.
+ * @param ID : index of the runnable in the table of the board (below SCHED_CORE_MAX_RUNNABLES)
+ * @param Class : the heap it is dispatched from (below SCHED_CORE_CLASSES)
+ * @param FirstRelease : scheduler time (in ticks) of its first release
+ * @param Periodicity : in ticks, 0 for a runnable that runs once
+ * @param BacklogPolicy : SCHED_CoreBacklog_t
+ * @return NoThing
+ */
+void SCHED_CoreAdd (uint32_t ID, uint32_t Class, uint32_t FirstRelease, uint32_t Periodicity, uint32_t BacklogPolicy)
+{
+    uint32_t State = SCHED_CORE_ENTER_CRITICAL();
+    SCHED_CoreRunnables[ID].NextRelease = FirstRelease;
+    SCHED_CoreRunnables[ID].Periodicity = Periodicity;
+    SCHED_CoreRunnables[ID].MissedReleases = 0;
+    SCHED_CoreRunnables[ID].Class = (uint8_t)Class;
+    SCHED_CoreRunnables[ID].BacklogPolicy = (uint8_t)BacklogPolicy;
+    SCHED_CorePush(ID);
+    SCHED_CORE_EXIT_CRITICAL(State);
+}
+
+/**
+ * @brief take the release of the class that is due first if its time has come, apply the BacklogPolicy and set
+ *        the next release. The runnable stays in the heap while it is called so it can suspend itself or move
+ *        its release, a runnable without periodicity leaves it (it is suspended).
+ *        call it again till it returns 0, a runnable late by more than its period (SCHED_CORE_BACKLOG_RUN_ALL)
+ *        comes back for each missed release.
+ * @param Class : the class being dispatched
+ * @param Now : scheduler time (in ticks) of the class
+ * @param Pending : ticks that came after Now and are not dispatched yet, they count in the lag
+ * @param Release : pointer to the struct that will be filled with the release
+ * @return uint32_t : 1 if a release was taken, 0 if no runnable of the class is due
+ */
+uint32_t SCHED_CoreTakeDue (uint32_t Class, uint32_t Now, uint32_t Pending, SCHED_CoreRelease_t* Release)
+{
+    uint32_t Taken = 0;
+    uint32_t Position = 0;
+    uint32_t Lag = 0;
+    /*releases that are already due, this one included*/
+    uint32_t DueReleases = 1;
+    SCHED_CoreRunnable_t* Runnable = 0;
+    uint32_t State = 0;
+
+    /*a tick that releases nothing costs this check only, the interrupts are not masked for it*/
+    if(SCHED_CoreQueueIsIdle(Class, Now) == 0)
+    {
+        /*the other classes may change the heap between the check and the update*/
+        State = SCHED_CORE_ENTER_CRITICAL();
+        if(SCHED_CoreFindDue(Class, Now, &Position))
+        {
+            Taken = 1;
+            Release->ID = SCHED_CoreHeap[Class][Position].ID;
+            Runnable = &SCHED_CoreRunnables[Release->ID];
+            Release->Time = Runnable->NextRelease;
+            Release->Call = 1;
+            Lag = Pending + (Now - Runnable->NextRelease);
+            if(Runnable->Periodicity == 0)
+            {
+                /*a runnable without periodicity runs once then it is suspended*/
+                SCHED_CoreRemove(Release->ID);
+            }
+            else
+            {
+                if((Lag != 0) && (Runnable->BacklogPolicy != SCHED_CORE_BACKLOG_RUN_ALL))
+                {
+                    DueReleases += Lag / Runnable->Periodicity;
+                    Release->Call = (Runnable->BacklogPolicy == SCHED_CORE_BACKLOG_COALESCE);
+                    Runnable->MissedReleases += DueReleases - Release->Call;
+                }
+                /*the next release is counted from this one not from now, so the phase never drifts*/
+                Runnable->NextRelease += DueReleases * Runnable->Periodicity;
+                SCHED_CoreHeap[Class][Position].Release = Runnable->NextRelease;
+                SCHED_CoreTaken(Class, Position);
+            }
+        }
+        SCHED_CORE_EXIT_CRITICAL(State);
+    }
+    return Taken;
+}
+
+/**
+ * @brief check if no runnable of the class is due at Now, without masking the interrupts, so a dispatch that adds
+ *        its own critical section around SCHED_CoreTakeDue leaves the ticks that release nothing before it.
+ * @param Class : the class being dispatched
+ * @param Now : scheduler time (in ticks) of the class
+ * @return uint32_t : 1 if SCHED_CoreTakeDue would return 0, 0 if a release may be due
+ */
+uint32_t SCHED_CoreIsIdle (uint32_t Class, uint32_t Now)
+{
+    return SCHED_CoreQueueIsIdle(Class, Now);
+}
+
+/**
+ * @brief take a runnable out of its heap, it is not released till SCHED_CoreResume or SCHED_CoreSetRelease.
+ * @param ID : the runnable
+ * @return NoThing
+ */
+void SCHED_CoreSuspend (uint32_t ID)
+{
+    uint32_t State = SCHED_CORE_ENTER_CRITICAL();
+    if(SCHED_CoreRunnables[ID].Position != SCHED_CORE_OUT)
+    {
+        SCHED_CoreRemove(ID);
+    }
+    SCHED_CORE_EXIT_CRITICAL(State);
+}
+
+/**
+ * @brief put a suspended runnable back in its heap, it keeps its phase so it is released at the first
+ *        FirstRelease + n * Periodicity that is not before Now, the releases that passed are not missed releases.
+ *        nothing is done if it is active.
+ * @param ID : the runnable
+ * @param Now : scheduler time (in ticks) of its class
+ * @return NoThing
+ */
+void SCHED_CoreResume (uint32_t ID, uint32_t Now)
+{
+    SCHED_CoreRunnable_t* Runnable = &SCHED_CoreRunnables[ID];
+    uint32_t Late = 0;
+    /*the dispatcher of the runnable class may preempt the caller, so the check and the update are done together*/
+    uint32_t State = SCHED_CORE_ENTER_CRITICAL();
+    if(Runnable->Position == SCHED_CORE_OUT)
+    {
+        Late = Now - Runnable->NextRelease;
+        if(((int32_t)Late > 0) && (Runnable->Periodicity))
+        {
+            Runnable->NextRelease += ((Late + Runnable->Periodicity - 1) / Runnable->Periodicity) * Runnable->Periodicity;
+        }
+        else if((int32_t)Late > 0)
+        {
+            Runnable->NextRelease = Now;
+        }
+        SCHED_CorePush(ID);
+    }
+    SCHED_CORE_EXIT_CRITICAL(State);
+}
+
+/**
+ * @brief move the next release of a runnable, a suspended runnable is made active, the periodic releases
+ *        continue from the new one.
+ * @param ID : the runnable
+ * @param Release : scheduler time (in ticks) of the next release
+ * @return NoThing
+ */
+void SCHED_CoreSetRelease (uint32_t ID, uint32_t Release)
+{
+    uint32_t State = SCHED_CORE_ENTER_CRITICAL();
+    SCHED_CoreRunnables[ID].NextRelease = Release;
+    if(SCHED_CoreRunnables[ID].Position == SCHED_CORE_OUT)
+    {
+        SCHED_CorePush(ID);
+    }
+    else
+    {
+        SCHED_CoreMove(ID);
+    }
+    SCHED_CORE_EXIT_CRITICAL(State);
+}
+
+/**
+ * @brief change the periodicity of a runnable, the new value applies after its next release.
+ * @param ID : the runnable
+ * @param Periodicity : in ticks, 0 makes the next release the last one
+ * @return NoThing
+ */
+void SCHED_CoreSetPeriod (uint32_t ID, uint32_t Periodicity)
+{
+    SCHED_CoreRunnables[ID].Periodicity = Periodicity;
+}
+
+/**
+ * @brief ticks from Offset to the first release of the class after Offset, both measured from Now, for the tickless
+ *        schedulers. A release that is already due is handled at the next dispatch, so it does not count.
+ *        only the top of the heap down to the first release after Offset is walked.
+ * @param Class : the class
+ * @param Now : the time Offset and the result are measured from
+ * @param Offset : ticks after Now the result is measured from
+ * @param Limit : the result when no release of the class comes before Offset + Limit
+ * @return uint32_t : the ticks, Limit at most
+ */
+uint32_t SCHED_CoreNextDeadline (uint32_t Class, uint32_t Now, uint32_t Offset, uint32_t Limit)
+{
+#if (SCHED_CORE_QUEUE == SCHED_CORE_QUEUE_HEAP)
+    /*positions of the heap left to check, a node is checked only if its parent is released by Offset, the
+      children of a node released after Offset are released after it so they cannot come first*/
+    uint8_t Stack [SCHED_CORE_MAX_RUNNABLES];
+    uint32_t Top = 0;
+#endif
+    uint32_t Position = 0;
+    uint32_t Release = 0;
+    uint32_t State = SCHED_CORE_ENTER_CRITICAL();
+
+#if (SCHED_CORE_QUEUE == SCHED_CORE_QUEUE_HEAP)
+    if(SCHED_CoreHeapSize[Class] > 0)
+    {
+        Stack[Top++] = 0;
+    }
+    while(Top > 0)
+    {
+        Position = Stack[--Top];
+#else
+    for(Position = 0 ; Position < SCHED_CoreHeapSize[Class] ; Position++)
+    {
+#endif
+        Release = SCHED_CoreHeap[Class][Position].Release - Now;
+        /*a release that is still due now (resumed late) is handled at the next wake up*/
+        if((int32_t)Release < 0)
+        {
+            Release = 0;
+        }
+#if (SCHED_CORE_QUEUE == SCHED_CORE_QUEUE_HEAP)
+        if(Release <= Offset)
+        {
+            if(((2 * Position) + 1) < SCHED_CoreHeapSize[Class])
+            {
+                Stack[Top++] = (uint8_t)((2 * Position) + 1);
+            }
+            if(((2 * Position) + 2) < SCHED_CoreHeapSize[Class])
+            {
+                Stack[Top++] = (uint8_t)((2 * Position) + 2);
+            }
+        }
+#endif
+        Release = SCHED_CoreReleaseAfter(SCHED_CoreHeap[Class][Position].ID, Release, Offset);
+        if((Release > Offset) && ((Release - Offset) < Limit))
+        {
+            Limit = Release - Offset;
+        }
+    }
+    SCHED_CORE_EXIT_CRITICAL(State);
+    return Limit;
+}
+
+/**
+ * @brief check if a runnable is in its heap (added or resumed and not suspended).
+ * @param ID : the runnable
+ * @return uint32_t : 1 if it is active, 0 otherwise
+ */
+uint32_t SCHED_CoreIsActive (uint32_t ID)
+{
+    return (SCHED_CoreRunnables[ID].Position != SCHED_CORE_OUT);
+}
+
+/**
+ * @brief get the periodicity of a runnable.
+ * @param ID : the runnable
+ * @return uint32_t : the periodicity in ticks
+ */
+uint32_t SCHED_CoreGetPeriod (uint32_t ID)
+{
+    return SCHED_CoreRunnables[ID].Periodicity;
+}
+
+/**
+ * @brief get the number of releases of a runnable that were coalesced or skipped by its BacklogPolicy.
+ * @param ID : the runnable
+ * @return uint32_t : the count
+ */
+uint32_t SCHED_CoreGetMissedReleases (uint32_t ID)
+{
+    return SCHED_CoreRunnables[ID].MissedReleases;
+}
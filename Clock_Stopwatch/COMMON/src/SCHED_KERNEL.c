@@ -0,0 +1,1229 @@
+/*---------------------------------------------------------------------------------------------------*/
+/*                                           Includes:                                               */
+/*---------------------------------------------------------------------------------------------------*/
+/*by its path for the same reason as SCHED_CORE.c*/
+#include "../include/SCHED_KERNEL.h"
+#include <string.h>
+
+/*---------------------------------------------------------------------------------------------------*/
+/*                                           Defines:                                                */
+/*---------------------------------------------------------------------------------------------------*/
+#if ((SCHED_KERNEL_TICK_US == 0) || ((1000 % SCHED_KERNEL_TICK_US) != 0))
+#error "SCHED_KERNEL_TICK_US must be 1000 or a divisor of it, so every ms is a whole number of ticks"
+#endif
+
+#if ((SCHED_KERNEL_DEFER_QUEUE_SIZE & (SCHED_KERNEL_DEFER_QUEUE_SIZE - 1)) != 0)
+#error "SCHED_KERNEL_DEFER_QUEUE_SIZE must be a power of 2"
+#endif
+
+#if ((SCHED_KERNEL_SYNC != SCHED_KERNEL_SYNC_DISABLED) && (SCHED_KERNEL_MODE == SCHED_KERNEL_MODE_TICKLESS))
+#error "the sync needs a systick every tick, use SCHED_KERNEL_MODE_PERIODIC or SCHED_KERNEL_MODE_TABLE"
+#endif
+
+#if (SCHED_KERNEL_SYNC == SCHED_KERNEL_SYNC_SLAVE)
+/*ticks of a sync period, and the scheduler time in it of the last tick when an aligned slave gets the frame*/
+#define SCHED_KERNEL_SYNC_PERIOD_TICKS      SCHED_KERNEL_MS_TO_TICKS(SCHED_KERNEL_SYNC_PERIOD_MS)
+#define SCHED_KERNEL_SYNC_ARRIVAL_TICKS     (SCHED_KERNEL_SYNC_LATENCY_US / SCHED_KERNEL_TICK_US)
+
+#if (SCHED_KERNEL_SYNC_ARRIVAL_TICKS >= SCHED_KERNEL_SYNC_PERIOD_TICKS)
+#error "SCHED_KERNEL_SYNC_LATENCY_US must be shorter than SCHED_KERNEL_SYNC_PERIOD_MS"
+#endif
+#endif
+
+#define SCHED_KERNEL_DEFER_INDEX_MASK       (SCHED_KERNEL_DEFER_QUEUE_SIZE - 1)
+
+#define SCHED_KERNEL_CYCLES_PER_MS          (SCHED_KERNEL_CYCLES_PER_US * 1000)
+#define SCHED_KERNEL_CYCLES_PER_TICK        (SCHED_KERNEL_CYCLES_PER_US * SCHED_KERNEL_TICK_US)
+
+#define SCHED_KERNEL_TIMED                  ((SCHED_KERNEL_STATS == SCHED_KERNEL_ENABLED) || \
+                                             (SCHED_KERNEL_BUDGET == SCHED_KERNEL_ENABLED))
+
+/*---------------------------------------------------------------------------------------------------*/
+/*                                           Typedefs:                                               */
+/*---------------------------------------------------------------------------------------------------*/
+typedef struct
+{
+    const char* Name;
+    SCHED_KernelCallBack_t CB;
+    uint32_t Class;
+    uint32_t Events;
+#if (SCHED_KERNEL_SLEEP == SCHED_KERNEL_ENABLED)
+    uint32_t Sleeping;                          //1 from SCHED_KernelSleep till the release at WakeRelease, the events skip it
+    uint32_t WakeRelease;
+#endif
+#if (SCHED_KERNEL_BUDGET == SCHED_KERNEL_ENABLED)
+    uint32_t BudgetCycles;                      //BudgetUs in core clock cycles, 0 without a budget
+    uint32_t BudgetOverruns;                    //calls longer than the budget since the start
+    uint32_t OverrunsInRow;                     //calls longer than the budget since the last one within it
+    uint32_t WithinInRow;                       //calls within the budget since the last one longer than it
+    uint32_t Slowdown;                          //the runnable is called at 1 of this many periodic releases, a power of 2
+    uint32_t Skipped;                           //periodic releases skipped since its last call
+#endif
+#if (SCHED_KERNEL_STATS == SCHED_KERNEL_ENABLED)
+    SCHED_KernelStats_t Stats;
+    uint64_t TotalExecCycles;
+    uint32_t Release;                           //scheduler time of the release being called, for the start jitter
+#endif
+}SCHED_KernelState_t;
+
+/*slot of the deferred work queue, SCHED_KernelDefer writes the Work last and the dispatcher clears it before it
+  frees the slot, so the Work is not NULL only while the slot holds a complete work*/
+typedef struct
+{
+    SCHED_KernelWork_t volatile Work;
+    uint32_t Arg;
+}SCHED_KernelDeferSlot_t;
+
+/*the kernel has a cooperative and a preemptive class, the boards give their class enums to the core*/
+typedef char SCHED_KernelClassesCheck_t [(SCHED_CORE_CLASSES == SCHED_KERNEL_CLASSES) ? 1 : -1];
+
+#if (SCHED_KERNEL_LOAD == SCHED_KERNEL_ENABLED)
+/*the window being measured now*/
+typedef struct
+{
+    uint32_t StartCycles;                       //cycle counter value at the start of the window
+    uint32_t StartBusy;                         //SCHED_KernelBusyCycles at the start of the window
+    uint32_t PeakBusy;                          //busy cycles of the busiest tick of the window
+    uint32_t PeakCycles;                        //length of that tick
+}SCHED_KernelLoadWindowState_t;
+#endif
+
+/*---------------------------------------------------------------------------------------------------*/
+/*                                           Variables:                                              */
+/*---------------------------------------------------------------------------------------------------*/
+#if (SCHED_KERNEL_MODE == SCHED_KERNEL_MODE_TICKLESS)
+/*time of the finished systick intervals that is not consumed yet by each class*/
+static volatile uint32_t SCHED_KernelElapsedTime [SCHED_KERNEL_CLASSES] ;
+/*length of the systick interval that is counting now*/
+static volatile uint32_t SCHED_KernelCurrentInterval = 0 ;
+/*length of the next systick interval, it is the value written in the systick LOAD register*/
+static volatile uint32_t SCHED_KernelLoadInterval = 0 ;
+#else
+/*ticks not dispatched yet by each class, the tick of the time 0 is pending at the start*/
+static volatile uint32_t SCHED_KernelPendingTicks [SCHED_KERNEL_CLASSES] = {1, 1} ;
+#endif
+
+#if (SCHED_KERNEL_MODE == SCHED_KERNEL_MODE_TABLE)
+/*entry of SCHED_KERNEL_TABLE of the tick each class dispatches next*/
+static uint32_t SCHED_KernelTableEntry [SCHED_KERNEL_CLASSES] ;
+#endif
+
+/*events posted by the ISRs and not dispatched yet by each class*/
+static volatile uint32_t SCHED_KernelPendingEvents [SCHED_KERNEL_CLASSES] ;
+
+/*deferred work queue, the ISRs take the slots at SCHED_KernelDeferHead and the dispatcher of SCHED_KERNEL_DEFER frees
+  them at SCHED_KernelDeferTail, both count from the start and the slot of a count is Count & SCHED_KERNEL_DEFER_INDEX_MASK*/
+static SCHED_KernelDeferSlot_t SCHED_KernelDeferQueue [SCHED_KERNEL_DEFER_QUEUE_SIZE] ;
+static volatile uint32_t SCHED_KernelDeferHead = 0 ;
+static volatile uint32_t SCHED_KernelDeferTail = 0 ;
+static volatile uint32_t SCHED_KernelDeferDrops = 0 ;
+
+/*scheduler time (in ticks) of the releases being dispatched now by each class*/
+static uint32_t SCHED_KernelTime [SCHED_KERNEL_CLASSES] ;
+
+/*the runnables, their releases (next release, periodicity, suspension) are kept by COMMON/SCHED_CORE*/
+static SCHED_KernelState_t SCHED_KernelRunnables [SCHED_CORE_MAX_RUNNABLES] ;
+static uint32_t SCHED_KernelRegistered = 0 ;
+
+#if (SCHED_KERNEL_BUDGET == SCHED_KERNEL_ENABLED)
+/*budget policy set by SCHED_KernelSetBudgetHook, NULL for the default one*/
+static SCHED_KernelBudgetHook_t SCHED_KernelBudgetHook = NULL ;
+#endif
+
+#if SCHED_KERNEL_TIMED
+/*cycles spent since the start in the interrupts the kernel knows of (the systick, PendSV and the ISRs that call
+  SCHED_KernelEnterIsr), it wraps like the cycle counter, the growth during a call is taken off its execution time*/
+static volatile uint32_t SCHED_KernelIsrCycles = 0 ;
+#endif
+
+#if (SCHED_KERNEL_SYNC == SCHED_KERNEL_SYNC_MASTER)
+/*sends the sync frame, set by SCHED_KernelSetSyncHook*/
+static volatile SCHED_KernelCallBack_t SCHED_KernelSyncHook = NULL ;
+/*ticks since the last sync frame, the tick of the scheduler time 0 is the first one*/
+static uint32_t SCHED_KernelSyncTicks = 0 ;
+#endif
+
+#if (SCHED_KERNEL_SYNC == SCHED_KERNEL_SYNC_SLAVE)
+/*scheduler time modulo the sync period of the last tick given to the dispatchers, the tick of the time 0 is pending
+  at the start*/
+static volatile uint32_t SCHED_KernelSyncTime = 0 ;
+/*ticks the systick still has to add (> 0) or to hold back (< 0) to catch up with the master*/
+static volatile int32_t SCHED_KernelSyncCorrection = 0 ;
+#endif
+
+#if (SCHED_KERNEL_STATS == SCHED_KERNEL_ENABLED)
+/*cycle counter value at the scheduler time 0*/
+static uint32_t SCHED_KernelStartCycles = 0 ;
+/*longest release latency of each class*/
+static uint32_t SCHED_KernelClassMaxLatency [SCHED_KERNEL_CLASSES] ;
+#endif
+
+#if (SCHED_KERNEL_LOAD == SCHED_KERNEL_ENABLED)
+static const uint32_t SCHED_KernelLoadWindowMs [_SCHED_KernelLoadWindowNumber] = {SCHED_KERNEL_LOAD_SHORT_WINDOW_MS,
+                                                                                   SCHED_KERNEL_LOAD_LONG_WINDOW_MS};
+
+/*nesting depth of the dispatchers, the preemptive one may run inside the cooperative one*/
+static volatile uint32_t SCHED_KernelBusyDepth = 0 ;
+/*cycle counter value when the outer dispatcher started*/
+static volatile uint32_t SCHED_KernelBusyStart = 0 ;
+/*busy cycles of the finished dispatches since the start, it wraps like the cycle counter*/
+static volatile uint32_t SCHED_KernelBusyCycles = 0 ;
+/*cycle counter and busy cycles at the last systick*/
+static uint32_t SCHED_KernelLastTickCycles = 0 ;
+static uint32_t SCHED_KernelLastTickBusy = 0 ;
+
+static SCHED_KernelLoadWindowState_t SCHED_KernelLoadWindows [_SCHED_KernelLoadWindowNumber] ;
+/*load of the last complete window, SCHED_KernelLoadReady is 0 till it completes once*/
+static SCHED_KernelLoad_t SCHED_KernelLastLoad [_SCHED_KernelLoadWindowNumber] ;
+static uint32_t SCHED_KernelLoadReady [_SCHED_KernelLoadWindowNumber] ;
+#endif
+
+/*---------------------------------------------------------------------------------------------------*/
+/*                                           Static Function:                                        */
+/*---------------------------------------------------------------------------------------------------*/
+#if (SCHED_KERNEL_STATS == SCHED_KERNEL_ENABLED)
+static void SCHED_KernelUpdateStats (uint32_t ID, uint32_t Timed, uint32_t StartCycles, uint32_t ExecCycles)
+{
+    SCHED_KernelStats_t* Stats = &SCHED_KernelRunnables[ID].Stats;
+    /*measured from the release time, unsigned subtraction keeps the result right when the cycle counter wraps*/
+    uint32_t Jitter = StartCycles - (SCHED_KernelStartCycles + (SCHED_KernelRunnables[ID].Release * SCHED_KERNEL_CYCLES_PER_TICK));
+
+    Stats->Runs++;
+    SCHED_KernelRunnables[ID].TotalExecCycles += ExecCycles;
+    if(ExecCycles < Stats->MinExecCycles)
+    {
+        Stats->MinExecCycles = ExecCycles;
+    }
+    if(ExecCycles > Stats->MaxExecCycles)
+    {
+        Stats->MaxExecCycles = ExecCycles;
+    }
+    /*a release by an event has no release time to measure the jitter from*/
+    if((Timed) && (Jitter < Stats->MinStartJitter))
+    {
+        Stats->MinStartJitter = Jitter;
+    }
+    if((Timed) && (Jitter > Stats->MaxStartJitter))
+    {
+        Stats->MaxStartJitter = Jitter;
+    }
+    if((Timed) && (Jitter > SCHED_KernelClassMaxLatency[SCHED_KernelRunnables[ID].Class]))
+    {
+        SCHED_KernelClassMaxLatency[SCHED_KernelRunnables[ID].Class] = Jitter;
+    }
+    /*a runnable without periodicity runs once, it has no period to overrun*/
+    if((SCHED_CoreGetPeriod(ID)) && (ExecCycles > (SCHED_CoreGetPeriod(ID) * SCHED_KERNEL_CYCLES_PER_TICK)))
+    {
+        Stats->Overruns++;
+    }
+}
+#endif
+
+/*periodicity of the runnable in ticks, PeriodicityUs is rounded down to whole ticks but never to 0 (run once)*/
+static uint32_t SCHED_KernelPeriodTicks (const SCHED_KernelRunnable_t* Runnable)
+{
+    uint32_t Ticks = SCHED_KERNEL_MS_TO_TICKS(Runnable->PeriodicityMs);
+    if(Runnable->PeriodicityUs)
+    {
+        Ticks = Runnable->PeriodicityUs / SCHED_KERNEL_TICK_US;
+        if(Ticks == 0)
+        {
+            Ticks = 1;
+        }
+    }
+    return Ticks;
+}
+
+#if (SCHED_KERNEL_BUDGET == SCHED_KERNEL_ENABLED)
+/*count the overruns of the budget, the policy is called at every SCHED_KERNEL_BUDGET_STRIKES overruns in a row, the
+  default one slows the runnable down. A slowed down runnable comes back by halves after
+  SCHED_KERNEL_BUDGET_RECOVERY_RUNS calls in a row within the budget*/
+static void SCHED_KernelCheckBudget (uint32_t ID, uint32_t ExecCycles)
+{
+    SCHED_KernelState_t* State = &SCHED_KernelRunnables[ID];
+    uint32_t Action = SCHED_KERNEL_BUDGET_KEEP;
+
+    if((State->BudgetCycles == 0) || (ExecCycles <= State->BudgetCycles))
+    {
+        State->OverrunsInRow = 0;
+        State->WithinInRow++;
+        if((State->Slowdown > 1) && (State->WithinInRow >= SCHED_KERNEL_BUDGET_RECOVERY_RUNS))
+        {
+            State->WithinInRow = 0;
+            State->Slowdown /= 2;
+        }
+    }
+    else
+    {
+        State->BudgetOverruns++;
+        State->OverrunsInRow++;
+        State->WithinInRow = 0;
+        if(State->OverrunsInRow >= SCHED_KERNEL_BUDGET_STRIKES)
+        {
+            State->OverrunsInRow = 0;
+            Action = (SCHED_KernelBudgetHook) ? SCHED_KernelBudgetHook(ID, State->BudgetOverruns) :
+                                                SCHED_KERNEL_BUDGET_SLOW_DOWN;
+        }
+    }
+
+    /*the slowdown skips periodic releases so it works with the release table too, a runnable without periodicity
+      runs once anyway*/
+    if(Action == SCHED_KERNEL_BUDGET_SLOW_DOWN)
+    {
+        if((SCHED_CoreGetPeriod(ID)) && (State->Slowdown < SCHED_KERNEL_BUDGET_MAX_SLOWDOWN))
+        {
+            State->Slowdown *= 2;
+        }
+    }
+    else if(Action == SCHED_KERNEL_BUDGET_SUSPEND)
+    {
+        SCHED_CoreSuspend(ID);
+    }
+}
+#endif
+
+#if (SCHED_KERNEL_BUDGET == SCHED_KERNEL_ENABLED)
+/*1 if the periodic release is skipped by the slowdown of the runnable*/
+static uint32_t SCHED_KernelSlowedDown (uint32_t ID, uint32_t Timed)
+{
+    SCHED_KernelState_t* State = &SCHED_KernelRunnables[ID];
+    uint32_t Skip = 0;
+    if((Timed) && (State->Slowdown > 1))
+    {
+        State->Skipped++;
+        if(State->Skipped < State->Slowdown)
+        {
+            Skip = 1;
+        }
+        else
+        {
+            State->Skipped = 0;
+        }
+    }
+    return Skip;
+}
+#endif
+
+/*Timed is 1 for a periodic release and 0 for a release by an event*/
+static void SCHED_KernelRun (uint32_t ID, uint32_t Timed)
+{
+#if SCHED_KERNEL_TIMED
+    uint32_t StartIsrCycles = 0;
+    uint32_t StartCycles = 0;
+    uint32_t ExecCycles = 0;
+#endif
+#if (SCHED_KERNEL_BUDGET == SCHED_KERNEL_ENABLED)
+    if(SCHED_KernelSlowedDown(ID, Timed) == 0)
+#endif
+    {
+#if SCHED_KERNEL_TIMED
+        StartIsrCycles = SCHED_KernelIsrCycles;
+        StartCycles = SCHED_KERNEL_CYCLES();
+#endif
+        (void)Timed;
+        SCHED_KERNEL_TRACE(RUNNABLE_START, ID, Timed);
+        SCHED_KernelRunnables[ID].CB();
+        SCHED_KERNEL_TRACE(RUNNABLE_END, ID, 0);
+#if SCHED_KERNEL_TIMED
+        /*the interrupts and the preemptive runnables in the middle of the call are not its time*/
+        ExecCycles = (SCHED_KERNEL_CYCLES() - StartCycles) - (SCHED_KernelIsrCycles - StartIsrCycles);
+#endif
+#if (SCHED_KERNEL_STATS == SCHED_KERNEL_ENABLED)
+        SCHED_KernelUpdateStats(ID, Timed, StartCycles, ExecCycles);
+#endif
+#if (SCHED_KERNEL_BUDGET == SCHED_KERNEL_ENABLED)
+        SCHED_KernelCheckBudget(ID, ExecCycles);
+#endif
+    }
+}
+
+/*mark the start of a dispatch, only the outer one of nested dispatches is timed*/
+static inline void SCHED_KernelBusyBegin (void)
+{
+#if (SCHED_KERNEL_LOAD == SCHED_KERNEL_ENABLED)
+    uint32_t State = SCHED_CORE_ENTER_CRITICAL();
+    if(SCHED_KernelBusyDepth == 0)
+    {
+        SCHED_KernelBusyStart = SCHED_KERNEL_CYCLES();
+    }
+    SCHED_KernelBusyDepth++;
+    SCHED_CORE_EXIT_CRITICAL(State);
+#endif
+}
+
+static inline void SCHED_KernelBusyEnd (void)
+{
+#if (SCHED_KERNEL_LOAD == SCHED_KERNEL_ENABLED)
+    uint32_t State = SCHED_CORE_ENTER_CRITICAL();
+    SCHED_KernelBusyDepth--;
+    if(SCHED_KernelBusyDepth == 0)
+    {
+        SCHED_KernelBusyCycles += SCHED_KERNEL_CYCLES() - SCHED_KernelBusyStart;
+    }
+    SCHED_CORE_EXIT_CRITICAL(State);
+#endif
+}
+
+#if (SCHED_KERNEL_LOAD == SCHED_KERNEL_ENABLED)
+/*called from the systick, the busy time of the tick that ended is compared with the busiest one (without a division)
+  and every window that is over is closed, the dispatch that is running counts till now*/
+static void SCHED_KernelUpdateLoad (void)
+{
+    uint32_t Now = SCHED_KERNEL_CYCLES();
+    uint32_t Busy = SCHED_KernelBusyCycles + ((SCHED_KernelBusyDepth) ? (Now - SCHED_KernelBusyStart) : 0);
+    uint32_t TickBusy = Busy - SCHED_KernelLastTickBusy;
+    uint32_t TickCycles = Now - SCHED_KernelLastTickCycles;
+    uint32_t WindowCycles = 0;
+    SCHED_KernelLoadWindowState_t* Window = NULL;
+
+    SCHED_KernelLastTickBusy = Busy;
+    SCHED_KernelLastTickCycles = Now;
+    for(uint32_t itr = 0 ; itr < _SCHED_KernelLoadWindowNumber ; itr++)
+    {
+        Window = &SCHED_KernelLoadWindows[itr];
+        if(((uint64_t)TickBusy * Window->PeakCycles) >= ((uint64_t)Window->PeakBusy * TickCycles))
+        {
+            Window->PeakBusy = TickBusy;
+            Window->PeakCycles = TickCycles;
+        }
+        WindowCycles = Now - Window->StartCycles;
+        if(WindowCycles >= (SCHED_KernelLoadWindowMs[itr] * SCHED_KERNEL_CYCLES_PER_MS))
+        {
+            SCHED_KernelLastLoad[itr].BusyCycles = Busy - Window->StartBusy;
+            SCHED_KernelLastLoad[itr].IdleCycles = WindowCycles - SCHED_KernelLastLoad[itr].BusyCycles;
+            SCHED_KernelLastLoad[itr].Utilisation = (uint32_t)(((uint64_t)SCHED_KernelLastLoad[itr].BusyCycles * 1000) / WindowCycles);
+            SCHED_KernelLastLoad[itr].PeakTickUtilisation = (Window->PeakCycles) ?
+                                                            (uint32_t)(((uint64_t)Window->PeakBusy * 1000) / Window->PeakCycles) : 0;
+            SCHED_KernelLoadReady[itr] = 1;
+            Window->StartCycles = Now;
+            Window->StartBusy = Busy;
+            Window->PeakBusy = 0;
+            Window->PeakCycles = 0;
+        }
+    }
+}
+
+/*all the windows start with the scheduler*/
+static void SCHED_KernelStartLoad (void)
+{
+    SCHED_KernelLastTickCycles = SCHED_KERNEL_CYCLES();
+    for(uint32_t itr = 0 ; itr < _SCHED_KernelLoadWindowNumber ; itr++)
+    {
+        SCHED_KernelLoadWindows[itr].StartCycles = SCHED_KernelLastTickCycles;
+    }
+}
+#endif
+
+/*the time 0 of the statistics and of the load*/
+static void SCHED_KernelStartClocks (void)
+{
+#if (SCHED_KERNEL_STATS == SCHED_KERNEL_ENABLED)
+    SCHED_KernelStartCycles = SCHED_KERNEL_CYCLES();
+#endif
+#if (SCHED_KERNEL_LOAD == SCHED_KERNEL_ENABLED)
+    SCHED_KernelStartLoad();
+#endif
+}
+
+/*call the active runnables of the class subscribed to the posted events, their periodic releases are not changed*/
+static void SCHED_KernelReleaseEvents (uint32_t Class)
+{
+    uint32_t State = SCHED_CORE_ENTER_CRITICAL();
+    uint32_t Events = SCHED_KernelPendingEvents[Class];
+    SCHED_KernelPendingEvents[Class] = 0;
+    SCHED_CORE_EXIT_CRITICAL(State);
+
+    for(uint32_t itr = 0 ; itr < SCHED_KernelRegistered ; itr++)
+    {
+        if((SCHED_CoreIsActive(itr)) && (SCHED_KernelRunnables[itr].Class == Class) &&
+#if (SCHED_KERNEL_SLEEP == SCHED_KERNEL_ENABLED)
+           (SCHED_KernelRunnables[itr].Sleeping == 0) &&
+#endif
+           (SCHED_KernelRunnables[itr].Events & Events))
+        {
+            SCHED_KernelRun(itr, 0);
+        }
+    }
+}
+
+/*call the deferred works in the order they were queued, it is the only reader of the queue. It stops at a slot
+  taken by an ISR that was preempted before it wrote the work, SCHED_KernelDefer dispatches again after writing it*/
+static void SCHED_KernelRunDeferred (void)
+{
+    uint32_t Tail = SCHED_KernelDeferTail;
+    uint32_t Arg = 0;
+    SCHED_KernelDeferSlot_t* Slot = &SCHED_KernelDeferQueue[Tail & SCHED_KERNEL_DEFER_INDEX_MASK];
+    SCHED_KernelWork_t Work = __atomic_load_n(&Slot->Work, __ATOMIC_ACQUIRE);
+
+    while(Work != NULL)
+    {
+        Arg = Slot->Arg;
+        Slot->Work = NULL;
+        Tail++;
+        /*the slot is free for the ISRs from here, the work may queue more works*/
+        __atomic_store_n(&SCHED_KernelDeferTail, Tail, __ATOMIC_RELEASE);
+        Work(Arg);
+        Slot = &SCHED_KernelDeferQueue[Tail & SCHED_KERNEL_DEFER_INDEX_MASK];
+        Work = __atomic_load_n(&Slot->Work, __ATOMIC_ACQUIRE);
+    }
+}
+
+/*index of the runnable that has this name, SCHED_KernelRegistered if there is no such runnable*/
+static uint32_t SCHED_KernelFind (const char* Name)
+{
+    uint32_t itr = 0;
+    for(itr = 0 ; itr < SCHED_KernelRegistered ; itr++)
+    {
+        if((SCHED_KernelRunnables[itr].Name) && (strcmp(SCHED_KernelRunnables[itr].Name, Name) == 0))
+        {
+            break;
+        }
+    }
+    return itr;
+}
+
+#if (SCHED_KERNEL_MODE != SCHED_KERNEL_MODE_TABLE)
+#if (SCHED_KERNEL_SLEEP == SCHED_KERNEL_ENABLED)
+/*take the next due release of the class, a sleeping runnable is due only at its wake time so its sleep is over*/
+static uint32_t SCHED_KernelTakeDue (uint32_t Class, uint32_t Lag, SCHED_CoreRelease_t* Release)
+{
+    uint32_t State = 0;
+    uint32_t Taken = 0;
+    /*a tick that releases nothing does not mask the interrupts*/
+    if(SCHED_CoreIsIdle(Class, SCHED_KernelTime[Class]) == 0)
+    {
+        State = SCHED_CORE_ENTER_CRITICAL();
+        Taken = SCHED_CoreTakeDue(Class, SCHED_KernelTime[Class], Lag, Release);
+        if(Taken)
+        {
+            SCHED_KernelRunnables[Release->ID].Sleeping = 0;
+        }
+        SCHED_CORE_EXIT_CRITICAL(State);
+    }
+    return Taken;
+}
+
+/*a runnable without periodicity left the queue before the call and called SCHED_KernelSleep while it ran, it is
+  released again at its wake time*/
+static void SCHED_KernelWake (uint32_t ID)
+{
+    uint32_t State = SCHED_CORE_ENTER_CRITICAL();
+    if((SCHED_KernelRunnables[ID].Sleeping) && (SCHED_CoreIsActive(ID) == 0))
+    {
+        SCHED_CoreSetRelease(ID, SCHED_KernelRunnables[ID].WakeRelease);
+    }
+    SCHED_CORE_EXIT_CRITICAL(State);
+}
+#else
+#define SCHED_KernelTakeDue(Class, Lag, Release)    SCHED_CoreTakeDue((Class), SCHED_KernelTime[Class], (Lag), (Release))
+#endif
+
+/*call every due runnable of the class in the order of their releases, Lag is how late in ticks the scheduler is after
+  the current time, the core applies the BacklogPolicy and sets the next release before the call*/
+static void SCHED_KernelReleaseDue (uint32_t Class, uint32_t Lag)
+{
+    SCHED_CoreRelease_t Release;
+    while(SCHED_KernelTakeDue(Class, Lag, &Release))
+    {
+        if(Release.Call)
+        {
+#if (SCHED_KERNEL_STATS == SCHED_KERNEL_ENABLED)
+            SCHED_KernelRunnables[Release.ID].Release = Release.Time;
+#endif
+            SCHED_KernelRun(Release.ID, 1);
+        }
+#if (SCHED_KERNEL_SLEEP == SCHED_KERNEL_ENABLED)
+        SCHED_KernelWake(Release.ID);
+#endif
+    }
+}
+#endif
+
+#if (SCHED_KERNEL_MODE == SCHED_KERNEL_MODE_TICKLESS)
+static void SCHED_KernelTickElapsed (void)
+{
+    uint32_t IsrMark = SCHED_KernelEnterIsr();
+#if (SCHED_KERNEL_LOAD == SCHED_KERNEL_ENABLED)
+    SCHED_KernelUpdateLoad();
+#endif
+    /*the systick reloaded the LOAD register at this interrupt, so the next interval starts counting now*/
+    SCHED_KernelElapsedTime[SCHED_KERNEL_CLASS_COOPERATIVE] += SCHED_KernelCurrentInterval;
+    SCHED_KernelElapsedTime[SCHED_KERNEL_CLASS_PREEMPTIVE] += SCHED_KernelCurrentInterval;
+    SCHED_KernelCurrentInterval = SCHED_KernelLoadInterval;
+    SCHED_KERNEL_PEND_PREEMPTIVE();
+    SCHED_KernelExitIsr(IsrMark);
+}
+
+/*length of the systick interval that starts after Offset, the nearest deadline of both classes, it is measured from
+  the time of the preemptive class which is never behind as PendSV runs at every systick before the super loop*/
+static uint32_t SCHED_KernelNextInterval (uint32_t Offset)
+{
+    uint32_t Now = SCHED_KernelTime[SCHED_KERNEL_CLASS_PREEMPTIVE];
+    return SCHED_CoreNextDeadline(SCHED_KERNEL_CLASS_COOPERATIVE, Now, Offset,
+                                  SCHED_CoreNextDeadline(SCHED_KERNEL_CLASS_PREEMPTIVE, Now, Offset,
+                                                         SCHED_KERNEL_MS_TO_TICKS(SCHED_KERNEL_MAX_SLEEP_MS)));
+}
+
+/*move the time of the class forward by Elapsed, the due runnables are called in deadline order as the periodic mode does*/
+static void SCHED_KernelAdvance (uint32_t Class, uint32_t Elapsed)
+{
+    uint32_t Step = 0;
+    while(Elapsed)
+    {
+        Step = SCHED_CoreNextDeadline(Class, SCHED_KernelTime[Class], 0, SCHED_KERNEL_MS_TO_TICKS(SCHED_KERNEL_MAX_SLEEP_MS));
+        if(Step > Elapsed)
+        {
+            Step = Elapsed;
+        }
+        Elapsed -= Step;
+        SCHED_KernelTime[Class] += Step;
+        SCHED_KERNEL_TRACE(DISPATCH_START, Class, 0);
+        SCHED_KernelReleaseDue(Class, Elapsed + SCHED_KernelElapsedTime[Class]);
+        SCHED_KERNEL_TRACE(DISPATCH_END, Class, 0);
+    }
+}
+
+/*take the time elapsed for the class, the systick may add to it in the middle*/
+static uint32_t SCHED_KernelTakeElapsed (uint32_t Class)
+{
+    uint32_t State = SCHED_CORE_ENTER_CRITICAL();
+    uint32_t Elapsed = SCHED_KernelElapsedTime[Class];
+    SCHED_KernelElapsedTime[Class] = 0;
+    SCHED_CORE_EXIT_CRITICAL(State);
+    return Elapsed;
+}
+#else
+static void SCHED_KernelTick (void)
+{
+    uint32_t IsrMark = SCHED_KernelEnterIsr();
+#if (SCHED_KERNEL_SYNC == SCHED_KERNEL_SYNC_SLAVE)
+    uint32_t Ticks = 1;
+#endif
+#if (SCHED_KERNEL_LOAD == SCHED_KERNEL_ENABLED)
+    SCHED_KernelUpdateLoad();
+#endif
+#if (SCHED_KERNEL_SYNC == SCHED_KERNEL_SYNC_SLAVE)
+    if(SCHED_KernelSyncCorrection > 0)
+    {
+        Ticks = 2;
+        SCHED_KernelSyncCorrection--;
+    }
+    else if(SCHED_KernelSyncCorrection < 0)
+    {
+        Ticks = 0;
+        SCHED_KernelSyncCorrection++;
+    }
+    SCHED_KernelSyncTime = (SCHED_KernelSyncTime + Ticks) % SCHED_KERNEL_SYNC_PERIOD_TICKS;
+    SCHED_KernelPendingTicks[SCHED_KERNEL_CLASS_COOPERATIVE] += Ticks;
+    SCHED_KernelPendingTicks[SCHED_KERNEL_CLASS_PREEMPTIVE] += Ticks;
+#else
+    SCHED_KernelPendingTicks[SCHED_KERNEL_CLASS_COOPERATIVE]++;
+    SCHED_KernelPendingTicks[SCHED_KERNEL_CLASS_PREEMPTIVE]++;
+#endif
+    SCHED_KERNEL_PEND_PREEMPTIVE();
+#if (SCHED_KERNEL_SYNC == SCHED_KERNEL_SYNC_MASTER)
+    /*the systick n is the tick of the scheduler time n, the frame leaves at the start of the tick*/
+    SCHED_KernelSyncTicks++;
+    if(SCHED_KernelSyncTicks == SCHED_KERNEL_MS_TO_TICKS(SCHED_KERNEL_SYNC_PERIOD_MS))
+    {
+        SCHED_KernelSyncTicks = 0;
+        if(SCHED_KernelSyncHook)
+        {
+            SCHED_KernelSyncHook();
+        }
+    }
+#endif
+    SCHED_KernelExitIsr(IsrMark);
+}
+
+/*take one pending tick of the class, the systick may add to them in the middle*/
+static uint32_t SCHED_KernelTakeTick (uint32_t Class)
+{
+    uint32_t Taken = 0;
+    uint32_t State = SCHED_CORE_ENTER_CRITICAL();
+    if(SCHED_KernelPendingTicks[Class])
+    {
+        SCHED_KernelPendingTicks[Class]--;
+        Taken = 1;
+    }
+    SCHED_CORE_EXIT_CRITICAL(State);
+    return Taken;
+}
+
+#if (SCHED_KERNEL_MODE == SCHED_KERNEL_MODE_TABLE)
+static void SCHED_KernelDispatch (uint32_t Class)
+{
+    /*the table entry holds the runnables released at this tick, the core is asked before each call so a runnable
+      suspended by another one is skipped, the release queue is not used*/
+    uint32_t Released = SCHED_KERNEL_TABLE[SCHED_KernelTableEntry[Class]];
+    SCHED_KERNEL_TRACE(DISPATCH_START, Class, 0);
+    for(uint32_t itr = 0 ; Released != 0 ; itr++, Released >>= 1)
+    {
+        if((Released & 1) && (SCHED_KernelRunnables[itr].Class == Class) && (SCHED_CoreIsActive(itr)))
+        {
+#if (SCHED_KERNEL_STATS == SCHED_KERNEL_ENABLED)
+            SCHED_KernelRunnables[itr].Release = SCHED_KernelTime[Class];
+#endif
+            SCHED_KernelRun(itr, 1);
+        }
+    }
+    /*after the last entry the table repeats its hyperperiod*/
+    SCHED_KernelTableEntry[Class]++;
+    if(SCHED_KernelTableEntry[Class] == SCHED_KERNEL_TABLE_LENGTH)
+    {
+        SCHED_KernelTableEntry[Class] = SCHED_KERNEL_TABLE_PROLOGUE;
+    }
+    SCHED_KernelTime[Class]++;
+    SCHED_KERNEL_TRACE(DISPATCH_END, Class, 0);
+}
+#else
+static void SCHED_KernelDispatch (uint32_t Class)
+{
+    SCHED_KERNEL_TRACE(DISPATCH_START, Class, 0);
+    /*ticks that came after the one being dispatched now*/
+    SCHED_KernelReleaseDue(Class, SCHED_KernelPendingTicks[Class]);
+    SCHED_KernelTime[Class]++;
+    SCHED_KERNEL_TRACE(DISPATCH_END, Class, 0);
+}
+#endif
+#endif
+
+/*one pass of the super loop, the dispatcher of the cooperative class*/
+static void SCHED_KernelCooperative (void)
+{
+#if (SCHED_KERNEL_MODE == SCHED_KERNEL_MODE_TICKLESS)
+    uint32_t Elapsed = 0;
+
+    /*interrupts are masked so a systick between the check and the sleep still wakes the core*/
+    SCHED_KERNEL_IDLE_LOCK();
+    Elapsed = SCHED_KernelElapsedTime[SCHED_KERNEL_CLASS_COOPERATIVE];
+    SCHED_KernelElapsedTime[SCHED_KERNEL_CLASS_COOPERATIVE] = 0;
+    if((Elapsed == 0) && (SCHED_KernelPendingEvents[SCHED_KERNEL_CLASS_COOPERATIVE] == 0) &&
+       ((SCHED_KERNEL_DEFER == SCHED_KERNEL_DEFER_PREEMPTIVE) || (SCHED_KernelDeferHead == SCHED_KernelDeferTail)))
+    {
+        SCHED_KERNEL_IDLE_WAIT();
+    }
+    SCHED_KERNEL_IDLE_UNLOCK();
+
+    SCHED_KernelBusyBegin();
+#if (SCHED_KERNEL_DEFER == SCHED_KERNEL_DEFER_COOPERATIVE)
+    SCHED_KernelRunDeferred();
+#endif
+    if(SCHED_KernelPendingEvents[SCHED_KERNEL_CLASS_COOPERATIVE])
+    {
+        SCHED_KernelReleaseEvents(SCHED_KERNEL_CLASS_COOPERATIVE);
+    }
+    if(Elapsed)
+    {
+        SCHED_KernelAdvance(SCHED_KERNEL_CLASS_COOPERATIVE, Elapsed);
+    }
+    SCHED_KernelBusyEnd();
+#else
+#if (SCHED_KERNEL_DEFER == SCHED_KERNEL_DEFER_COOPERATIVE)
+    if(SCHED_KernelDeferHead != SCHED_KernelDeferTail)
+    {
+        SCHED_KernelBusyBegin();
+        SCHED_KernelRunDeferred();
+        SCHED_KernelBusyEnd();
+    }
+#endif
+    if(SCHED_KernelPendingEvents[SCHED_KERNEL_CLASS_COOPERATIVE])
+    {
+        SCHED_KernelBusyBegin();
+        SCHED_KernelReleaseEvents(SCHED_KERNEL_CLASS_COOPERATIVE);
+        SCHED_KernelBusyEnd();
+    }
+    if(SCHED_KernelTakeTick(SCHED_KERNEL_CLASS_COOPERATIVE))
+    {
+        SCHED_KernelBusyBegin();
+        SCHED_KernelDispatch(SCHED_KERNEL_CLASS_COOPERATIVE);
+        SCHED_KernelBusyEnd();
+    }
+#endif
+}
+
+/*dispatcher of the preemptive class, the systick, SCHED_KernelPostEvent and SCHED_KernelDefer pend it*/
+void PendSV_Handler (void)
+{
+    uint32_t IsrMark = 0;
+#if (SCHED_KERNEL_MODE == SCHED_KERNEL_MODE_TICKLESS)
+    uint32_t State = 0;
+#endif
+    SCHED_KERNEL_TRACE_PENDSV(ISR_ENTRY);
+    IsrMark = SCHED_KernelEnterIsr();
+    SCHED_KernelBusyBegin();
+#if (SCHED_KERNEL_DEFER == SCHED_KERNEL_DEFER_PREEMPTIVE)
+    SCHED_KernelRunDeferred();
+#endif
+    if(SCHED_KernelPendingEvents[SCHED_KERNEL_CLASS_PREEMPTIVE])
+    {
+        SCHED_KernelReleaseEvents(SCHED_KERNEL_CLASS_PREEMPTIVE);
+    }
+#if (SCHED_KERNEL_MODE == SCHED_KERNEL_MODE_TICKLESS)
+    SCHED_KernelAdvance(SCHED_KERNEL_CLASS_PREEMPTIVE, SCHED_KernelTakeElapsed(SCHED_KERNEL_CLASS_PREEMPTIVE));
+
+    /*the LOAD is written here not in the super loop, so a long cooperative runnable never delays the deadlines of
+      the preemptive ones, if another interval finished meanwhile advance first*/
+    State = SCHED_CORE_ENTER_CRITICAL();
+    if(SCHED_KernelElapsedTime[SCHED_KERNEL_CLASS_PREEMPTIVE] == 0)
+    {
+        SCHED_KernelLoadInterval = SCHED_KernelNextInterval(SCHED_KernelCurrentInterval);
+        SCHED_KERNEL_TIMER_SET_US(SCHED_KernelLoadInterval * SCHED_KERNEL_TICK_US);
+    }
+    SCHED_CORE_EXIT_CRITICAL(State);
+#else
+    while(SCHED_KernelTakeTick(SCHED_KERNEL_CLASS_PREEMPTIVE))
+    {
+        SCHED_KernelDispatch(SCHED_KERNEL_CLASS_PREEMPTIVE);
+    }
+#endif
+    SCHED_KernelBusyEnd();
+    SCHED_KernelExitIsr(IsrMark);
+    SCHED_KERNEL_TRACE_PENDSV(ISR_EXIT);
+}
+
+/*the time 0 of the scheduler, the systick starts and the releases of the time 0 are called or pended, tools/sched_tickless
+  calls it before its own super loop*/
+static void SCHED_KernelStartTime (void)
+{
+    SCHED_KernelStartClocks();
+#if (SCHED_KERNEL_MODE == SCHED_KERNEL_MODE_TICKLESS)
+    /*the systick stays periodic and each LOAD value is written one interval ahead, so the time spent in the runnables
+      never shifts the next deadline. It is not started yet, so the releases of the time 0 of both classes are
+      called here*/
+    SCHED_KernelReleaseDue(SCHED_KERNEL_CLASS_PREEMPTIVE, 0);
+    SCHED_KernelReleaseDue(SCHED_KERNEL_CLASS_COOPERATIVE, 0);
+    SCHED_KernelCurrentInterval = SCHED_KernelNextInterval(0);
+    SCHED_KERNEL_TIMER_SET_US(SCHED_KernelCurrentInterval * SCHED_KERNEL_TICK_US);
+    SCHED_KERNEL_TIMER_START();
+    SCHED_KernelLoadInterval = SCHED_KernelNextInterval(SCHED_KernelCurrentInterval);
+    SCHED_KERNEL_TIMER_SET_US(SCHED_KernelLoadInterval * SCHED_KERNEL_TICK_US);
+#else
+    SCHED_KERNEL_TIMER_START();
+    /*the tick of the time 0 of the preemptive class*/
+    SCHED_KERNEL_PEND_PREEMPTIVE();
+#endif
+}
+
+/*---------------------------------------------------------------------------------------------------*/
+/*                                           APIs:                                                   */
+/*---------------------------------------------------------------------------------------------------*/
+void SCHED_KernelInit (void)
+{
+#if (SCHED_KERNEL_MODE == SCHED_KERNEL_MODE_TICKLESS)
+    SCHED_KERNEL_TIMER_INIT(SCHED_KernelTickElapsed);
+#else
+    SCHED_KERNEL_TIMER_INIT(SCHED_KernelTick);
+    SCHED_KERNEL_TIMER_SET_US(SCHED_KERNEL_TICK_US);
+#endif
+    SCHED_KERNEL_PREEMPTIVE_INIT();
+    SCHED_CoreInit();
+#if SCHED_KERNEL_TIMED || (SCHED_KERNEL_LOAD == SCHED_KERNEL_ENABLED)
+    SCHED_KERNEL_CYCLES_INIT();
+#endif
+}
+
+void SCHED_KernelStart (void)
+{
+    SCHED_KernelStartTime();
+    while(1)
+    {
+        SCHED_KernelCooperative();
+    }
+}
+
+SCHED_KernelStatus_t SCHED_KernelRegister (const SCHED_KernelRunnable_t* Runnable, uint32_t* ID)
+{
+    SCHED_KernelStatus_t Ret_Status = SCHED_KERNEL_OK;
+    SCHED_KernelState_t* State = NULL;
+    uint32_t Primask = 0;
+    if((Runnable == NULL) || (ID == NULL))
+    {
+        Ret_Status = SCHED_KERNEL_NULL_POINTER;
+    }
+    else if(Runnable->Class >= SCHED_KERNEL_CLASSES)
+    {
+        Ret_Status = SCHED_KERNEL_INVALID_CLASS;
+    }
+    else
+    {
+        /*a preemptive runnable may register another one in the middle, so the last free entry is checked and taken
+          together*/
+        Primask = SCHED_CORE_ENTER_CRITICAL();
+#if (SCHED_KERNEL_MODE == SCHED_KERNEL_MODE_TABLE)
+        if(SCHED_KernelRegistered >= SCHED_KERNEL_TABLE_RUNNABLES)
+        {
+            /*the release table has no entries for more runnables*/
+            Ret_Status = SCHED_KERNEL_NOT_SUPPORTED;
+        }
+        else
+#endif
+        if(SCHED_KernelRegistered >= SCHED_CORE_MAX_RUNNABLES)
+        {
+            Ret_Status = SCHED_KERNEL_FULL;
+        }
+        else
+        {
+            *ID = SCHED_KernelRegistered;
+            State = &SCHED_KernelRunnables[*ID];
+            State->Name = Runnable->Name;
+            State->CB = Runnable->CB;
+            State->Class = Runnable->Class;
+            State->Events = Runnable->Events;
+#if (SCHED_KERNEL_SLEEP == SCHED_KERNEL_ENABLED)
+            State->Sleeping = 0;
+#endif
+#if (SCHED_KERNEL_BUDGET == SCHED_KERNEL_ENABLED)
+            State->BudgetCycles = Runnable->BudgetUs * SCHED_KERNEL_CYCLES_PER_US;
+            State->BudgetOverruns = 0;
+            State->OverrunsInRow = 0;
+            State->WithinInRow = 0;
+            State->Slowdown = 1;
+            State->Skipped = 0;
+#endif
+#if (SCHED_KERNEL_STATS == SCHED_KERNEL_ENABLED)
+            State->Stats.MinExecCycles = 0xFFFFFFFF;
+            State->Stats.MinStartJitter = 0xFFFFFFFF;
+#endif
+            SCHED_KernelRegistered++;
+            /*a runnable without a CB takes its ID but is never released*/
+            if(Runnable->CB)
+            {
+                SCHED_CoreAdd(*ID, Runnable->Class, SCHED_KernelTime[Runnable->Class] + SCHED_KERNEL_MS_TO_TICKS(Runnable->DelayMs),
+                              SCHED_KernelPeriodTicks(Runnable), Runnable->BacklogPolicy);
+            }
+        }
+        SCHED_CORE_EXIT_CRITICAL(Primask);
+    }
+    return Ret_Status;
+}
+
+uint32_t SCHED_KernelEnterIsr (void)
+{
+#if SCHED_KERNEL_TIMED
+    /*the mark is the ISR cycles less the cycle counter, so the exit only adds the cycle counter to get the ISR cycles
+      at the entry plus the time of this ISR with the ones nested in it*/
+    return SCHED_KernelIsrCycles - SCHED_KERNEL_CYCLES();
+#else
+    return 0;
+#endif
+}
+
+void SCHED_KernelExitIsr (uint32_t Mark)
+{
+#if SCHED_KERNEL_TIMED
+    uint32_t State = SCHED_CORE_ENTER_CRITICAL();
+    SCHED_KernelIsrCycles = Mark + SCHED_KERNEL_CYCLES();
+    SCHED_CORE_EXIT_CRITICAL(State);
+#else
+    (void)Mark;
+#endif
+}
+
+void SCHED_KernelPostEvent (uint32_t Events)
+{
+    /*an interrupt with a higher priority may post between the read and the write*/
+    uint32_t State = SCHED_CORE_ENTER_CRITICAL();
+    SCHED_KernelPendingEvents[SCHED_KERNEL_CLASS_COOPERATIVE] |= Events;
+    SCHED_KernelPendingEvents[SCHED_KERNEL_CLASS_PREEMPTIVE] |= Events;
+    SCHED_CORE_EXIT_CRITICAL(State);
+    SCHED_KERNEL_PEND_PREEMPTIVE();
+}
+
+SCHED_KernelStatus_t SCHED_KernelDefer (SCHED_KernelWork_t Work, uint32_t Arg)
+{
+    SCHED_KernelStatus_t Ret_Status = SCHED_KERNEL_OK;
+    uint32_t Head = SCHED_KernelDeferHead;
+    SCHED_KernelDeferSlot_t* Slot = NULL;
+
+    if(Work == NULL)
+    {
+        Ret_Status = SCHED_KERNEL_NULL_POINTER;
+    }
+    else
+    {
+        /*the slot is taken by a compare and swap (LDREX/STREX), if an interrupt takes a slot in the middle the swap
+          fails and the next slot is tried, so the ISRs never wait for each other*/
+        do
+        {
+            if((Head - SCHED_KernelDeferTail) >= SCHED_KERNEL_DEFER_QUEUE_SIZE)
+            {
+                Ret_Status = SCHED_KERNEL_FULL;
+            }
+        }while((Ret_Status == SCHED_KERNEL_OK) &&
+               (!__atomic_compare_exchange_n(&SCHED_KernelDeferHead, &Head, Head + 1, 1, __ATOMIC_RELAXED, __ATOMIC_RELAXED)));
+
+        if(Ret_Status == SCHED_KERNEL_OK)
+        {
+            Slot = &SCHED_KernelDeferQueue[Head & SCHED_KERNEL_DEFER_INDEX_MASK];
+            Slot->Arg = Arg;
+            /*the Work is written last, the dispatcher takes the slot once it is not NULL*/
+            __atomic_store_n(&Slot->Work, Work, __ATOMIC_RELEASE);
+#if (SCHED_KERNEL_DEFER == SCHED_KERNEL_DEFER_PREEMPTIVE)
+            SCHED_KERNEL_PEND_PREEMPTIVE();
+#endif
+        }
+        else
+        {
+            __atomic_fetch_add(&SCHED_KernelDeferDrops, 1, __ATOMIC_RELAXED);
+        }
+    }
+    return Ret_Status;
+}
+
+uint32_t SCHED_KernelGetDeferDrops (void)
+{
+    return SCHED_KernelDeferDrops;
+}
+
+SCHED_KernelStatus_t SCHED_KernelSuspend (uint32_t ID)
+{
+    SCHED_KernelStatus_t Ret_Status = SCHED_KERNEL_OK;
+    if(ID >= SCHED_KernelRegistered)
+    {
+        Ret_Status = SCHED_KERNEL_INVALID_ID;
+    }
+    else
+    {
+        SCHED_CoreSuspend(ID);
+    }
+    return Ret_Status;
+}
+
+SCHED_KernelStatus_t SCHED_KernelResume (uint32_t ID)
+{
+    SCHED_KernelStatus_t Ret_Status = SCHED_KERNEL_OK;
+    uint32_t State = 0;
+    /*a runnable without a CB is never released*/
+    if((ID >= SCHED_KernelRegistered) || (SCHED_KernelRunnables[ID].CB == NULL))
+    {
+        Ret_Status = SCHED_KERNEL_INVALID_ID;
+    }
+    else
+    {
+        /*the dispatcher of the runnable class may preempt the caller, so the check and the update are done together*/
+        State = SCHED_CORE_ENTER_CRITICAL();
+        if(SCHED_CoreIsActive(ID) == 0)
+        {
+            SCHED_CoreResume(ID, SCHED_KernelTime[SCHED_KernelRunnables[ID].Class]);
+#if (SCHED_KERNEL_SLEEP == SCHED_KERNEL_ENABLED)
+            SCHED_KernelRunnables[ID].Sleeping = 0;
+#endif
+        }
+        SCHED_CORE_EXIT_CRITICAL(State);
+    }
+    return Ret_Status;
+}
+
+SCHED_KernelStatus_t SCHED_KernelSetPeriod (uint32_t ID, uint32_t PeriodicityMs)
+{
+    SCHED_KernelStatus_t Ret_Status = SCHED_KERNEL_OK;
+    if(ID >= SCHED_KernelRegistered)
+    {
+        Ret_Status = SCHED_KERNEL_INVALID_ID;
+    }
+    else if(PeriodicityMs == 0)
+    {
+        Ret_Status = SCHED_KERNEL_INVALID_PERIOD;
+    }
+    else if(SCHED_KERNEL_MODE == SCHED_KERNEL_MODE_TABLE)
+    {
+        /*the periods are fixed in the release table*/
+        Ret_Status = SCHED_KERNEL_NOT_SUPPORTED;
+    }
+    else
+    {
+        SCHED_CoreSetPeriod(ID, SCHED_KERNEL_MS_TO_TICKS(PeriodicityMs));
+    }
+    return Ret_Status;
+}
+
+SCHED_KernelStatus_t SCHED_KernelGetMissedReleases (const char* Name, uint32_t* MissedReleases)
+{
+    SCHED_KernelStatus_t Ret_Status = SCHED_KERNEL_INVALID_NAME;
+    uint32_t ID = 0;
+    if((Name == NULL) || (MissedReleases == NULL))
+    {
+        Ret_Status = SCHED_KERNEL_NULL_POINTER;
+    }
+    else
+    {
+        ID = SCHED_KernelFind(Name);
+        if(ID < SCHED_KernelRegistered)
+        {
+            *MissedReleases = SCHED_CoreGetMissedReleases(ID);
+            Ret_Status = SCHED_KERNEL_OK;
+        }
+    }
+    return Ret_Status;
+}
+
+#if (SCHED_KERNEL_SLEEP == SCHED_KERNEL_ENABLED)
+SCHED_KernelStatus_t SCHED_KernelSleep (uint32_t ID, uint32_t DelayMs)
+{
+    SCHED_KernelStatus_t Ret_Status = SCHED_KERNEL_OK;
+    uint32_t State = 0;
+    if(ID >= SCHED_KernelRegistered)
+    {
+        Ret_Status = SCHED_KERNEL_INVALID_ID;
+    }
+    else if(DelayMs == 0)
+    {
+        Ret_Status = SCHED_KERNEL_INVALID_PERIOD;
+    }
+    else if(SCHED_KERNEL_MODE == SCHED_KERNEL_MODE_TABLE)
+    {
+        /*the releases are fixed in the release table*/
+        Ret_Status = SCHED_KERNEL_NOT_SUPPORTED;
+    }
+    else
+    {
+        /*the dispatcher of the runnable class may preempt the caller*/
+        State = SCHED_CORE_ENTER_CRITICAL();
+        SCHED_KernelRunnables[ID].WakeRelease = SCHED_KernelTime[SCHED_KernelRunnables[ID].Class] + SCHED_KERNEL_MS_TO_TICKS(DelayMs);
+        SCHED_KernelRunnables[ID].Sleeping = 1;
+        /*a suspended runnable stays suspended, a runnable without periodicity that sleeps while it runs is out of the
+          queue, SCHED_KernelReleaseDue puts it back after the call*/
+        if(SCHED_CoreIsActive(ID))
+        {
+            SCHED_CoreSetRelease(ID, SCHED_KernelRunnables[ID].WakeRelease);
+        }
+        SCHED_CORE_EXIT_CRITICAL(State);
+    }
+    return Ret_Status;
+}
+#endif
+
+#if (SCHED_KERNEL_BUDGET == SCHED_KERNEL_ENABLED)
+void SCHED_KernelSetBudgetHook (SCHED_KernelBudgetHook_t Hook)
+{
+    SCHED_KernelBudgetHook = Hook;
+}
+
+SCHED_KernelStatus_t SCHED_KernelGetBudgetOverruns (const char* Name, uint32_t* Overruns)
+{
+    SCHED_KernelStatus_t Ret_Status = SCHED_KERNEL_INVALID_NAME;
+    uint32_t ID = 0;
+    if((Name == NULL) || (Overruns == NULL))
+    {
+        Ret_Status = SCHED_KERNEL_NULL_POINTER;
+    }
+    else
+    {
+        ID = SCHED_KernelFind(Name);
+        if(ID < SCHED_KernelRegistered)
+        {
+            *Overruns = SCHED_KernelRunnables[ID].BudgetOverruns;
+            Ret_Status = SCHED_KERNEL_OK;
+        }
+    }
+    return Ret_Status;
+}
+#endif
+
+#if (SCHED_KERNEL_SYNC == SCHED_KERNEL_SYNC_MASTER)
+void SCHED_KernelSetSyncHook (SCHED_KernelCallBack_t Hook)
+{
+    SCHED_KernelSyncHook = Hook;
+}
+#endif
+
+#if (SCHED_KERNEL_SYNC == SCHED_KERNEL_SYNC_SLAVE)
+void SCHED_KernelSync (void)
+{
+    int32_t Error = 0;
+    uint32_t State = SCHED_CORE_ENTER_CRITICAL();
+    /*the master sent the frame at its time 0 of the period, the shortest way to its time now is taken and it replaces
+      the correction that is not given yet*/
+    Error = (int32_t)((SCHED_KERNEL_SYNC_ARRIVAL_TICKS + SCHED_KERNEL_SYNC_PERIOD_TICKS - SCHED_KernelSyncTime) % SCHED_KERNEL_SYNC_PERIOD_TICKS);
+    if(Error > (int32_t)(SCHED_KERNEL_SYNC_PERIOD_TICKS / 2))
+    {
+        Error -= SCHED_KERNEL_SYNC_PERIOD_TICKS;
+    }
+    if((Error > SCHED_KERNEL_SYNC_DEADBAND_TICKS) || (Error < -SCHED_KERNEL_SYNC_DEADBAND_TICKS))
+    {
+        SCHED_KernelSyncCorrection = Error;
+    }
+    else
+    {
+        SCHED_KernelSyncCorrection = 0;
+    }
+    SCHED_CORE_EXIT_CRITICAL(State);
+}
+#endif
+
+#if (SCHED_KERNEL_STATS == SCHED_KERNEL_ENABLED)
+SCHED_KernelStatus_t SCHED_KernelGetRunnableStats (const char* Name, SCHED_KernelStats_t* Stats)
+{
+    SCHED_KernelStatus_t Ret_Status = SCHED_KERNEL_INVALID_NAME;
+    uint32_t ID = 0;
+    uint32_t State = 0;
+    if((Name == NULL) || (Stats == NULL))
+    {
+        Ret_Status = SCHED_KERNEL_NULL_POINTER;
+    }
+    else
+    {
+        ID = SCHED_KernelFind(Name);
+        if(ID < SCHED_KernelRegistered)
+        {
+            /*the stats of a preemptive runnable may change in the middle of the copy*/
+            State = SCHED_CORE_ENTER_CRITICAL();
+            *Stats = SCHED_KernelRunnables[ID].Stats;
+            SCHED_CORE_EXIT_CRITICAL(State);
+            if(Stats->Runs)
+            {
+                Stats->MeanExecCycles = (uint32_t)(SCHED_KernelRunnables[ID].TotalExecCycles / Stats->Runs);
+            }
+            Ret_Status = SCHED_KERNEL_OK;
+        }
+    }
+    return Ret_Status;
+}
+
+SCHED_KernelStatus_t SCHED_KernelGetClassLatency (uint32_t Class, uint32_t* MaxLatency)
+{
+    SCHED_KernelStatus_t Ret_Status = SCHED_KERNEL_OK;
+    if(MaxLatency == NULL)
+    {
+        Ret_Status = SCHED_KERNEL_NULL_POINTER;
+    }
+    else if(Class >= SCHED_KERNEL_CLASSES)
+    {
+        Ret_Status = SCHED_KERNEL_INVALID_CLASS;
+    }
+    else
+    {
+        *MaxLatency = SCHED_KernelClassMaxLatency[Class];
+    }
+    return Ret_Status;
+}
+#endif
+
+#if (SCHED_KERNEL_LOAD == SCHED_KERNEL_ENABLED)
+SCHED_KernelStatus_t SCHED_KernelGetLoad (uint32_t Window, SCHED_KernelLoad_t* Load)
+{
+    SCHED_KernelStatus_t Ret_Status = SCHED_KERNEL_OK;
+    uint32_t State = 0;
+    if(Load == NULL)
+    {
+        Ret_Status = SCHED_KERNEL_NULL_POINTER;
+    }
+    else if(Window >= _SCHED_KernelLoadWindowNumber)
+    {
+        Ret_Status = SCHED_KERNEL_INVALID_WINDOW;
+    }
+    else if(SCHED_KernelLoadReady[Window] == 0)
+    {
+        Ret_Status = SCHED_KERNEL_NOT_READY;
+    }
+    else
+    {
+        /*the systick may close the window in the middle of the copy*/
+        State = SCHED_CORE_ENTER_CRITICAL();
+        *Load = SCHED_KernelLastLoad[Window];
+        SCHED_CORE_EXIT_CRITICAL(State);
+    }
+    return Ret_Status;
+}
+#endif
@@ -0,0 +1,76 @@
+#ifndef _SCHED_CORE_CFG_H
+#define _SCHED_CORE_CFG_H
+
+/*configuration of COMMON/SCHED_CORE and COMMON/SCHED_KERNEL for MC1, the options are the ones of SERVICE/SCHED.h and
+  the systick is MCAL/SYSTICK*/
+#include <stdint.h>
+#include <MCAL/SYSTICK.h>
+#include <Service/SCHED.h>
+#include <Service/TRACE.h>
+#include "../../../COMMON/include/CPU.h"
+#if (SCHED_MODE == SCHED_MODE_TABLE)
+#include <Service/SCHED_TABLE.h>
+#endif
+
+/*--------------------------------------------SCHED_CORE---------------------------------------------*/
+#define SCHED_CORE_MAX_RUNNABLES            SCHED_MAX_RUNNABLES
+#define SCHED_CORE_CLASSES                  _SCHED_ClassNumber
+#define SCHED_CORE_QUEUE                    ((SCHED_QUEUE == SCHED_QUEUE_HEAP) ? SCHED_CORE_QUEUE_HEAP : SCHED_CORE_QUEUE_SCAN)
+
+#define SCHED_CORE_ENTER_CRITICAL()         CPU_EnterCritical()
+#define SCHED_CORE_EXIT_CRITICAL(State)     CPU_ExitCritical(State)
+
+/*--------------------------------------------SCHED_KERNEL-------------------------------------------*/
+#define SCHED_KERNEL_TICK_US                SCHED_TICK_US
+/*the DWT counts the core clock which also feeds the systick*/
+#define SCHED_KERNEL_CYCLES_PER_US          (CLOCK_FREQUENCY_AHB / 1000000)
+#define SCHED_KERNEL_MAX_SLEEP_MS           SCHED_MAX_SLEEP_MS
+
+#if (SCHED_MODE == SCHED_MODE_TICKLESS)
+#define SCHED_KERNEL_MODE                   SCHED_KERNEL_MODE_TICKLESS
+#elif (SCHED_MODE == SCHED_MODE_TABLE)
+#define SCHED_KERNEL_MODE                   SCHED_KERNEL_MODE_TABLE
+#define SCHED_KERNEL_TABLE                  SCHED_Table
+#define SCHED_KERNEL_TABLE_LENGTH           SCHED_TABLE_LENGTH
+#define SCHED_KERNEL_TABLE_PROLOGUE         SCHED_TABLE_PROLOGUE
+#define SCHED_KERNEL_TABLE_RUNNABLES        SCHED_TABLE_RUNNABLES
+#else
+#define SCHED_KERNEL_MODE                   SCHED_KERNEL_MODE_PERIODIC
+#endif
+
+#define SCHED_KERNEL_STATS                  ((SCHED_STATS == SCHED_STATS_ENABLED) ? SCHED_KERNEL_ENABLED : SCHED_KERNEL_DISABLED)
+#define SCHED_KERNEL_LOAD                   ((SCHED_LOAD == SCHED_LOAD_ENABLED) ? SCHED_KERNEL_ENABLED : SCHED_KERNEL_DISABLED)
+#define SCHED_KERNEL_LOAD_SHORT_WINDOW_MS   SCHED_LOAD_SHORT_WINDOW_MS
+#define SCHED_KERNEL_LOAD_LONG_WINDOW_MS    SCHED_LOAD_LONG_WINDOW_MS
+#define SCHED_KERNEL_BUDGET                 ((SCHED_BUDGET == SCHED_BUDGET_ENABLED) ? SCHED_KERNEL_ENABLED : SCHED_KERNEL_DISABLED)
+#define SCHED_KERNEL_BUDGET_STRIKES         SCHED_BUDGET_STRIKES
+#define SCHED_KERNEL_BUDGET_MAX_SLOWDOWN    SCHED_BUDGET_MAX_SLOWDOWN
+#define SCHED_KERNEL_BUDGET_RECOVERY_RUNS   SCHED_BUDGET_RECOVERY_RUNS
+/*SCHED_Sleep is an API of MC2 only*/
+#define SCHED_KERNEL_SLEEP                  SCHED_KERNEL_DISABLED
+#define SCHED_KERNEL_DEFER                  ((SCHED_DEFER == SCHED_DEFER_PREEMPTIVE) ? SCHED_KERNEL_DEFER_PREEMPTIVE : SCHED_KERNEL_DEFER_COOPERATIVE)
+#define SCHED_KERNEL_DEFER_QUEUE_SIZE       SCHED_DEFER_QUEUE_SIZE
+#define SCHED_KERNEL_SYNC                   ((SCHED_SYNC == SCHED_SYNC_MASTER) ? SCHED_KERNEL_SYNC_MASTER : SCHED_KERNEL_SYNC_DISABLED)
+#define SCHED_KERNEL_SYNC_PERIOD_MS         SCHED_SYNC_PERIOD_MS
+
+#define SCHED_KERNEL_TIMER_INIT(CallBack)   SCHED_TimerInit(CallBack)
+#define SCHED_KERNEL_TIMER_SET_US(Us)       STK_SetTimeUS(Us)
+#define SCHED_KERNEL_TIMER_START()          STK_Start(STK_MODE_PERIODIC)
+#define SCHED_KERNEL_PREEMPTIVE_INIT()      CPU_SetPendSVLowest()
+#define SCHED_KERNEL_PEND_PREEMPTIVE()      CPU_PendSV()
+#define SCHED_KERNEL_CYCLES_INIT()          CPU_StartCycleCounter()
+#define SCHED_KERNEL_CYCLES()               CPU_GetCycles()
+#define SCHED_KERNEL_IDLE_LOCK()            CPU_DisableInterrupts()
+#define SCHED_KERNEL_IDLE_WAIT()            CPU_WaitForInterrupt()
+#define SCHED_KERNEL_IDLE_UNLOCK()          CPU_EnableInterrupts()
+#define SCHED_KERNEL_TRACE(Type, ID, Arg)   TRACE_EVENT(TRACE_##Type, (ID), (Arg))
+#define SCHED_KERNEL_TRACE_PENDSV(Type)     TRACE_EVENT(TRACE_##Type, TRACE_ISR_PENDSV, 0)
+
+static inline void SCHED_TimerInit (systickcfg_t CallBack)
+{
+    STK_Init(SOURCE_AHB);
+    STK_SetCallback(CallBack);
+    STK_EnableInterrupt();
+}
+
+#endif
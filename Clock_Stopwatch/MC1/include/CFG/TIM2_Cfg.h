@@ -0,0 +1,4 @@
+# pragma once
+
+/*the clock of TIM2 (the APB1 timers clock), a multiple of 1 MHz as the timer counts microseconds*/
+#define CLOCK_FREQUENCY_TIM2                16000000
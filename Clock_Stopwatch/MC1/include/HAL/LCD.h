@@ -168,6 +168,15 @@
 #define LCD_FOUR_BITS_MODE		0
 #define	LCD_EIGHT_BITS_MODE		1
 
+#define LCD_BUSY_FLAG_TIMED		0
+#define	LCD_BUSY_FLAG_POLLING	1
+
+#define LCD_ENGINE_RUNNABLE		0
+#define	LCD_ENGINE_TIMER		1
+
+/* A glyph of the CGRAM is 8 rows of 5 dots, bit 4 of a row is its left dot */
+#define LCD_GLYPH_ROWS			8
+
 
 
 /************************************************************************************/
@@ -206,7 +215,15 @@ typedef enum
 	/**
 	 *@brief : If a problem happen when setting the value or the direction of one of the pin that the LCD is connected to.
 	 */
-	LCD_enuWrongPinConfiguration
+	LCD_enuWrongPinConfiguration,
+	/**
+	 *@brief : The requests queue is full, the request is not taken, send it again after one of the callbacks.
+	 */
+	LCD_enuBusy,
+	/**
+	 *@brief : All the blocks of the CGRAM hold glyphs drawn on the screen, the glyph is not drawn.
+	 */
+	LCD_enuNoFreeBlock
 
 }LCD_enuError_t;
 
@@ -424,6 +441,51 @@ LCD_enuError_t LCD_enuInitAsync(void (*callBackFn)(void));
 LCD_enuError_t LCD_enuGetState(uint8_t* State);
 
 
+/**
+ *@brief : Function that returns the number of requests the queue takes now, so a whole screen can be
+ *			sent in one go when there is room for all its requests.
+ *@param : pointer inside which We will return the number of free places in the requests queue.
+ *@return: Error State.
+ */
+LCD_enuError_t LCD_enuGetFreeRequests(uint8_t* FreeRequests);
+
+
+/**
+ *@brief : Function that draws a string in the shadow buffer of the screen, nothing is sent to the LCD
+ *			till LCD_enuFlushAsync, so a screen drawn by many calls is sent by one request.
+ *@param : The row and the column of the first character, and the string, the characters after the
+ *			last column of the shadow buffer (LCD_FRAME_COLUMNS) are not drawn.
+ *@return: Error State.
+ */
+LCD_enuError_t LCD_enuDrawString(LCD_enuRowNumber_t row, uint8_t column, uint8_t* string);
+
+
+/**
+ *@brief : Function that draws a custom glyph in the shadow buffer of the screen. The glyph takes one
+ *			of the 8 blocks of the CGRAM: the block that holds it already, or else the least recently
+ *			used block no cell of the screen shows. The next flush uploads the rows of the CGRAM that
+ *			changed before it writes the cells.
+ *@param : The row and the column of the cell, and the LCD_GLYPH_ROWS rows of the glyph.
+ *@return: Error State, LCD_enuNoFreeBlock when the screen shows 8 other glyphs.
+ */
+LCD_enuError_t LCD_enuDrawGlyph(LCD_enuRowNumber_t row, uint8_t column, const uint8_t* glyph);
+
+
+/**
+ *@brief : Function that draws a digit two rows tall in the shadow buffer, a 7-segment digit made of a
+ *			glyph for its upper half on the first row and a glyph for its lower half on the second row.
+ *			The halves are shared between digits (10 glyphs for the 10 digits), so 4 big digits fit in
+ *			the CGRAM, and drawing a digit that didn't change uploads and writes nothing.
+ *@param : The column of the digit and the digit, from 0 to 9.
+ *@return: Error State.
+ */
+LCD_enuError_t LCD_enuDrawBigDigit(uint8_t column, uint8_t digit);
+
+
+/* The Async functions below add their request to a queue of LCD_REQUEST_QUEUE_SIZE requests that
+ * the LCD serves in order, each request calls its own callback when it is finished. They return
+ * LCD_enuBusy when the queue is full and LCD_enuNotOk before LCD_enuInitAsync */
+
 /**
  *@brief : Function that clears the screen.
  *@param : a callback function you want to be called after finishing your request.
@@ -442,7 +504,8 @@ LCD_enuError_t LCD_enuSetCursorAsync(LCD_enuRowNumber_t row, uint8_t column, voi
 
 
 /**
- *@brief : Function that prints a string on the LCD.
+ *@brief : Function that prints a string on the LCD, the string is read when its turn comes so it must
+ *			stay unchanged till the callback.
  *@param : String you want to print, a callback function you want to be called after finishing
  *			your request.
  *@return: Error State.
@@ -465,4 +528,14 @@ LCD_enuError_t LCD_enuWriteNumberAsync(uint64_t Copy_uint64Number, void (callBac
 LCD_enuError_t LCD_enuSendCommandAsync(uint8_t Copy_uint8Command ,void (*callBackFn)(void));
 
 
+/**
+ *@brief : Function that writes to the LCD the cells of the shadow buffer that differ from what it shows,
+ *			the cursor is moved only to a changed cell that doesn't follow the last written one. The
+ *			driver follows what the other requests write, with the entry mode left at increment.
+ *@param : a callback function you want to be called after finishing your request.
+ *@return: Error State.
+ */
+LCD_enuError_t LCD_enuFlushAsync(void (*callBackFn)(void));
+
+
 #endif /* LCD_H_ */
@@ -84,5 +84,7 @@ typedef enum
 
 GPIO_ERROR_STATE GPIO_InitPin(GPIO_CONFIG_T * Config);
 GPIO_ERROR_STATE GPIO_SetPinValue(uint32_t GPIO_PORT, uint32_t GPIO_PIN, uint32_t PIN_STATE);
+/*Sets the pins of SET_MASK and resets the pins of RESET_MASK of one port with one write of BSRR, bit n for the pin n*/
+GPIO_ERROR_STATE GPIO_SetPortBits(uint32_t GPIO_PORT, uint32_t SET_MASK, uint32_t RESET_MASK);
 GPIO_ERROR_STATE GPIO_GetPinValue(uint32_t GPIO_PORT, uint32_t GPIO_PIN, uint8_t * PinValue);          
 
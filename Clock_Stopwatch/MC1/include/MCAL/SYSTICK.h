@@ -23,6 +23,8 @@ typedef enum
 
 STK_ERROR_STATE STK_Init(uint32_t SOURCE);
 STK_ERROR_STATE STK_SetTimeMS(uint32_t Time_Value);                     
+/*for the times below 1 ms, the AHB clock must be a multiple of 1 MHz (of 8 MHz with SOURCE_AHB_DIV_8)*/
+STK_ERROR_STATE STK_SetTimeUS(uint32_t Time_Value);
 void STK_EnableInterrupt();
 void STK_DisableInterrupt();
 STK_ERROR_STATE STK_Start(uint32_t STK_MODE);
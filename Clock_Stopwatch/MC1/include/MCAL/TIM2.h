@@ -0,0 +1,26 @@
+#pragma once
+
+#include <stdint.h>
+#include "CFG/TIM2_Cfg.h"
+
+/*the shortest one-shot time, the counter needs a reload of 1 at least*/
+#define TIM2_MIN_TIME_US                2
+
+
+typedef void (*tim2cfg_t)(void);
+
+typedef enum
+{
+    TIM2_ENUM_OK,
+    TIM2_ENUM_NOK,
+    TIM2_ENUM_NULL,
+    TIM2_ENUM_INVALID_TIME
+}TIM2_ERROR_STATE;
+
+
+/*TIM2 as a one-shot timer counting microseconds, the callback is called in the interrupt at the end of a time*/
+TIM2_ERROR_STATE TIM2_Init(tim2cfg_t Callback);
+/*a running time is restarted with the new one, the times go from TIM2_MIN_TIME_US (the counter is 32 bits)*/
+TIM2_ERROR_STATE TIM2_StartOneShotUS(uint32_t Time_Value);
+/*the callback of the running time isn't called*/
+void TIM2_Stop();
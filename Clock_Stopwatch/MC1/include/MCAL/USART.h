@@ -12,6 +12,13 @@
 #define PARITY_ODD					1
 #define PARITY_EVEN					0
 #define PARITY_NONE					3
+#define USART_CALLBACK_IN_ISR		0
+#define USART_CALLBACK_DEFERRED		1
+
+/*where the SEND and RECEIVE callbacks run, USART_CALLBACK_DEFERRED hands them to the scheduler by SCHED_Defer
+  so the interrupt only moves the bytes (it still calls a callback the full queue cannot take), USART_CALLBACK_IN_ISR
+  calls them inside the interrupt*/
+#define USART_CALLBACK				USART_CALLBACK_DEFERRED
 
 typedef enum
 {
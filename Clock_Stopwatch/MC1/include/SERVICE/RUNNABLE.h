@@ -16,6 +16,13 @@ enum
     _RunnableNumber                 //please dont change this and keep it the last value in enum
 }Runnables_enum;
 
+enum
+{
+    /*Write names of all events the ISRs post by SCHED_PostEvent (32 at most)*/
+    Button_Received_Event,
+    _EventNumber                    //please dont change this and keep it the last value in enum
+};
+
 
 
 
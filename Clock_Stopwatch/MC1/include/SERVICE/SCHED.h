@@ -8,20 +8,179 @@
 
 
 /********************************************************Defines:*************************************************/
-#define SCHED_TICK_TIME             1
+/*scheduler tick in us, 1000 or a divisor of it (500, 250, 100, ...) for the runnables faster than 1 ms,
+  the periods and delays stay in ms and are converted to ticks, every tick costs a systick interrupt*/
+#define SCHED_TICK_US               1000
+
+#define SCHED_MODE_PERIODIC         0           //systick fires every SCHED_TICK_US
+#define SCHED_MODE_TICKLESS         1           //systick fires only at the next runnable deadline
+#define SCHED_MODE_TABLE            2           //systick fires every SCHED_TICK_US, the releases come from SCHED_TABLE.c
+
+/*choose SCHED_MODE_PERIODIC, SCHED_MODE_TICKLESS or SCHED_MODE_TABLE.
+  SCHED_MODE_TABLE walks the table generated by tools/sched_table.py from Runnables_Arr (run it again after changing
+  the runnables), it has no release counters so the BacklogPolicy, SCHED_Register and SCHED_SetPeriod are not used*/
+#define SCHED_MODE                  SCHED_MODE_PERIODIC
+
+/*longest sleep in tickless mode, must fit the 24-bit systick reload (~1048 ms at 16 MHz)*/
+#define SCHED_MAX_SLEEP_MS          1000
+
+/*size of the runnables table, Runnables_Arr and the runnables added by SCHED_Register (254 at most)*/
+#define SCHED_MAX_RUNNABLES         16
+
+#define SCHED_QUEUE_HEAP            0           //min-heap of the next releases, a release costs O(log n)
+#define SCHED_QUEUE_SCAN            1           //list of the next releases walked at the ticks that release, O(n)
+
+/*choose SCHED_QUEUE_HEAP or SCHED_QUEUE_SCAN, how COMMON/SCHED_CORE keeps the next releases (not used in table mode).
+  tools/sched_bench (host cycles, see COMMON/include/SCHED_CORE.h for the build) shows the same mean tick for both up
+  to 20 runnables and a lower mean and worst tick for the scan at 100, so the heap is worth it only for long tables
+  of slow runnables*/
+#define SCHED_QUEUE                 SCHED_QUEUE_SCAN
+
+#define SCHED_STATS_DISABLED        0
+#define SCHED_STATS_ENABLED         1           //time every runnable with the DWT cycle counter
+
+/*choose SCHED_STATS_DISABLED or SCHED_STATS_ENABLED*/
+#define SCHED_STATS                 SCHED_STATS_DISABLED
+
+#define SCHED_LOAD_DISABLED         0
+#define SCHED_LOAD_ENABLED          1           //measure the busy and idle cycles with the DWT cycle counter
+
+/*choose SCHED_LOAD_DISABLED or SCHED_LOAD_ENABLED*/
+#define SCHED_LOAD                  SCHED_LOAD_DISABLED
+
+/*lengths of the two windows the load is measured over, 10 s is about 160M cycles at 16 MHz,
+  a window must stay below 2^32 cycles*/
+#define SCHED_LOAD_SHORT_WINDOW_MS  1000
+#define SCHED_LOAD_LONG_WINDOW_MS   10000
+
+#define SCHED_BUDGET_DISABLED       0
+#define SCHED_BUDGET_ENABLED        1           //time every call with the DWT cycle counter and check it against its BudgetUs
+
+/*choose SCHED_BUDGET_DISABLED or SCHED_BUDGET_ENABLED, the BudgetUs of Runnables_Arr are estimates to be checked
+  with SCHED_GetRunnableStats on the board before it is enabled*/
+#define SCHED_BUDGET                SCHED_BUDGET_DISABLED
+
+/*budget overruns in a row of a runnable that call the budget policy*/
+#define SCHED_BUDGET_STRIKES        3
+
+/*a slowed down runnable is called at 1 of 2, 4 ... up to 1 of this many of its periodic releases, a power of 2*/
+#define SCHED_BUDGET_MAX_SLOWDOWN   8
+
+/*calls in a row within the budget that halve the slowdown of a runnable, so 8 times slower comes back
+  in 3 x SCHED_BUDGET_RECOVERY_RUNS calls*/
+#define SCHED_BUDGET_RECOVERY_RUNS  10
+
+#define SCHED_DEFER_PREEMPTIVE      0           //run the deferred work in PendSV, right after the ISR that queued it
+#define SCHED_DEFER_COOPERATIVE     1           //run the deferred work in the super loop, between the cooperative runnables
+
+/*choose SCHED_DEFER_PREEMPTIVE or SCHED_DEFER_COOPERATIVE, the priority of the work the ISRs hand over by SCHED_Defer*/
+#define SCHED_DEFER                 SCHED_DEFER_PREEMPTIVE
+
+/*slots of the deferred work queue, a power of 2, SCHED_Defer fails while all of them are waiting*/
+#define SCHED_DEFER_QUEUE_SIZE      16
+
+#define SCHED_SYNC_DISABLED         0
+#define SCHED_SYNC_MASTER           1           //call the sync hook every SCHED_SYNC_PERIOD_MS, it sends the sync frame
+
+/*choose SCHED_SYNC_DISABLED or SCHED_SYNC_MASTER, MC2 as the slave aligns its scheduler time on the sync frames
+  so the runnables that exchange the button frames keep the slots of their DelayMs (Switch_Runner), the systick
+  of the master must fire every tick so the tickless mode cannot be used*/
+#define SCHED_SYNC                  SCHED_SYNC_DISABLED
+
+/*the sync hook is called at the scheduler times that are multiples of it, keep it equal to SCHED_SYNC_PERIOD_MS
+  of MC2 and a multiple of the periods of the runnables of the communication schedule*/
+#define SCHED_SYNC_PERIOD_MS        200
+
+
+#define SCHED_EVENT_MASK(Event)     (1UL << (Event))
 
 
 /********************************************************Types:***************************************************/
 typedef void (*CallBacK_Pointer_t) (void);
 
+/*work an ISR hands over to the scheduler by SCHED_Defer, Arg is given back to it*/
+typedef void (*SCHED_DeferredWork_t) (uint32_t Arg);
+
+/*what the scheduler does with the releases of a runnable that were missed while the scheduler was late*/
+typedef enum
+{
+    SCHED_BACKLOG_RUN_ALL,                      //call the runnable once for every missed release (default)
+    SCHED_BACKLOG_COALESCE,                     //call the runnable once for all the missed releases
+    SCHED_BACKLOG_SKIP                          //drop the late releases and wait for the next period
+}SCHED_BacklogPolicy_t;
+
+/*the preemptive runnables are dispatched from the PendSV handler, so they preempt the cooperative runnables
+  of the super loop, they must be short and never wait for a cooperative runnable*/
+typedef enum
+{
+    SCHED_CLASS_COOPERATIVE,                    //run to completion in the super loop (default)
+    SCHED_CLASS_PREEMPTIVE,                     //run to completion in PendSV, preempts the cooperative ones
+    _SCHED_ClassNumber                          //please dont change this and keep it the last value in enum
+}SCHED_Class_t;
+
 typedef struct
 {
     char* Name;                                 //name of runnable
     uint32_t DelayMs;                           //delay will apply before the first run
-    uint32_t Periodicity;                       //periodicity of your runnable
+    uint32_t Periodicity;                       //periodicity of your runnable (0 runs it once)
     CallBacK_Pointer_t CB;                      //pointer pointed on your runnable
+    SCHED_BacklogPolicy_t BacklogPolicy;        //what to do with the releases missed after an overrun
+    uint32_t Events;                            //events that release the runnable at once, SCHED_EVENT_MASK(Event) | ...
+    SCHED_Class_t Class;                        //priority class of the runnable
+    uint32_t PeriodicityUs;                     //periodicity in us of a runnable faster than 1 ms (a multiple of
+                                                //SCHED_TICK_US), it replaces Periodicity
+    uint32_t BudgetUs;                          //longest call in us before it is a budget overrun (0 has no budget), the
+                                                //systick, the preemptive runnables and the ISRs that call SCHED_EnterISR
+                                                //in the middle of the call are taken off
 }Runnable_t;
 
+#if (SCHED_BUDGET == SCHED_BUDGET_ENABLED)
+/*what the scheduler does with a runnable that overran its budget SCHED_BUDGET_STRIKES times in a row, the runnable
+  cannot be stopped in the middle of a call, so the policy protects the other runnables from its next calls*/
+typedef enum
+{
+    SCHED_BUDGET_KEEP,                          //keep calling it as it is
+    SCHED_BUDGET_SLOW_DOWN,                     //call it at half of the periodic releases it is called at now
+    SCHED_BUDGET_SUSPEND                        //stop dispatching it till SCHED_Resume
+}SCHED_BudgetAction_t;
+
+/*budget policy, it gets the ID of the runnable and the number of its budget overruns since the start*/
+typedef SCHED_BudgetAction_t (*SCHED_BudgetHook_t) (uint32_t RunnableID, uint32_t Overruns);
+#endif
+
+#if (SCHED_STATS == SCHED_STATS_ENABLED)
+/*all the values are in core clock cycles*/
+typedef struct
+{
+    uint32_t Runs;                              //number of calls of the runnable
+    uint32_t MinExecCycles;                     //shortest execution time
+    uint32_t MaxExecCycles;                     //longest execution time
+    uint32_t MeanExecCycles;                    //average execution time
+    uint32_t MinStartJitter;                    //shortest delay between the release time and the call
+    uint32_t MaxStartJitter;                    //longest delay between the release time and the call
+    uint32_t Overruns;                          //calls that took longer than the periodicity
+}SCHED_RunnableStats_t;
+#endif
+
+#if (SCHED_LOAD == SCHED_LOAD_ENABLED)
+typedef enum
+{
+    SCHED_LOAD_WINDOW_SHORT,                    //SCHED_LOAD_SHORT_WINDOW_MS
+    SCHED_LOAD_WINDOW_LONG,                     //SCHED_LOAD_LONG_WINDOW_MS
+    _SCHED_LoadWindowNumber                     //please dont change this and keep it the last value in enum
+}SCHED_LoadWindow_t;
+
+/*load of the last complete window, the cycles are core clock cycles and the utilisations are in 0.1 % (0 - 1000),
+  busy is the time in the dispatchers and the runnables of both classes, the other interrupts count as idle*/
+typedef struct
+{
+    uint32_t BusyCycles;                        //busy cycles of the window
+    uint32_t IdleCycles;                        //the rest of the window
+    uint32_t Utilisation;                       //busy share of the window
+    uint32_t PeakTickUtilisation;               //busy share of the busiest tick (systick interval in tickless mode)
+}SCHED_Load_t;
+#endif
+
 
 /********************************************************APIs:****************************************************/
 
@@ -34,9 +193,152 @@ void SCHED_Init (void);
 
 /**
  * @brief this function to start the schedular after initialize it.
+ *        in tickless mode the core sleeps (WFI) between runnable deadlines, the runnables are released
+ *        at the same timestamps as the periodic mode.
  * @param NoThing
  * @return NoThing 
  */
 void SCHED_Start (void);
 
+/**
+ * @brief post events from an ISR (or anywhere), every active runnable subscribed to one of them through its
+ *        Events mask is called at the next dispatch without waiting for its periodic release.
+ * @param Events : mask of the posted events, SCHED_EVENT_MASK(Event) | ...
+ * @return NoThing
+ */
+void SCHED_PostEvent (uint32_t Events);
+
+/**
+ * @brief mark the entry of an ISR, its time till SCHED_ExitISR is taken off the execution time of the runnable it
+ *        interrupted, for the budget and the statistics. The systick and PendSV are marked by the scheduler.
+ * @param NoThing
+ * @return uint32_t : the mark to give to SCHED_ExitISR
+ */
+uint32_t SCHED_EnterISR (void);
+
+/**
+ * @brief mark the exit of the ISR, call it last in the ISR.
+ * @param Mark : the value returned by SCHED_EnterISR
+ * @return NoThing
+ */
+void SCHED_ExitISR (uint32_t Mark);
+
+/**
+ * @brief queue a function from an ISR (or anywhere) instead of calling it there, the scheduler calls it at the
+ *        priority chosen by SCHED_DEFER in the order of the calls, it never masks the interrupts.
+ * @param Work : the function to call
+ * @param Arg : the value given to the function
+ * @return ErrorStatus_t : Ok, NullPointerError or NotOk if the queue is full (the work is dropped and counted)
+ */
+ErrorStatus_t SCHED_Defer (SCHED_DeferredWork_t Work, uint32_t Arg);
+
+/**
+ * @brief get the number of works dropped by SCHED_Defer because the queue was full, SCHED_DEFER_QUEUE_SIZE
+ *        must grow if it is not 0.
+ * @param Drops : pointer to the variable that will hold the count
+ * @return ErrorStatus_t : Ok or NullPointerError
+ */
+ErrorStatus_t SCHED_GetDeferDrops (uint32_t* Drops);
+
+/**
+ * @brief add a runnable to the scheduler at runtime, it is released first after its DelayMs from now.
+ * @param Runnable : pointer to the runnable, it is copied
+ * @param RunnableID : pointer to the variable that will hold the ID used by the other APIs
+ * @return ErrorStatus_t : Ok, NullPointerError, ArgumentError if the Class is wrong or NotOk if the table is full
+ *                         (always NotOk in table mode)
+ */
+ErrorStatus_t SCHED_Register (Runnable_t* Runnable, uint32_t* RunnableID);
+
+/**
+ * @brief stop dispatching a runnable till SCHED_Resume is called, it costs nothing while suspended.
+ * @param RunnableID : index in Runnables_Arr or the ID returned by SCHED_Register
+ * @return ErrorStatus_t : Ok or ArgumentError if the ID is not registered
+ */
+ErrorStatus_t SCHED_Suspend (uint32_t RunnableID);
+
+/**
+ * @brief dispatch a suspended runnable again, it keeps its phase so it is released at the first
+ *        DelayMs + n * Periodicity that is not in the past.
+ *        in tickless mode the release may wait till the end of the systick interval that is counting.
+ * @param RunnableID : index in Runnables_Arr or the ID returned by SCHED_Register
+ * @return ErrorStatus_t : Ok or ArgumentError if the ID is not registered or the runnable has no CB
+ */
+ErrorStatus_t SCHED_Resume (uint32_t RunnableID);
+
+/**
+ * @brief change the periodicity of a runnable, the new value applies after its next release.
+ * @param RunnableID : index in Runnables_Arr or the ID returned by SCHED_Register
+ * @param Periodicity : the new periodicity in ms, 0 is not allowed
+ * @return ErrorStatus_t : Ok, ArgumentError or NotOk in table mode
+ */
+ErrorStatus_t SCHED_SetPeriod (uint32_t RunnableID, uint32_t Periodicity);
+
+/**
+ * @brief get the number of releases of a runnable that were coalesced or skipped by its BacklogPolicy.
+ * @param Name : the Name of the runnable as written in Runnables_Arr
+ * @param MissedReleases : pointer to the variable that will hold the count
+ * @return ErrorStatus_t : Ok, NullPointerError or ArgumentError if no runnable has this name
+ */
+ErrorStatus_t SCHED_GetMissedReleases (const char* Name, uint32_t* MissedReleases);
+
+#if (SCHED_BUDGET == SCHED_BUDGET_ENABLED)
+/**
+ * @brief replace the default budget policy, the hook is called from the dispatcher of the runnable class right
+ *        after the call that made SCHED_BUDGET_STRIKES overruns in a row, NULL goes back to the default policy
+ *        (SCHED_BUDGET_SLOW_DOWN). A slowed down runnable comes back by halves after SCHED_BUDGET_RECOVERY_RUNS
+ *        calls in a row within its budget.
+ * @param Hook : the budget policy
+ * @return NoThing
+ */
+void SCHED_SetBudgetHook (SCHED_BudgetHook_t Hook);
+
+/**
+ * @brief get the number of calls of a runnable that took longer than its BudgetUs.
+ * @param Name : the Name of the runnable as written in Runnables_Arr
+ * @param Overruns : pointer to the variable that will hold the count
+ * @return ErrorStatus_t : Ok, NullPointerError or ArgumentError if no runnable has this name
+ */
+ErrorStatus_t SCHED_GetBudgetOverruns (const char* Name, uint32_t* Overruns);
+#endif
+
+#if (SCHED_SYNC == SCHED_SYNC_MASTER)
+/**
+ * @brief set the function that sends the sync frame to the other board, it is called from the systick
+ *        interrupt at every scheduler time that is a multiple of SCHED_SYNC_PERIOD_MS, so it must be short
+ *        (start an asynchronous send and return).
+ * @param Hook : the function that sends the sync frame, NULL stops the sync frames
+ * @return NoThing
+ */
+void SCHED_SetSyncHook (CallBacK_Pointer_t Hook);
+#endif
+
+#if (SCHED_STATS == SCHED_STATS_ENABLED)
+/**
+ * @brief get the execution time and start jitter statistics of a runnable.
+ * @param Name : the Name of the runnable as written in Runnables_Arr
+ * @param Stats : pointer to the struct that will be filled with the statistics
+ * @return ErrorStatus_t : Ok, NullPointerError or ArgumentError if no runnable has this name
+ */
+ErrorStatus_t SCHED_GetRunnableStats (const char* Name, SCHED_RunnableStats_t* Stats);
+
+/**
+ * @brief get the worst release latency of a class, the longest delay in core clock cycles between the
+ *        release time of any runnable of the class and its call.
+ * @param Class : SCHED_CLASS_COOPERATIVE or SCHED_CLASS_PREEMPTIVE
+ * @param MaxLatency : pointer to the variable that will hold the latency
+ * @return ErrorStatus_t : Ok, NullPointerError or ArgumentError
+ */
+ErrorStatus_t SCHED_GetClassLatency (SCHED_Class_t Class, uint32_t* MaxLatency);
+#endif
+
+#if (SCHED_LOAD == SCHED_LOAD_ENABLED)
+/**
+ * @brief get the CPU load measured over the last complete window, to show it on the LCD or send it over USART.
+ * @param Window : SCHED_LOAD_WINDOW_SHORT or SCHED_LOAD_WINDOW_LONG
+ * @param Load : pointer to the struct that will be filled with the load
+ * @return ErrorStatus_t : Ok, NullPointerError, ArgumentError or NotOk if no window is complete yet
+ */
+ErrorStatus_t SCHED_GetLoad (SCHED_LoadWindow_t Window, SCHED_Load_t* Load);
+#endif
+
 #endif
\ No newline at end of file
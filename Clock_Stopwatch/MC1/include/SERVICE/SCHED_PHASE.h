@@ -0,0 +1,14 @@
+/*generated by tools/sched_offsets.py from the WCETs in tools/mc1_wcet.txt, do not edit, run the tool again after changing
+  the runnables or their WCETs*/
+#ifndef _SCHED_PHASE_H
+#define _SCHED_PHASE_H
+
+
+/********************************************************Defines:*************************************************/
+/*extra first delay in ms of the runnables of src/SERVICE/Runnables.c, worst tick load 85 us with all the phases 0,
+  75 us with these ones*/
+#define SCHED_PHASE_Clock_Runner            0
+#define SCHED_PHASE_Stopwatch_Runner        0
+#define SCHED_PHASE_sw_runner               1
+
+#endif
@@ -0,0 +1,26 @@
+/*generated by tools/sched_table.py from src/SERVICE/Runnables.c, do not edit, run the tool again after changing the runnables*/
+#ifndef _SCHED_TABLE_H
+#define _SCHED_TABLE_H
+
+
+/********************************************************Includes:************************************************/
+#include <stdint.h>
+
+
+/********************************************************Defines:*************************************************/
+#define SCHED_TABLE_RUNNABLES       5           //number of runnables the table was generated for
+#define SCHED_TABLE_TICK_US         1000        //SCHED_TICK_US the table was generated for
+#define SCHED_TABLE_PROLOGUE        321         //ticks before the repeated part (first delays and one-shot runnables)
+#define SCHED_TABLE_LENGTH          521         //the prologue then one hyperperiod of 200 ticks
+#define SCHED_TABLE_PEAK_RELEASES   2           //most runnables released at a single tick
+
+
+/********************************************************Types:***************************************************/
+typedef uint8_t SCHED_TableEntry_t;
+
+
+/********************************************************Variables:***********************************************/
+/*bit n of entry t is set if the runnable with ID n is released at tick t*/
+extern const SCHED_TableEntry_t SCHED_Table [SCHED_TABLE_LENGTH];
+
+#endif
@@ -0,0 +1,113 @@
+#ifndef _TRACE_H
+#define _TRACE_H
+
+
+/********************************************************Includes:************************************************/
+#include <stdint.h>
+#include <ErrorStatus.h>
+
+
+/********************************************************Defines:*************************************************/
+#define TRACE_DISABLED              0
+#define TRACE_ENABLED               1           //record the events in a RAM ring stamped by the DWT cycle counter
+
+/*choose TRACE_DISABLED or TRACE_ENABLED, when disabled the TRACE_EVENT calls compile to nothing*/
+#define TRACE                       TRACE_DISABLED
+
+/*number of events kept in the ring (8 bytes each), a power of 2, the oldest events are overwritten*/
+#define TRACE_BUFFER_EVENTS         256
+
+/*channel of MCAL/USART.h that TRACE_Dump sends the ring on, USART1 is the link to the other board so it
+  must not be used, main initialises USART2 (PA2) at TRACE_USART_BAUDRATE when the trace is enabled*/
+#define TRACE_USART_CHANNEL         USART2
+#define TRACE_USART_BAUDRATE        115200
+
+/*period of the runnable main registers by SCHED_Register to call TRACE_Dump when the trace is enabled, a dump of the
+  whole ring takes about 180 ms at 115200 baud, the scheduler must not be in SCHED_MODE_TABLE (no SCHED_Register)*/
+#define TRACE_DUMP_PERIOD_MS        10000
+
+#if (TRACE == TRACE_ENABLED)
+#define TRACE_EVENT(Type, ID, Arg)  TRACE_Record((Type), (ID), (Arg))
+#else
+#define TRACE_EVENT(Type, ID, Arg)
+#endif
+
+
+/********************************************************Types:***************************************************/
+/*what an event marks, keep it in step with EVENT_TYPES of tools/trace_to_perfetto.py*/
+typedef enum
+{
+    TRACE_RUNNABLE_START,                       //ID: the runnable, Arg: 1 for a periodic release, 0 for an event
+    TRACE_RUNNABLE_END,                         //ID: the runnable
+    TRACE_DISPATCH_START,                       //ID: the class, one dispatch of the due releases of a tick
+    TRACE_DISPATCH_END,                         //ID: the class
+    TRACE_ISR_ENTRY,                            //ID: TRACE_ISR_t
+    TRACE_ISR_EXIT,                             //ID: TRACE_ISR_t
+    TRACE_REQUEST_START,                        //ID: TRACE_Driver_t, Arg: the request type (LCD) or the channel (USART)
+    TRACE_REQUEST_END                           //ID: TRACE_Driver_t, Arg: the same as the start
+}TRACE_EventType_t;
+
+typedef enum
+{
+    TRACE_ISR_SYSTICK,
+    TRACE_ISR_PENDSV,
+    TRACE_ISR_USART1,
+    TRACE_ISR_TIM2
+}TRACE_ISR_t;
+
+typedef enum
+{
+    TRACE_DRIVER_LCD,
+    TRACE_DRIVER_USART_TX,
+    TRACE_DRIVER_USART_RX
+}TRACE_Driver_t;
+
+/*one event of the ring and of the dump, in the little endian order of the core*/
+typedef struct
+{
+    uint32_t Timestamp;                         //DWT cycle counter
+    uint8_t Type;                               //TRACE_EventType_t
+    uint8_t ID;
+    uint16_t Arg;
+}TRACE_Event_t;
+
+/*sent before the events by TRACE_Dump*/
+typedef struct
+{
+    uint8_t Magic[4];                           //"TRC1"
+    uint32_t CyclesPerSecond;                   //core clock, to turn the timestamps into time
+    uint32_t Events;                            //number of events that follow, oldest first
+    uint32_t LostEvents;                        //older events overwritten since TRACE_Init
+}TRACE_DumpHeader_t;
+
+
+/********************************************************APIs:****************************************************/
+
+/**
+ * @brief start the DWT cycle counter and the recording, call it first in main so the requests of the
+ *        initialisation are recorded too.
+ * @param NoThing
+ * @return NoThing
+ */
+void TRACE_Init (void);
+
+/**
+ * @brief add an event to the ring, safe to call from an ISR, use TRACE_EVENT so it costs nothing when the
+ *        trace is disabled.
+ * @param Type : TRACE_EventType_t
+ * @param ID : the runnable, class, ISR or driver of the event
+ * @param Arg : extra value of the event
+ * @return NoThing
+ */
+void TRACE_Record (uint8_t Type, uint8_t ID, uint16_t Arg);
+
+/**
+ * @brief stop the recording and send the header then the events of the ring on TRACE_USART_CHANNEL,
+ *        the recording goes on after the last byte, tools/trace_to_perfetto.py converts the dump.
+ *        main calls it every TRACE_DUMP_PERIOD_MS from the trace_dump runnable.
+ * @param NoThing
+ * @return ErrorStatus_t : Ok or NotOk if a dump is being sent or the USART is busy
+ */
+ErrorStatus_t TRACE_Dump (void);
+
+#endif
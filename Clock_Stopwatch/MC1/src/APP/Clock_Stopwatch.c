@@ -1,4 +1,6 @@
 #include "Clock_Stopwatch.h"
+#include "Service/RUNNABLE.h"
+#include "Service/SCHED.h"
 /*******************************************************************************************************************/
 /*                                                 Global Variable                                                 */
 /*******************************************************************************************************************/
@@ -7,9 +9,6 @@ DateTime currentDateTime = {0, 0, 20, 4, 17, 4, 2024}; // Initialized to April 1
 DateTime previousDateTime = {0, 0, 0, 0, 0, 0, 0};     // Previous date and time, initially set to zero
 DateTime currentstopwatchTime = {0, 0, 0, 0, 0, 0, 0}; // Current time for the stopwatch, initially set to zero
 
-// Counter for controlling display switching between date and time
-uint8_t Date_Counter = 0;
-
 // Mode variable to control the operation mode (clock mode or stopwatch mode)
 uint8_t Mode = CLOCK_MODE;
 
@@ -56,39 +55,36 @@ void Clock_RunnerTask(void)
     // Check if the mode is CLOCK_MODE, command guard is COMMAND_DONE, and edit mode is OFF
     if (Mode == CLOCK_MODE && Command_Guard == COMMAND_DONE && Edit_Mode_Status == EDIT_MODE_OFF)
     {
-        // Check if Date_Counter is 0
-        if (Date_Counter == 0)
+        // Check if the seconds have changed since the last update
+        if (previousDateTime.seconds != currentDateTime.seconds)
         {
-            // Check if the seconds have changed since the last update
-            if (previousDateTime.seconds != currentDateTime.seconds)
-            {
-                // Format the current time and update the LCD asynchronously
-                formatTime(&currentDateTime, TimeStr);
-                LCD_enuWriteStringAsync(TimeStr, lcd_TimeStringdone);
+            // Draw the time on the first row and the date on the second row of the LCD's shadow buffer
+            formatTime(&currentDateTime, TimeStr);
+            formatDate(&currentDateTime, DateStr);
+            LCD_enuDrawString(0, 0, TimeStr);
+            LCD_enuDrawString(1, 0, DateStr);
 
+            // Send only the characters that changed, the guard is released when they are written
+            Command_Guard = COMMAND_IN_PROGRESS;
+            if (LCD_enuFlushAsync(lcd_ClockFlushdone) == LCD_enuOk)
+            {
                 // Update the previousDateTime to the currentDateTime
                 previousDateTime = currentDateTime;
-
-                // Increment Date_Counter to indicate the next update should show the date
-                Date_Counter++;
             }
-        }
-        else
-        {
-            // Format the current date and update the LCD asynchronously
-            formatDate(&currentDateTime, DateStr);
-            LCD_enuWriteStringAsync(DateStr, lcd_DateStringdone);
-
-            // Reset Date_Counter to switch back to showing the time
-            Date_Counter = 0;
+            else
+            {
+                // The LCD queue is full, try again in the next call
+                Command_Guard = COMMAND_DONE;
+            }
         }
     }
 }
 
 void Stopwatch_RunnerTask(void)
 {
-    uint8_t StopWatchTimeStr[43];
-    formatStopWatchTime(&currentstopwatchTime, StopWatchTimeStr);
+    // The LCD prints the string after this runnable returns, so it is not on the stack and it is
+    // only formatted when no write of it is in progress
+    static uint8_t StopWatchTimeStr[43];
     switch (Stopwatch_State)
     {
     case STOPWATCH_RESET:
@@ -99,6 +95,7 @@ void Stopwatch_RunnerTask(void)
         if (Mode == STOPWATCH_MODE && Command_Guard == COMMAND_DONE)
         {
             Command_Guard = COMMAND_IN_PROGRESS;
+            formatStopWatchTime(&currentstopwatchTime, StopWatchTimeStr);
             LCD_enuWriteStringAsync(StopWatchTimeStr, lcd_StopWatchTimeStringdone);
         }
         break;
@@ -108,6 +105,7 @@ void Stopwatch_RunnerTask(void)
         if (Mode == STOPWATCH_MODE && Command_Guard == COMMAND_DONE)
         {
             Command_Guard = COMMAND_IN_PROGRESS;
+            formatStopWatchTime(&currentstopwatchTime, StopWatchTimeStr);
             LCD_enuWriteStringAsync(StopWatchTimeStr, lcd_StopWatchTimeStringdone);
         }
         break;
@@ -116,6 +114,7 @@ void Stopwatch_RunnerTask(void)
         if (Mode == STOPWATCH_MODE && Command_Guard == COMMAND_DONE)
         {
             Command_Guard = COMMAND_IN_PROGRESS;
+            formatStopWatchTime(&currentstopwatchTime, StopWatchTimeStr);
             LCD_enuWriteStringAsync(StopWatchTimeStr, lcd_StopWatchTimeStringdone);
         }
         break;
@@ -598,24 +597,9 @@ void Lcd_CursorDone(void)
     Command_Guard = COMMAND_DONE;
 }
 
-void lcd_TimeStringdone(void)
+void lcd_ClockFlushdone(void)
 {
-    // Check if Date_Counter is 1
-    if (Date_Counter == 1)
-    {
-        // Set the cursor position to the second line (row 1) on the LCD
-        LCD_enuSetCursorAsync(1, 0, Lcd_CursorDone);
-    }
-    else
-    {
-        // Set the cursor position to the first line (row 0) on the LCD
-        LCD_enuSetCursorAsync(0, 0, Lcd_CursorDone);
-    }
-}
-
-void lcd_DateStringdone(void)
-{
-    LCD_enuSetCursorAsync(0, 0, Lcd_CursorDone);
+    Command_Guard = COMMAND_DONE;
 }
 
 void lcd_StopWatchTimeStringdone(void)
@@ -642,11 +626,20 @@ void recieve_callback()
 {
     Button_Received = rx_button_buff.Data;
     USART_ReceiveBuffer(&rx_button_buff);
+    /* Handle the button now instead of waiting for the next Switch_runnable period, with the sync
+       the frames of MC2 come right before its slot so no event is needed */
+#if (SCHED_SYNC == SCHED_SYNC_DISABLED)
+    SCHED_PostEvent(SCHED_EVENT_MASK(Button_Received_Event));
+#endif
+}
+
+void SyncFrame_Send(void)
+{
+    USART_SendByteAsynchronous(USART1, SYNC_FRAME);
 }
 
 void LCD_CleanDone(void)
 {
-    Date_Counter = 0;
     Command_Guard = COMMAND_DONE;
 }
 
@@ -664,7 +657,6 @@ void Lcd_EditCursorDone(void)
 void Lcd_EditOFFDone(void)
 {
     Command_Guard = COMMAND_IN_PROGRESS;
-    Date_Counter = 0;
     Edit_Cursor.X = CLOCK_CURSOR_START_X;
     Edit_Cursor.Y = CURSOR_AT_CLOCK_Y;
     LCD_enuSetCursorAsync(0, 0, Lcd_EditCursorDone);
@@ -41,6 +41,9 @@
 #define EDIT_BUTTON_STATE 6
 #define NO_BUTTON_PRESSED 0
 
+/*Frame sent to MC2 at the start of every sync period (SCHED_SYNC), its nibbles differ so it is never a button*/
+#define SYNC_FRAME 0x5A
+
 /*Define cursor positions for clock and date*/
 #define CLOCK_CURSOR_START_X 0
 #define CLOCK_CURSOR_END_X 7
@@ -135,22 +138,16 @@ void formatStopWatchTime(const DateTime *dateTime, char *buffer);
 
 /**
  * Task for updating the clock display.
- * It increments the current time, updates the LCD display with the time or date based on the mode and conditions.
+ * It increments the current time, draws the time and the date in the LCD's shadow buffer and flushes it when the
+ * seconds change in the clock mode.
  */
 void Clock_RunnerTask(void);
 
 /**
- * Callback function called when the time string for the clock is updated on the LCD.
- * It sets the cursor position on the LCD based on the Date_Counter variable.
- * If Date_Counter is 1, it sets the cursor to the second line (row 1), otherwise, it sets it to the first line (row 0).
- */
-void lcd_TimeStringdone(void);
-
-/**
- * Callback function called when the date string for the clock is updated on the LCD.
- * It sets the cursor position on the LCD to the first line (row 0).
+ * Callback function called when the LCD finishes flushing the time and date drawn by Clock_RunnerTask.
+ * It updates the Command_Guard variable to indicate that the command is done.
  */
-void lcd_DateStringdone(void);
+void lcd_ClockFlushdone(void);
 
 /**
  * Callback function called when the cursor operation is done.
@@ -196,9 +193,15 @@ void recieve_callback(void);
  */
 uint8_t DecodeFrame(uint8_t frame);
 
+/**
+ * Sync hook of the scheduler (SCHED_SetSyncHook), called from the systick interrupt at the start of every sync period.
+ * It starts sending SYNC_FRAME to MC2, a frame is skipped if a button frame is still being sent.
+ */
+void SyncFrame_Send(void);
+
 /**
  * Callback function called when the LCD screen is cleared.
- * It resets the Date_Counter and updates the Command_Guard variable to indicate that the command is done.
+ * It updates the Command_Guard variable to indicate that the command is done.
  */
 void LCD_CleanDone(void);
 100
@@ -5,6 +5,7 @@
 #include "HAL/LCD.h"
 #include "MCAL/RCC.h"
 #include "SERVICE/SCHED.h"
+#include "SERVICE/TRACE.h"
 #include "MCAL/NVIC.h"
 #include "STM32f401CC_peripherals_interrupt.h"
 
@@ -17,6 +18,7 @@ USART_RXBuffer rx_button_buff =
 	};
 
 extern void recieve_callback(void);
+extern void SyncFrame_Send(void);
 
 
 
@@ -26,9 +28,29 @@ void lcd_done(void)
 	USART_ReceiveBuffer(&rx_button_buff);
 }
 
+#if (TRACE == TRACE_ENABLED)
+/* Sends the ring on TRACE_USART_CHANNEL, a dump that is still being sent is not restarted */
+void trace_dump(void)
+{
+	(void)TRACE_Dump();
+}
+
+Runnable_t trace_dump_runnable =
+	{
+		.Name = "Trace_dump",
+		.DelayMs = TRACE_DUMP_PERIOD_MS,
+		.Periodicity = TRACE_DUMP_PERIOD_MS,
+		.CB = &trace_dump,
+		.BacklogPolicy = SCHED_BACKLOG_SKIP
+	};
+#endif
+
 
 int main()
 {
+#if (TRACE == TRACE_ENABLED)
+	TRACE_Init();
+#endif
 	RCC_Control_AHB1Peripherals(RCC_PERI_AHB1ENR_GPIOA,Status_Enable);
 	RCC_Control_AHB1Peripherals(RCC_PERI_AHB1ENR_GPIOC,Status_Enable);
 	RCC_Control_AHB1Peripherals(RCC_PERI_AHB1ENR_GPIOB,Status_Enable);
@@ -69,12 +91,44 @@ int main()
 	GPIO_InitPin(&TX_PIN);
 	GPIO_InitPin(&RX_PIN);
 
+#if (TRACE == TRACE_ENABLED)
+	/* The trace dump only sends, the interrupt options are the ones of USART1 because the driver
+	 * keeps one copy of them for all the channels */
+	USART_Config trace_usart_config = usart_config;
+	trace_usart_config.Channel = TRACE_USART_CHANNEL;
+	trace_usart_config.ReceiveEnable = DISABLE;
+	trace_usart_config.BaudRate = TRACE_USART_BAUDRATE;
+
+	GPIO_CONFIG_T TRACE_TX_PIN = 
+	{
+		.Mode = GPIO_MODE_AF_PP,
+		.Speed = GPIO_SPEED_HIGH,
+		.Port = GPIO_PORT_A,
+		.Pin = GPIO_PIN_2,
+		.Alternative = GPIO_ALTERNATIVE_USART1_2
+	};
+
+	RCC_Control_APB1Peripherals(RCC_PERI_APB1ENR_USART2,Status_Enable);
+	GPIO_InitPin(&TRACE_TX_PIN);
+#endif
+
 
 	LCD_enuInitAsync(lcd_done);	
 	Switch_init();
 	NVIC_EnableIRQ(USART1_IRQ);
 	USART_Init(&usart_config);
+#if (TRACE == TRACE_ENABLED)
+	NVIC_EnableIRQ(USART2_IRQ);
+	USART_Init(&trace_usart_config);
+#endif
 	SCHED_Init();
+#if (TRACE == TRACE_ENABLED)
+	uint32_t trace_dump_id = 0;
+	(void)SCHED_Register(&trace_dump_runnable, &trace_dump_id);
+#endif
+#if (SCHED_SYNC == SCHED_SYNC_MASTER)
+	SCHED_SetSyncHook(SyncFrame_Send);
+#endif
 	SCHED_Start();	
 
 	while (1)
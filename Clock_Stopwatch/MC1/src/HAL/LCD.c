@@ -23,7 +23,11 @@
 
 #include "MCAL/RCC.h"
 #include "MCAL/GPIO.h"
+#include "MCAL/TIM2.h"
 #include "HAL/LCD.h"
+#include "Service/RUNNABLE.h"
+#include "Service/SCHED.h"
+#include "Service/TRACE.h"
 #include "ErrorStatus.h"
 
 
@@ -36,6 +40,42 @@
 #else
 
 
+/* Check that the requests queue can hold at least one request and is counted by a byte */
+#if ((LCD_REQUEST_QUEUE_SIZE < 1) || (LCD_REQUEST_QUEUE_SIZE > 255))
+
+#error "INVALID LCD_REQUEST_QUEUE_SIZE is selected :(\nIt must be from 1 to 255"
+
+#endif
+
+/* Check that a row of the shadow buffer fits in the 40 characters of a row of the DDRAM */
+#if ((LCD_FRAME_COLUMNS < 1) || (LCD_FRAME_COLUMNS > 40))
+
+#error "INVALID LCD_FRAME_COLUMNS is selected :(\nIt must be from 1 to 40"
+
+#endif
+
+/* Check that the way of waiting for the LCD is one of the supported ones */
+#if ((LCD_BUSY_FLAG_MODE != LCD_BUSY_FLAG_TIMED) && (LCD_BUSY_FLAG_MODE != LCD_BUSY_FLAG_POLLING))
+
+#error "INVALID LCD_BUSY_FLAG_MODE is selected :(\nIt must be either LCD_BUSY_FLAG_TIMED or LCD_BUSY_FLAG_POLLING"
+
+#endif
+
+/* Check that the engine of the driver is one of the supported ones */
+#if ((LCD_ENGINE != LCD_ENGINE_RUNNABLE) && (LCD_ENGINE != LCD_ENGINE_TIMER))
+
+#error "INVALID LCD_ENGINE is selected :(\nIt must be either LCD_ENGINE_RUNNABLE or LCD_ENGINE_TIMER"
+
+#endif
+
+/* Check that a call of the LCD runnable ends before the next one */
+#if (LCD_STEP_BUDGET_US >= LCD_RUNNABLE_PERIOD_US)
+
+#error "INVALID LCD_STEP_BUDGET_US is selected :(\nIt must be under LCD_RUNNABLE_PERIOD_US"
+
+#endif
+
+
 /************************************************************************************/
 /*									extern Variables								*/
 /************************************************************************************/
@@ -62,6 +102,105 @@ extern LCD_strLCDPinConfig_t arrayofLCDPinConfig [7];
 #define REMAINING_STAGES_4_BIT_MODE_CASE		9
 #define REMAINING_STAGES_8_BIT_MODE_CASE		6
 
+/* Waits of the LCD in microseconds */
+#define LCD_POWER_ON_WAIT_US					30000
+#define LCD_INIT_COMMAND_WAIT_US				5000
+
+/* Execution times of a command, a character and a clear or a return home at the slowest oscillator of
+ * the LCD (190 kHz), the datasheet gives 37 us, 41 us and 1.52 ms at 270 kHz */
+#define LCD_COMMAND_EXECUTION_US				53
+#define LCD_DATA_EXECUTION_US					59
+#define LCD_CLEAR_DISPLAY_WAIT_US				2200
+
+/* Last command that takes the wait of a clear: clear display (0x01) and return home (0x02, 0x03) */
+#define LCD_LONG_COMMAND_LAST					0x03
+
+/* E keeps a level for 500 ns at least, so it is high for the 450 ns of the datasheet and rises once
+ * every 1000 ns at most, even when the stages of a write follow each other in one call */
+#define LCD_ENABLE_HOLD_NS						500
+
+/* Times in cycles of the cycle counter */
+#define LCD_US_TO_CYCLES(US)					((US) * LCD_CYCLES_PER_US)
+#define LCD_NS_TO_CYCLES(NS)					((((NS) * LCD_CYCLES_PER_US) + 999) / 1000)
+#define LCD_STEP_BUDGET_CYCLES					LCD_US_TO_CYCLES(LCD_STEP_BUDGET_US)
+
+/* Number of calls of the LCD runnable that cover a wait */
+#define LCD_CALLS(US)							(((US) + LCD_RUNNABLE_PERIOD_US - 1) / LCD_RUNNABLE_PERIOD_US)
+
+/* The DDRAM holds 40 characters per row, from 0x00 to 0x27 and from 0x40 to 0x67 */
+#define LCD_ROWS								2
+#define LCD_SECOND_ROW_ADDRESS					0x40
+#define LCD_ROW_LAST_ADDRESS					0x27
+#define LCD_ADDRESS_COLUMN_MASK					0x3F
+
+/* The address counter of the LCD isn't followed by the driver (after a shift or a CGRAM address) */
+#define LCD_ADDRESS_UNKNOWN						0xFF
+
+/* The first bit of the commands that the driver follows in the address counter */
+#define LCD_FUNCTION_SET_COMMAND				0x20
+#define LCD_SHIFT_COMMAND						0x10
+#define LCD_ENTRY_MODE_COMMAND					0x04
+
+/* The CGRAM holds 8 glyphs (blocks) of LCD_GLYPH_ROWS rows from 0x00 to 0x3F, the characters 0 to 7
+ * show them */
+#define LCD_CGRAM_BLOCKS						8
+#define LCD_CGRAM_ROWS							(LCD_CGRAM_BLOCKS * LCD_GLYPH_ROWS)
+#define LCD_GLYPH_DOTS_MASK						0x1F
+
+/* A row of the CGRAM the driver didn't write, the rows of a glyph have 5 bits */
+#define LCD_GLYPH_ROW_UNKNOWN					0xFF
+
+/* The rows of the CGRAM come first in the search of a flush, then the cells of the screen */
+#define LCD_FLUSH_ITEMS							(LCD_CGRAM_ROWS + (LCD_ROWS * LCD_FRAME_COLUMNS))
+
+/* The segments of a big digit: a, f, b and the middle bar g on the first row, e, c and d on the second */
+#define LCD_SEGMENT_A							0x01
+#define LCD_SEGMENT_B							0x02
+#define LCD_SEGMENT_C							0x04
+#define LCD_SEGMENT_D							0x08
+#define LCD_SEGMENT_E							0x10
+#define LCD_SEGMENT_F							0x20
+#define LCD_SEGMENT_G							0x40
+#define LCD_BIG_DIGITS							10
+
+/* The dots of a row of the glyph of a half of a big digit */
+#define LCD_GLYPH_LEFT_DOT						0x10
+#define LCD_GLYPH_RIGHT_DOT						0x01
+#define LCD_GLYPH_BAR							0x1F
+
+/* The pins the busy flag is read through, the LCD drives all the data pins while RW is high */
+#if (LCD_DATA_BITS_MODE == LCD_FOUR_BITS_MODE)
+#define LCD_FIRST_DATA_PIN						D4_4BITMODE
+#define LCD_LAST_DATA_PIN						D7_4BITMODE
+#define LCD_BUSY_FLAG_PIN						D7_4BITMODE
+#define LCD_RS_PIN								RS_4BITMODE
+#define LCD_RW_PIN								RW_4BITMODE
+#define LCD_E_PIN								E_4BITMODE
+
+#elif (LCD_DATA_BITS_MODE == LCD_EIGHT_BITS_MODE)
+#define LCD_FIRST_DATA_PIN						D0
+#define LCD_LAST_DATA_PIN						D7
+#define LCD_BUSY_FLAG_PIN						D7
+#define LCD_RS_PIN								RS
+#define LCD_RW_PIN								RW
+#define LCD_E_PIN								E
+
+#endif  /* #if (LCD_DATA_BITS_MODE == LCD_FOUR_BITS_MODE) */
+
+/* The stages of the first command of the initialization left after its first nibble */
+#define REMAINING_STAGES_SECOND_NIBBLE			3
+
+/* The data pins carry a nibble in the 4 bits mode and two nibbles in the 8 bits mode */
+#define LCD_DATA_PINS_NUMBER					(LCD_LAST_DATA_PIN - LCD_FIRST_DATA_PIN + 1)
+#define LCD_NIBBLE_BITS							4
+#define LCD_NIBBLE_VALUES						16
+#define LCD_BUS_NIBBLES							(LCD_DATA_PINS_NUMBER / LCD_NIBBLE_BITS)
+#define LCD_UPPER_NIBBLE(BYTE)					((BYTE) >> LCD_NIBBLE_BITS)
+#define LCD_LOWER_NIBBLE(BYTE)					((BYTE) & (LCD_NIBBLE_VALUES - 1))
+
+/* Request type of the initialization in the trace, it has no userReq.type */
+#define LCD_TRACE_INIT_REQUEST					0xFF
+
 #define Non 									99 /* */
 
 
@@ -73,6 +212,7 @@ extern LCD_strLCDPinConfig_t arrayofLCDPinConfig [7];
 typedef struct{
 	uint8_t* string;
 	uint64_t number;
+	void (*callBack)(void);
 	uint8_t command;
 	uint8_t state;
 	uint8_t type;
@@ -106,7 +246,8 @@ enum{
 	reqSetCursor,
 	reqWriteString,
 	reqWriteNumber,
-	reqWriteCommand
+	reqWriteCommand,
+	reqFlush
 };
 
 
@@ -118,19 +259,86 @@ enum{
 
 uint8_t lcdState = stateOff;
 
+/* The request the LCD is serving now, taken from the head of the queue */
 request_t userReq;
 
-process_t writeProc;
+/* The requests waiting for the LCD, a ring buffer served in the order they came, each request
+ * keeps its own callback */
+static request_t requestQueue[LCD_REQUEST_QUEUE_SIZE];
 
-process_t clearProc;
+static uint8_t queueHead = 0;
 
-process_t setCursorProc;
+static uint8_t queueCount = 0;
 
 process_t initProc;
 
-process_t writeNumProc;
+/* The screen the application draws by LCD_enuDrawString, a flush request sends the cells of it
+ * that differ from displayBuffer */
+static uint8_t frameBuffer[LCD_ROWS][LCD_FRAME_COLUMNS];
+
+/* What the DDRAM of the LCD holds, followed by every command and character the driver writes */
+static uint8_t displayBuffer[LCD_ROWS][LCD_FRAME_COLUMNS];
+
+/* The DDRAM address the next character is written at, the entry mode is taken as increment */
+static uint8_t lcdAddress = LCD_ADDRESS_UNKNOWN;
+
+/* The glyphs drawn by LCD_enuDrawGlyph in the blocks of the CGRAM, a flush request uploads the rows
+ * of them that differ from cgramDisplay before it writes the cells */
+static uint8_t cgramBuffer[LCD_CGRAM_BLOCKS][LCD_GLYPH_ROWS];
+
+/* What the CGRAM of the LCD holds, LCD_GLYPH_ROW_UNKNOWN for a row the driver didn't write */
+static uint8_t cgramDisplay[LCD_CGRAM_BLOCKS][LCD_GLYPH_ROWS];
+
+/* The last draw of the glyph of each block for the least recently used eviction, 0 for a block that
+ * holds no glyph */
+static uint32_t cgramLastUse[LCD_CGRAM_BLOCKS];
+static uint32_t cgramUseCounter = 0;
+
+/* The CGRAM address the next character is written at, LCD_ADDRESS_UNKNOWN while they go to the DDRAM */
+static uint8_t lcdCgramAddress = LCD_ADDRESS_UNKNOWN;
+
+/* The segments of the big digits from 0 to 9 */
+static const uint8_t bigDigitSegments[LCD_BIG_DIGITS] = {
+	LCD_SEGMENT_A | LCD_SEGMENT_B | LCD_SEGMENT_C | LCD_SEGMENT_D | LCD_SEGMENT_E | LCD_SEGMENT_F,
+	LCD_SEGMENT_B | LCD_SEGMENT_C,
+	LCD_SEGMENT_A | LCD_SEGMENT_B | LCD_SEGMENT_D | LCD_SEGMENT_E | LCD_SEGMENT_G,
+	LCD_SEGMENT_A | LCD_SEGMENT_B | LCD_SEGMENT_C | LCD_SEGMENT_D | LCD_SEGMENT_G,
+	LCD_SEGMENT_B | LCD_SEGMENT_C | LCD_SEGMENT_F | LCD_SEGMENT_G,
+	LCD_SEGMENT_A | LCD_SEGMENT_C | LCD_SEGMENT_D | LCD_SEGMENT_F | LCD_SEGMENT_G,
+	LCD_SEGMENT_A | LCD_SEGMENT_C | LCD_SEGMENT_D | LCD_SEGMENT_E | LCD_SEGMENT_F | LCD_SEGMENT_G,
+	LCD_SEGMENT_A | LCD_SEGMENT_B | LCD_SEGMENT_C,
+	LCD_SEGMENT_A | LCD_SEGMENT_B | LCD_SEGMENT_C | LCD_SEGMENT_D | LCD_SEGMENT_E | LCD_SEGMENT_F | LCD_SEGMENT_G,
+	LCD_SEGMENT_A | LCD_SEGMENT_B | LCD_SEGMENT_C | LCD_SEGMENT_D | LCD_SEGMENT_F | LCD_SEGMENT_G
+};
+
+/* 1 from the first stage to the last stage of a command or a data write, the busy flag is read
+ * between two writes only */
+static uint8_t lcdWriteInProgress = 0;
+
+/* The cycle count at the end of the last write and the cycles the LCD takes to execute it */
+static uint32_t lcdWriteEndCycles = 0;
+static uint32_t lcdExecutionCycles = 0;
+
+/* The cycle count at the last edge of E */
+static uint32_t lcdEnableCycles = 0;
+
+#if (LCD_ENGINE == LCD_ENGINE_TIMER)
 
-process_t sendCommandProc;
+/* The wait of the initialization the timer is started with after the current step */
+static uint32_t lcdTimerWaitUs = 0;
+
+/* 1 while the timer is stopped with no request to serve, a new request starts it */
+static uint8_t lcdTimerIdle = 1;
+
+#endif  /* #if (LCD_ENGINE == LCD_ENGINE_TIMER) */
+
+/* The data pins and RS written with one write of their port, prepared from the pins configuration
+ * by LCD_prepareBus: the set pins of every value of every nibble of the bus, lcdBusPinsMask is 0
+ * when the data pins are on different ports and lcdBusRsMask is 0 when RS isn't on their port */
+static uint32_t lcdBusPort = 0;
+static uint16_t lcdBusPinsMask = 0;
+static uint16_t lcdBusRsMask = 0;
+static uint16_t lcdBusNibbleMasks[LCD_BUS_NIBBLES][LCD_NIBBLE_VALUES];
 
 
 
@@ -142,6 +350,404 @@ process_t sendCommandProc;
 
 
 
+/**
+ *@brief : Function that adds a request at the tail of the queue and wakes up the LCD runnable (or timer).
+ *@param : The request, with its type, its data and its callback.
+ *@return: LCD_enuOk, LCD_enuBusy if the queue is full or LCD_enuNotOk if the LCD isn't initialized.
+ */
+static LCD_enuError_t LCD_enqueueRequest(const request_t* request){
+	LCD_enuError_t LOC_enuErrorStatus = LCD_enuOk;
+	uint32_t LOC_uint32Primask = LCD_ENTER_CRITICAL();
+
+	/* The requests that come while the LCD is being initialized wait in the queue till it is operational */
+	if(lcdState == stateOff){
+		LOC_enuErrorStatus = LCD_enuNotOk;
+	}
+	else if(queueCount == LCD_REQUEST_QUEUE_SIZE){
+		LOC_enuErrorStatus = LCD_enuBusy;
+	}
+	else{
+		requestQueue[(queueHead + queueCount) % LCD_REQUEST_QUEUE_SIZE] = *request;
+		queueCount++;
+
+#if (LCD_ENGINE == LCD_ENGINE_TIMER)
+		/* Start the timer if it stopped with nothing to do, the interrupts are masked so it can't
+		 * stop between the check and the start */
+		if(lcdTimerIdle == 1){
+			lcdTimerIdle = 0;
+			LCD_TIMER_START(LCD_TIMER_MIN_US);
+		}
+#endif  /* #if (LCD_ENGINE == LCD_ENGINE_TIMER) */
+	}
+
+	LCD_EXIT_CRITICAL(LOC_uint32Primask);
+
+#if (LCD_ENGINE == LCD_ENGINE_RUNNABLE)
+	if(LOC_enuErrorStatus == LCD_enuOk){
+		/* Wake up the LCD runnable to serve the request, nothing is done if it is awake */
+		SCHED_Resume(LCD_SCHED_RUNNABLE_ID);
+	}
+#endif  /* #if (LCD_ENGINE == LCD_ENGINE_RUNNABLE) */
+
+	return LOC_enuErrorStatus;
+}
+
+
+/**
+ *@brief : Function that takes the request at the head of the queue to be served, if there is one.
+ *@param : void.
+ *@return: void.
+ */
+static void LCD_takeRequest(void){
+	uint32_t LOC_uint32Primask = LCD_ENTER_CRITICAL();
+
+	if(queueCount > 0){
+		userReq = requestQueue[queueHead];
+		userReq.state = busyWithRequest;
+		queueHead = (queueHead + 1) % LCD_REQUEST_QUEUE_SIZE;
+		queueCount--;
+	}
+
+	LCD_EXIT_CRITICAL(LOC_uint32Primask);
+
+	if(userReq.state == busyWithRequest){
+		TRACE_EVENT(TRACE_REQUEST_START, TRACE_DRIVER_LCD, userReq.type);
+	}
+}
+
+
+/**
+ *@brief : Function that ends the request being served and calls its callback, the callback can
+ *		   send new requests.
+ *@param : void.
+ *@return: void.
+ */
+static void LCD_endRequest(void){
+	userReq.type = Non;
+	userReq.state = readyForRequest;
+	TRACE_EVENT(TRACE_REQUEST_END, TRACE_DRIVER_LCD, 0);
+	userReq.callBack();
+}
+
+
+/**
+ *@brief : Function that fills a screen buffer with spaces, as the LCD shows after a clear.
+ *@param : The buffer, frameBuffer or displayBuffer.
+ *@return: void.
+ */
+static void LCD_clearBuffer(uint8_t buffer[LCD_ROWS][LCD_FRAME_COLUMNS]){
+	uint8_t LOC_uint8Row;
+	uint8_t LOC_uint8Column;
+
+	for(LOC_uint8Row = 0; LOC_uint8Row < LCD_ROWS; LOC_uint8Row++){
+		for(LOC_uint8Column = 0; LOC_uint8Column < LCD_FRAME_COLUMNS; LOC_uint8Column++){
+			buffer[LOC_uint8Row][LOC_uint8Column] = ' ';
+		}
+	}
+}
+
+
+/**
+ *@brief : Function that follows a command written to the LCD in lcdAddress and displayBuffer.
+ *@param : The command.
+ *@return: void.
+ */
+static void LCD_trackCommand(uint8_t Copy_uint8Command){
+	if(Copy_uint8Command >= LCD_DDRAM_START_ADDRESS){
+		/* Set DDRAM address, an address out of the rows isn't followed */
+		lcdAddress = Copy_uint8Command - LCD_DDRAM_START_ADDRESS;
+		if((lcdAddress & LCD_ADDRESS_COLUMN_MASK) > LCD_ROW_LAST_ADDRESS){
+			lcdAddress = LCD_ADDRESS_UNKNOWN;
+		}
+		lcdCgramAddress = LCD_ADDRESS_UNKNOWN;
+	}
+	else if(Copy_uint8Command >= LCD_CGRAM_START_ADDRESS){
+		/* Set CGRAM address, the next characters go to the CGRAM */
+		lcdAddress = LCD_ADDRESS_UNKNOWN;
+		lcdCgramAddress = Copy_uint8Command - LCD_CGRAM_START_ADDRESS;
+	}
+	else if((Copy_uint8Command >= LCD_SHIFT_COMMAND) && (Copy_uint8Command < LCD_FUNCTION_SET_COMMAND)){
+		/* The cursor or the display is shifted */
+		lcdAddress = LCD_ADDRESS_UNKNOWN;
+		lcdCgramAddress = LCD_ADDRESS_UNKNOWN;
+	}
+	else if(Copy_uint8Command >= LCD_ENTRY_MODE_COMMAND){
+		/* Function set, display control and entry mode don't move the address counter */
+	}
+	else if(Copy_uint8Command >= LCD_ReturnHome){
+		lcdAddress = 0;
+		lcdCgramAddress = LCD_ADDRESS_UNKNOWN;
+	}
+	else if(Copy_uint8Command == LCD_ClearDisplay){
+		LCD_clearBuffer(displayBuffer);
+		lcdAddress = 0;
+		lcdCgramAddress = LCD_ADDRESS_UNKNOWN;
+	}
+	else{
+		/* Do Nothing */
+	}
+}
+
+
+/**
+ *@brief : Function that follows a character written to the DDRAM in displayBuffer and lcdAddress, or
+ *		   written to the CGRAM in cgramDisplay and lcdCgramAddress.
+ *@param : The character.
+ *@return: void.
+ */
+static void LCD_trackData(uint8_t Copy_uint8Data){
+	uint8_t LOC_uint8Column = lcdAddress & LCD_ADDRESS_COLUMN_MASK;
+
+	if(lcdAddress != LCD_ADDRESS_UNKNOWN){
+		if(LOC_uint8Column < LCD_FRAME_COLUMNS){
+			displayBuffer[lcdAddress / LCD_SECOND_ROW_ADDRESS][LOC_uint8Column] = Copy_uint8Data;
+		}
+
+		/* The address counter goes from the end of a row to the start of the other one */
+		if(LOC_uint8Column == LCD_ROW_LAST_ADDRESS){
+			lcdAddress = (lcdAddress < LCD_SECOND_ROW_ADDRESS) ? LCD_SECOND_ROW_ADDRESS : 0;
+		}
+		else{
+			lcdAddress++;
+		}
+	}
+	else if(lcdCgramAddress != LCD_ADDRESS_UNKNOWN){
+		cgramDisplay[lcdCgramAddress / LCD_GLYPH_ROWS][lcdCgramAddress % LCD_GLYPH_ROWS] = Copy_uint8Data & LCD_GLYPH_DOTS_MASK;
+		lcdCgramAddress = (lcdCgramAddress + 1) % LCD_CGRAM_ROWS;
+	}
+	else{
+		/* Do Nothing */
+	}
+}
+
+
+/**
+ *@brief : Function that forgets the glyphs of the CGRAM, its content is unknown after the power on.
+ *@param : void.
+ *@return: void.
+ */
+static void LCD_clearCgram(void){
+	uint8_t LOC_uint8Block;
+	uint8_t LOC_uint8Row;
+
+	for(LOC_uint8Block = 0; LOC_uint8Block < LCD_CGRAM_BLOCKS; LOC_uint8Block++){
+		for(LOC_uint8Row = 0; LOC_uint8Row < LCD_GLYPH_ROWS; LOC_uint8Row++){
+			cgramBuffer[LOC_uint8Block][LOC_uint8Row] = LCD_GLYPH_ROW_UNKNOWN;
+			cgramDisplay[LOC_uint8Block][LOC_uint8Row] = LCD_GLYPH_ROW_UNKNOWN;
+		}
+		cgramLastUse[LOC_uint8Block] = 0;
+	}
+}
+
+
+/**
+ *@brief : Function that looks for the block of the CGRAM that holds a glyph.
+ *@param : The rows of the glyph.
+ *@return: The block, LCD_CGRAM_BLOCKS if no block holds the glyph.
+ */
+static uint8_t LCD_findGlyphBlock(const uint8_t* glyph){
+	uint8_t LOC_uint8Block;
+	uint8_t LOC_uint8Row;
+	uint8_t LOC_uint8Found = LCD_CGRAM_BLOCKS;
+
+	for(LOC_uint8Block = 0; (LOC_uint8Block < LCD_CGRAM_BLOCKS) && (LOC_uint8Found == LCD_CGRAM_BLOCKS); LOC_uint8Block++){
+		if(cgramLastUse[LOC_uint8Block] != 0){
+			for(LOC_uint8Row = 0; LOC_uint8Row < LCD_GLYPH_ROWS; LOC_uint8Row++){
+				if(cgramBuffer[LOC_uint8Block][LOC_uint8Row] != (glyph[LOC_uint8Row] & LCD_GLYPH_DOTS_MASK)){
+					break;
+				}
+			}
+			if(LOC_uint8Row == LCD_GLYPH_ROWS){
+				LOC_uint8Found = LOC_uint8Block;
+			}
+		}
+	}
+
+	return LOC_uint8Found;
+}
+
+
+/**
+ *@brief : Function that chooses the block a new glyph is uploaded to: the least recently used block
+ *		   that no cell of the shadow buffer shows, a block that holds no glyph first. The cell the glyph
+ *		   is drawn at doesn't count as it is drawn over.
+ *@param : The row and the column of the cell the glyph is drawn at.
+ *@return: The block, LCD_CGRAM_BLOCKS if the other cells show all the blocks.
+ */
+static uint8_t LCD_evictGlyphBlock(uint8_t Copy_uint8Row, uint8_t Copy_uint8Column){
+	uint8_t LOC_uint8Row;
+	uint8_t LOC_uint8Column;
+	uint8_t LOC_uint8Block;
+	uint8_t LOC_uint8Shown = 0;
+	uint8_t LOC_uint8Chosen = LCD_CGRAM_BLOCKS;
+
+	for(LOC_uint8Row = 0; LOC_uint8Row < LCD_ROWS; LOC_uint8Row++){
+		for(LOC_uint8Column = 0; LOC_uint8Column < LCD_FRAME_COLUMNS; LOC_uint8Column++){
+			if((frameBuffer[LOC_uint8Row][LOC_uint8Column] < LCD_CGRAM_BLOCKS) &&
+					((LOC_uint8Row != Copy_uint8Row) || (LOC_uint8Column != Copy_uint8Column))){
+				LOC_uint8Shown |= (uint8_t)(1 << frameBuffer[LOC_uint8Row][LOC_uint8Column]);
+			}
+		}
+	}
+
+	for(LOC_uint8Block = 0; LOC_uint8Block < LCD_CGRAM_BLOCKS; LOC_uint8Block++){
+		if((((LOC_uint8Shown >> LOC_uint8Block) & 1) == 0) &&
+				((LOC_uint8Chosen == LCD_CGRAM_BLOCKS) || (cgramLastUse[LOC_uint8Block] < cgramLastUse[LOC_uint8Chosen]))){
+			LOC_uint8Chosen = LOC_uint8Block;
+		}
+	}
+
+	return LOC_uint8Chosen;
+}
+
+
+/**
+ *@brief : Function that makes the glyph of one half of a big digit, the sides of the half are dots on
+ *		   the left and the right of each row, its bars take the whole first or last row.
+ *@param : The segments of the digit, the row of the half and where the rows of the glyph are made.
+ *@return: void.
+ */
+static void LCD_makeBigDigitGlyph(uint8_t Copy_uint8Segments, uint8_t Copy_uint8Half, uint8_t glyph[LCD_GLYPH_ROWS]){
+	uint8_t LOC_uint8Row;
+	uint8_t LOC_uint8Sides = 0;
+	uint8_t LOC_uint8TopBar;
+	uint8_t LOC_uint8BottomBar;
+
+	if(Copy_uint8Half == LCD_enuFirstRow){
+		LOC_uint8Sides |= (Copy_uint8Segments & LCD_SEGMENT_F) ? LCD_GLYPH_LEFT_DOT : 0;
+		LOC_uint8Sides |= (Copy_uint8Segments & LCD_SEGMENT_B) ? LCD_GLYPH_RIGHT_DOT : 0;
+		LOC_uint8TopBar = Copy_uint8Segments & LCD_SEGMENT_A;
+		LOC_uint8BottomBar = Copy_uint8Segments & LCD_SEGMENT_G;
+	}
+	else{
+		LOC_uint8Sides |= (Copy_uint8Segments & LCD_SEGMENT_E) ? LCD_GLYPH_LEFT_DOT : 0;
+		LOC_uint8Sides |= (Copy_uint8Segments & LCD_SEGMENT_C) ? LCD_GLYPH_RIGHT_DOT : 0;
+		LOC_uint8TopBar = 0;
+		LOC_uint8BottomBar = Copy_uint8Segments & LCD_SEGMENT_D;
+	}
+
+	for(LOC_uint8Row = 0; LOC_uint8Row < LCD_GLYPH_ROWS; LOC_uint8Row++){
+		glyph[LOC_uint8Row] = LOC_uint8Sides;
+	}
+	if(LOC_uint8TopBar != 0){
+		glyph[0] = LCD_GLYPH_BAR;
+	}
+	if(LOC_uint8BottomBar != 0){
+		glyph[LCD_GLYPH_ROWS - 1] = LCD_GLYPH_BAR;
+	}
+}
+
+
+/**
+ *@brief : Function that looks at the pins configuration, when the data pins are on one port it
+ *		   prepares the pins to set on that port for every value of every nibble so a nibble or a
+ *		   byte goes out with RS in one write of the port.
+ *@param : void.
+ *@return: void.
+ */
+static void LCD_prepareBus(void){
+	uint8_t LOC_uint8Pin;
+	uint8_t LOC_uint8Nibble;
+	uint8_t LOC_uint8Value;
+	uint8_t LOC_uint8Bit;
+	uint8_t LOC_uint8SinglePort = 1;
+	uint16_t LOC_uint16SetMask;
+
+	lcdBusPort = arrayofLCDPinConfig[LCD_FIRST_DATA_PIN].LCD_port_number;
+	lcdBusPinsMask = 0;
+	lcdBusRsMask = 0;
+
+	for(LOC_uint8Pin = LCD_FIRST_DATA_PIN; LOC_uint8Pin <= LCD_LAST_DATA_PIN; LOC_uint8Pin++){
+		if(arrayofLCDPinConfig[LOC_uint8Pin].LCD_port_number != lcdBusPort){
+			LOC_uint8SinglePort = 0;
+		}
+	}
+
+	if(LOC_uint8SinglePort == 1){
+		for(LOC_uint8Nibble = 0; LOC_uint8Nibble < LCD_BUS_NIBBLES; LOC_uint8Nibble++){
+			for(LOC_uint8Value = 0; LOC_uint8Value < LCD_NIBBLE_VALUES; LOC_uint8Value++){
+				LOC_uint16SetMask = 0;
+				for(LOC_uint8Bit = 0; LOC_uint8Bit < LCD_NIBBLE_BITS; LOC_uint8Bit++){
+					if((LOC_uint8Value >> LOC_uint8Bit) & 1){
+						LOC_uint8Pin = LCD_FIRST_DATA_PIN + (LOC_uint8Nibble * LCD_NIBBLE_BITS) + LOC_uint8Bit;
+						LOC_uint16SetMask |= (uint16_t)(1 << arrayofLCDPinConfig[LOC_uint8Pin].LCD_pin_number);
+					}
+				}
+				lcdBusNibbleMasks[LOC_uint8Nibble][LOC_uint8Value] = LOC_uint16SetMask;
+			}
+			lcdBusPinsMask |= lcdBusNibbleMasks[LOC_uint8Nibble][LCD_NIBBLE_VALUES - 1];
+		}
+
+		if(arrayofLCDPinConfig[LCD_RS_PIN].LCD_port_number == lcdBusPort){
+			lcdBusRsMask = (uint16_t)(1 << arrayofLCDPinConfig[LCD_RS_PIN].LCD_pin_number);
+		}
+	}
+}
+
+
+/**
+ *@brief : Function that puts a value on the data pins, a nibble on D4..D7 in the 4 bits mode and a
+ *		   byte on D0..D7 in the 8 bits mode. With the data pins on one port the value and RS go out
+ *		   in one write of the port, otherwise each data pin is written alone and RS is written by
+ *		   the first stage of the write.
+ *@param : The level of RS (command or data) and the value.
+ *@return: void.
+ */
+static void LCD_writeBus(uint8_t Copy_uint8RsLevel, uint8_t Copy_uint8Value){
+	uint16_t LOC_uint16SetMask;
+	uint8_t LOC_uint8Pin;
+
+	if(lcdBusPinsMask != 0){
+		LOC_uint16SetMask = lcdBusNibbleMasks[0][LCD_LOWER_NIBBLE(Copy_uint8Value)];
+
+#if (LCD_DATA_BITS_MODE == LCD_EIGHT_BITS_MODE)
+		LOC_uint16SetMask |= lcdBusNibbleMasks[1][LCD_UPPER_NIBBLE(Copy_uint8Value)];
+
+#endif  /* #if (LCD_DATA_BITS_MODE == LCD_EIGHT_BITS_MODE) */
+
+		if(Copy_uint8RsLevel == PIN_STATE_HIGH){
+			LOC_uint16SetMask |= lcdBusRsMask;
+		}
+		GPIO_SetPortBits(lcdBusPort, LOC_uint16SetMask, (lcdBusPinsMask | lcdBusRsMask) & ~LOC_uint16SetMask);
+	}
+	else{
+		for(LOC_uint8Pin = LCD_FIRST_DATA_PIN; LOC_uint8Pin <= LCD_LAST_DATA_PIN; LOC_uint8Pin++){
+			GPIO_SetPinValue(arrayofLCDPinConfig[LOC_uint8Pin].LCD_port_number,\
+					arrayofLCDPinConfig[LOC_uint8Pin].LCD_pin_number,\
+					((Copy_uint8Value >> (LOC_uint8Pin - LCD_FIRST_DATA_PIN)) & 1));
+		}
+	}
+}
+
+
+/**
+ *@brief : Function that sets the level of the E pin once it kept its last level for LCD_ENABLE_HOLD_NS.
+ *@param : The level.
+ *@return: void.
+ */
+static void LCD_setEnable(uint8_t Copy_uint8Level){
+	while((LCD_GET_CYCLES() - lcdEnableCycles) < LCD_NS_TO_CYCLES(LCD_ENABLE_HOLD_NS)){
+		/* Wait */
+	}
+	GPIO_SetPinValue(arrayofLCDPinConfig[LCD_E_PIN].LCD_port_number,\
+			arrayofLCDPinConfig[LCD_E_PIN].LCD_pin_number,\
+			Copy_uint8Level);
+	lcdEnableCycles = LCD_GET_CYCLES();
+}
+
+
+/**
+ *@brief : Function called at the last stage of a write, the LCD executes it from now.
+ *@param : The execution time of the write in microseconds.
+ *@return: void.
+ */
+static void LCD_endWrite(uint32_t Copy_uint32ExecutionUs){
+	lcdWriteEndCycles = LCD_GET_CYCLES();
+	lcdExecutionCycles = LCD_US_TO_CYCLES(Copy_uint32ExecutionUs);
+	lcdWriteInProgress = 0;
+}
+
+
 /**
  *@brief : Process that writes a command on the data bus.
  *@param : A command.
@@ -153,22 +759,26 @@ static void LCD_writeCommandSM(uint8_t Copy_uint8Command){
 
 	switch(entryCounter){
 
-	/* Set the value of RS pin as output low as we are sending a command */
+	/* Set the value of RS pin as output low as we are sending a command, it goes out with the
+	 * data when it shares their port */
 	case 1:
-		GPIO_SetPinValue(arrayofLCDPinConfig[RS_4BITMODE].LCD_port_number,\
-				arrayofLCDPinConfig[RS_4BITMODE].LCD_pin_number,\
-				PIN_STATE_LOW);
+		lcdWriteInProgress = 1;
+		if(lcdBusRsMask == 0){
+			GPIO_SetPinValue(arrayofLCDPinConfig[LCD_RS_PIN].LCD_port_number,\
+					arrayofLCDPinConfig[LCD_RS_PIN].LCD_pin_number,\
+					PIN_STATE_LOW);
+		}
 		break;
 		/* Set the value of R/w pin as output low as we are writing */
 	case 2:
-		GPIO_SetPinValue(arrayofLCDPinConfig[RW_4BITMODE].LCD_port_number,\
-				arrayofLCDPinConfig[RW_4BITMODE].LCD_pin_number,\
+		GPIO_SetPinValue(arrayofLCDPinConfig[LCD_RW_PIN].LCD_port_number,\
+				arrayofLCDPinConfig[LCD_RW_PIN].LCD_pin_number,\
 				PIN_STATE_LOW);
 		break;
 		/* Set the value of the E pin to be output low to make pulse on it later once we
 		 * put the data on the data pins */
 	case 3:
-		GPIO_SetPinValue(arrayofLCDPinConfig[E_4BITMODE].LCD_port_number,arrayofLCDPinConfig[E_4BITMODE].LCD_pin_number,PIN_STATE_LOW);
+		GPIO_SetPinValue(arrayofLCDPinConfig[LCD_E_PIN].LCD_port_number,arrayofLCDPinConfig[LCD_E_PIN].LCD_pin_number,PIN_STATE_LOW);
 		break;
 		
 
@@ -176,60 +786,32 @@ static void LCD_writeCommandSM(uint8_t Copy_uint8Command){
 
 		/* Putting the upper 4-bits data on the data pins of the LCD */
 	case 4:
-		GPIO_SetPinValue(arrayofLCDPinConfig[D7_4BITMODE].LCD_port_number,\
-				arrayofLCDPinConfig[D7_4BITMODE].LCD_pin_number,\
-				( ( Copy_uint8Command & (1<<D7) ) >> D7 ));
-		GPIO_SetPinValue(arrayofLCDPinConfig[D6_4BITMODE].LCD_port_number,\
-				arrayofLCDPinConfig[D6_4BITMODE].LCD_pin_number,\
-				( ( Copy_uint8Command & (1<<D6) ) >> D6 ));
-		GPIO_SetPinValue(arrayofLCDPinConfig[D5_4BITMODE].LCD_port_number,\
-				arrayofLCDPinConfig[D5_4BITMODE].LCD_pin_number,\
-				( ( Copy_uint8Command & (1<<D5) ) >> D5 ));
-		GPIO_SetPinValue(arrayofLCDPinConfig[D4_4BITMODE].LCD_port_number,\
-				arrayofLCDPinConfig[D4_4BITMODE].LCD_pin_number,\
-				( ( Copy_uint8Command & (1<<D4) ) >> D4 ));
+		LCD_writeBus(PIN_STATE_LOW, LCD_UPPER_NIBBLE(Copy_uint8Command));
 		break;
 		/* Send a pulse to the E pin to send the data to the LCD */
 		/* Set the value of the E pin to be output high */
 	case 5:
-		GPIO_SetPinValue(arrayofLCDPinConfig[E_4BITMODE].LCD_port_number,\
-				arrayofLCDPinConfig[E_4BITMODE].LCD_pin_number,\
-				PIN_STATE_HIGH);
+		LCD_setEnable(PIN_STATE_HIGH);
 		break;
 		/* Set the value of the E pin to be output low */
 	case 6:
-		GPIO_SetPinValue(arrayofLCDPinConfig[E_4BITMODE].LCD_port_number,\
-				arrayofLCDPinConfig[E_4BITMODE].LCD_pin_number,\
-				PIN_STATE_LOW);
+		LCD_setEnable(PIN_STATE_LOW);
 		break;
 		/* Putting the lower 4-bits data on the data pins of the LCD */
 	case 7:
-		GPIO_SetPinValue(arrayofLCDPinConfig[D7_4BITMODE].LCD_port_number,\
-				arrayofLCDPinConfig[D7_4BITMODE].LCD_pin_number,\
-				( ( Copy_uint8Command & (1<<D3) ) >> D3 ));
-		GPIO_SetPinValue(arrayofLCDPinConfig[D6_4BITMODE].LCD_port_number,\
-				arrayofLCDPinConfig[D6_4BITMODE].LCD_pin_number,\
-				( ( Copy_uint8Command & (1<<D2) ) >> D2 ));
-		GPIO_SetPinValue(arrayofLCDPinConfig[D5_4BITMODE].LCD_port_number,\
-				arrayofLCDPinConfig[D5_4BITMODE].LCD_pin_number,\
-				( ( Copy_uint8Command & (1<<D1) ) >> D1 ));
-		GPIO_SetPinValue(arrayofLCDPinConfig[D4_4BITMODE].LCD_port_number,\
-				arrayofLCDPinConfig[D4_4BITMODE].LCD_pin_number,\
-				( ( Copy_uint8Command & (1<<D0) ) >> D0 ));
+		LCD_writeBus(PIN_STATE_LOW, LCD_LOWER_NIBBLE(Copy_uint8Command));
 		break;
 		/* Send a pulse to the E pin to send the data to the LCD */
 		/* Set the value of the E pin to be output high */
 	case 8:
-		GPIO_SetPinValue(arrayofLCDPinConfig[E_4BITMODE].LCD_port_number,\
-				arrayofLCDPinConfig[E_4BITMODE].LCD_pin_number,\
-				PIN_STATE_HIGH);
+		LCD_setEnable(PIN_STATE_HIGH);
 		break;
 		/* Set the value of the E pin to be output low */
 	case 9:
-		GPIO_SetPinValue(arrayofLCDPinConfig[E_4BITMODE].LCD_port_number,\
-				arrayofLCDPinConfig[E_4BITMODE].LCD_pin_number,\
-				PIN_STATE_LOW);
+		LCD_setEnable(PIN_STATE_LOW);
 
+		LCD_trackCommand(Copy_uint8Command);
+		LCD_endWrite((Copy_uint8Command <= LCD_LONG_COMMAND_LAST) ? LCD_CLEAR_DISPLAY_WAIT_US : LCD_COMMAND_EXECUTION_US);
 		entryCounter = 0;
 		break;
 
@@ -238,44 +820,19 @@ static void LCD_writeCommandSM(uint8_t Copy_uint8Command){
 
 		/* Putting the data on the data pins of the LCD */
 	case 4:
-		GPIO_SetPinValue(arrayofLCDPinConfig[D7].LCD_port_number,\
-				arrayofLCDPinConfig[D7].LCD_pin_number,\
-				( ( Copy_uint8Command & (1<<D7) ) >> D7 ));
-		GPIO_SetPinValue(arrayofLCDPinConfig[D6].LCD_port_number,\
-				arrayofLCDPinConfig[D6].LCD_pin_number,\
-				( ( Copy_uint8Command & (1<<D6) ) >> D6 ));
-		GPIO_SetPinValue(arrayofLCDPinConfig[D5].LCD_port_number,\
-				arrayofLCDPinConfig[D5].LCD_pin_number,\
-				( ( Copy_uint8Command & (1<<D5) ) >> D5 ));
-		GPIO_SetPinValue(arrayofLCDPinConfig[D4].LCD_port_number,\
-				arrayofLCDPinConfig[D4].LCD_pin_number,\
-				( ( Copy_uint8Command & (1<<D4) ) >> D4 ));
-		GPIO_SetPinValue(arrayofLCDPinConfig[D3].LCD_port_number,\
-				arrayofLCDPinConfig[D3].LCD_pin_number,\
-				( ( Copy_uint8Command & (1<<D3) ) >> D3 ));
-		GPIO_SetPinValue(arrayofLCDPinConfig[D2].LCD_port_number,\
-				arrayofLCDPinConfig[D2].LCD_pin_number,\
-				( ( Copy_uint8Command & (1<<D2) ) >> D2 ));
-		GPIO_SetPinValue(arrayofLCDPinConfig[D1].LCD_port_number,\
-				arrayofLCDPinConfig[D1].LCD_pin_number,\
-				( ( Copy_uint8Command & (1<<D1) ) >> D1 ));
-		GPIO_SetPinValue(arrayofLCDPinConfig[D0].LCD_port_number,\
-				arrayofLCDPinConfig[D0].LCD_pin_number,\
-				( ( Copy_uint8Command & (1<<D0) ) >> D0 ));
+		LCD_writeBus(PIN_STATE_LOW, Copy_uint8Command);
 		break;
 		/* Send a pulse to the E pin to send the data to the LCD */
 		/* Set the value of the E pin to be output high */
 	case 5:
-		GPIO_SetPinValue(arrayofLCDPinConfig[E_4BITMODE].LCD_port_number,\
-				arrayofLCDPinConfig[E_4BITMODE].LCD_pin_number,\
-				PIN_STATE_HIGH);
+		LCD_setEnable(PIN_STATE_HIGH);
 		break;
 		/* Set the value of the E pin to be output low */
 	case 6:
-		GPIO_SetPinValue(arrayofLCDPinConfig[E_4BITMODE].LCD_port_number,\
-				arrayofLCDPinConfig[E_4BITMODE].LCD_pin_number,\
-				PIN_STATE_LOW);
+		LCD_setEnable(PIN_STATE_LOW);
 
+		LCD_trackCommand(Copy_uint8Command);
+		LCD_endWrite((Copy_uint8Command <= LCD_LONG_COMMAND_LAST) ? LCD_CLEAR_DISPLAY_WAIT_US : LCD_COMMAND_EXECUTION_US);
 		entryCounter = 0;
 		break;
 
@@ -287,51 +844,6 @@ static void LCD_writeCommandSM(uint8_t Copy_uint8Command){
 	}
 }
 
-static void LCD_sendCommandProc(void){
-
-#if (LCD_DATA_BITS_MODE == LCD_FOUR_BITS_MODE)
-	static uint8_t writeCommandSM_remainingStages = REMAINING_STAGES_4_BIT_MODE_CASE;
-
-#elif (LCD_DATA_BITS_MODE == LCD_EIGHT_BITS_MODE)
-	static uint8_t writeCommandSM_remainingStages = REMAINING_STAGES_8_BIT_MODE_CASE;
-
-#endif  /* #if (LCD_DATA_BITS_MODE == LCD_FOUR_BITS_MODE) */
-
-
-#if (LCD_DATA_BITS_MODE == LCD_FOUR_BITS_MODE)
-
-	if(writeCommandSM_remainingStages > 0){
-		LCD_writeCommandSM(userReq.command);
-		writeCommandSM_remainingStages--;
-	}
-	else{
-		/* We finished the printing of one character */
-		writeCommandSM_remainingStages = REMAINING_STAGES_4_BIT_MODE_CASE;
-		userReq.type = NULL;
-		userReq.state = readyForRequest;
-		sendCommandProc.callBack();
-	}
-
-#elif (LCD_DATA_BITS_MODE == LCD_EIGHT_BITS_MODE)
-
-	if(writeCommandSM_remainingStages > 0){
-		LCD_writeCommandSM(userReq.command);
-		writeCommandSM_remainingStages--;
-	}
-	else{
-		/* We finished the printing of one character */
-		writeCommandSM_remainingStages = REMAINING_STAGES_4_BIT_MODE_CASE;
-		userReq.type = NULL;
-		userReq.state = readyForRequest;
-		writeCommandProc.callBack();
-	}
-
-#endif  /* #if (LCD_DATA_BITS_MODE == LCD_FOUR_BITS_MODE) */
-
-}
-
-
-
 
 /**
  *@brief : Process that writes a data on the data bus.
@@ -344,84 +856,58 @@ static void LCD_writeDataSM(uint8_t Copy_uint8Data){
 
 	switch(entryCounter){
 
-	/* Set the value of RS pin as output high as we are sending data */
+	/* Set the value of RS pin as output high as we are sending data, it goes out with the
+	 * data when it shares their port */
 	case 1:
-		GPIO_SetPinValue(arrayofLCDPinConfig[RS_4BITMODE].LCD_port_number,\
-				arrayofLCDPinConfig[RS_4BITMODE].LCD_pin_number,\
-				PIN_STATE_HIGH);
+		lcdWriteInProgress = 1;
+		if(lcdBusRsMask == 0){
+			GPIO_SetPinValue(arrayofLCDPinConfig[LCD_RS_PIN].LCD_port_number,\
+					arrayofLCDPinConfig[LCD_RS_PIN].LCD_pin_number,\
+					PIN_STATE_HIGH);
+		}
 		break;
 		/* Set the value of R/w pin as output low as we are writing */
 	case 2:
-		GPIO_SetPinValue(arrayofLCDPinConfig[RW_4BITMODE].LCD_port_number,\
-				arrayofLCDPinConfig[RW_4BITMODE].LCD_pin_number,\
+		GPIO_SetPinValue(arrayofLCDPinConfig[LCD_RW_PIN].LCD_port_number,\
+				arrayofLCDPinConfig[LCD_RW_PIN].LCD_pin_number,\
 				PIN_STATE_LOW);
 		break;
 		/* Set the value of the E pin to be output low to make pulse on it later once we
 		 * put the data on the data pins */
 	case 3:
-		GPIO_SetPinValue(arrayofLCDPinConfig[E_4BITMODE].LCD_port_number,\
-				arrayofLCDPinConfig[E_4BITMODE].LCD_pin_number,\
-				PIN_STATE_LOW);
+		LCD_setEnable(PIN_STATE_LOW);
 		break;
 
 #if (LCD_DATA_BITS_MODE == LCD_FOUR_BITS_MODE)
 
 		/* Putting the upper 4-bits data on the data pins of the LCD */
 	case 4:
-		GPIO_SetPinValue(arrayofLCDPinConfig[D7_4BITMODE].LCD_port_number,\
-				arrayofLCDPinConfig[D7_4BITMODE].LCD_pin_number,\
-				( ( Copy_uint8Data & (1<<D7) ) >> D7 ));
-		GPIO_SetPinValue(arrayofLCDPinConfig[D6_4BITMODE].LCD_port_number,\
-				arrayofLCDPinConfig[D6_4BITMODE].LCD_pin_number,\
-				( ( Copy_uint8Data & (1<<D6) ) >> D6 ));
-		GPIO_SetPinValue(arrayofLCDPinConfig[D5_4BITMODE].LCD_port_number,\
-				arrayofLCDPinConfig[D5_4BITMODE].LCD_pin_number,\
-				( ( Copy_uint8Data & (1<<D5) ) >> D5 ));
-		GPIO_SetPinValue(arrayofLCDPinConfig[D4_4BITMODE].LCD_port_number,\
-				arrayofLCDPinConfig[D4_4BITMODE].LCD_pin_number,\
-				( ( Copy_uint8Data & (1<<D4) ) >> D4 ));
+		LCD_writeBus(PIN_STATE_HIGH, LCD_UPPER_NIBBLE(Copy_uint8Data));
 		break;
 		/* Send a pulse to the E pin to send the data to the LCD */
 		/* Set the value of the E pin to be output high */
 	case 5:
-		GPIO_SetPinValue(arrayofLCDPinConfig[E_4BITMODE].LCD_port_number,\
-				arrayofLCDPinConfig[E_4BITMODE].LCD_pin_number,\
-				PIN_STATE_HIGH);
+		LCD_setEnable(PIN_STATE_HIGH);
 		break;
 		/* Set the value of the E pin to be output low */
 	case 6:
-		GPIO_SetPinValue(arrayofLCDPinConfig[E_4BITMODE].LCD_port_number,\
-				arrayofLCDPinConfig[E_4BITMODE].LCD_pin_number,\
-				PIN_STATE_LOW);
+		LCD_setEnable(PIN_STATE_LOW);
 		break;
 		/* Putting the lower 4-bits data on the data pins of the LCD */
 	case 7:
-		GPIO_SetPinValue(arrayofLCDPinConfig[D7_4BITMODE].LCD_port_number,\
-				arrayofLCDPinConfig[D7_4BITMODE].LCD_pin_number,\
-				( ( Copy_uint8Data & (1<<D3) ) >> D3 ));
-		GPIO_SetPinValue(arrayofLCDPinConfig[D6_4BITMODE].LCD_port_number,\
-				arrayofLCDPinConfig[D6_4BITMODE].LCD_pin_number,\
-				( ( Copy_uint8Data & (1<<D2) ) >> D2 ));
-		GPIO_SetPinValue(arrayofLCDPinConfig[D5_4BITMODE].LCD_port_number,\
-				arrayofLCDPinConfig[D5_4BITMODE].LCD_pin_number,\
-				( ( Copy_uint8Data & (1<<D1) ) >> D1 ));
-		GPIO_SetPinValue(arrayofLCDPinConfig[D4_4BITMODE].LCD_port_number,\
-				arrayofLCDPinConfig[D4_4BITMODE].LCD_pin_number,\
-				( ( Copy_uint8Data & (1<<D0) ) >> D0 ));
+		LCD_writeBus(PIN_STATE_HIGH, LCD_LOWER_NIBBLE(Copy_uint8Data));
 		break;
 		/* Send a pulse to the E pin to send the data to the LCD */
 		/* Set the value of the E pin to be output high */
 	case 8:
-		GPIO_SetPinValue(arrayofLCDPinConfig[E_4BITMODE].LCD_port_number,\
-				arrayofLCDPinConfig[E_4BITMODE].LCD_pin_number,\
-				PIN_STATE_HIGH);
+		LCD_setEnable(PIN_STATE_HIGH);
 		break;
 		/* Set the value of the E pin to be output low */
 	case 9:
-		GPIO_SetPinValue(arrayofLCDPinConfig[E_4BITMODE].LCD_port_number,\
-				arrayofLCDPinConfig[E_4BITMODE].LCD_pin_number,\
-				PIN_STATE_LOW);
+		LCD_setEnable(PIN_STATE_LOW);
 
+		LCD_trackData(Copy_uint8Data);
+		LCD_endWrite(LCD_DATA_EXECUTION_US);
 		entryCounter = 0;
 		break;
 
@@ -430,44 +916,19 @@ static void LCD_writeDataSM(uint8_t Copy_uint8Data){
 
 		/* Putting the data on the data pins of the LCD */
 	case 4:
-		GPIO_SetPinValue(arrayofLCDPinConfig[D7].LCD_port_number,\
-				arrayofLCDPinConfig[D7].LCD_pin_number,\
-				( ( Copy_uint8Data & (1<<D7) ) >> D7 ));
-		GPIO_SetPinValue(arrayofLCDPinConfig[D6].LCD_port_number,\
-				arrayofLCDPinConfig[D6].LCD_pin_number,\
-				( ( Copy_uint8Data & (1<<D6) ) >> D6 ));
-		GPIO_SetPinValue(arrayofLCDPinConfig[D5].LCD_port_number,\
-				arrayofLCDPinConfig[D5].LCD_pin_number,\
-				( ( Copy_uint8Data & (1<<D5) ) >> D5 ));
-		GPIO_SetPinValue(arrayofLCDPinConfig[D4].LCD_port_number,\
-				arrayofLCDPinConfig[D4].LCD_pin_number,\
-				( ( Copy_uint8Data & (1<<D4) ) >> D4 ));
-		GPIO_SetPinValue(arrayofLCDPinConfig[D3].LCD_port_number,\
-				arrayofLCDPinConfig[D3].LCD_pin_number,\
-				( ( Copy_uint8Data & (1<<D3) ) >> D3 ));
-		GPIO_SetPinValue(arrayofLCDPinConfig[D2].LCD_port_number,\
-				arrayofLCDPinConfig[D2].LCD_pin_number,\
-				( ( Copy_uint8Data & (1<<D2) ) >> D2 ));
-		GPIO_SetPinValue(arrayofLCDPinConfig[D1].LCD_port_number,\
-				arrayofLCDPinConfig[D1].LCD_pin_number,\
-				( ( Copy_uint8Data & (1<<D1) ) >> D1 ));
-		GPIO_SetPinValue(arrayofLCDPinConfig[D0].LCD_port_number,\
-				arrayofLCDPinConfig[D0].LCD_pin_number,\
-				( ( Copy_uint8Data & (1<<D0) ) >> D0 ));
+		LCD_writeBus(PIN_STATE_HIGH, Copy_uint8Data);
 		break;
 		/* Send a pulse to the E pin to send the data to the LCD */
 		/* Set the value of the E pin to be output high */
 	case 5:
-		GPIO_SetPinValue(arrayofLCDPinConfig[E_4BITMODE].LCD_port_number,\
-				arrayofLCDPinConfig[E_4BITMODE].LCD_pin_number,\
-				PIN_STATE_HIGH);
+		LCD_setEnable(PIN_STATE_HIGH);
 		break;
 		/* Set the value of the E pin to be output low */
 	case 6:
-		GPIO_SetPinValue(arrayofLCDPinConfig[E_4BITMODE].LCD_port_number,\
-				arrayofLCDPinConfig[E_4BITMODE].LCD_pin_number,\
-				PIN_STATE_LOW);
+		LCD_setEnable(PIN_STATE_LOW);
 
+		LCD_trackData(Copy_uint8Data);
+		LCD_endWrite(LCD_DATA_EXECUTION_US);
 		entryCounter = 0;
 		break;
 
@@ -480,6 +941,168 @@ static void LCD_writeDataSM(uint8_t Copy_uint8Data){
 }
 
 
+/**
+ *@brief : Process that counts the calls of the LCD runnable during a wait, so the waits stay
+ *		   right with any periodicity of the runnable (LCD_RUNNABLE_PERIOD_US). With the timer engine
+ *		   the first call gives the wait to the timer and the next one, at the end of it, ends it.
+ *@param : The wait in microseconds.
+ *@return: 1 when the wait is over, 0 otherwise.
+ */
+static uint8_t LCD_waitSM(uint32_t Copy_uint32WaitUs){
+	uint8_t LOC_uint8WaitIsOver = 0;
+
+#if (LCD_ENGINE == LCD_ENGINE_RUNNABLE)
+	static uint32_t callsCounter = 0;
+	callsCounter++;
+
+	if(callsCounter >= LCD_CALLS(Copy_uint32WaitUs)){
+		callsCounter = 0;
+		LOC_uint8WaitIsOver = 1;
+	}
+
+#elif (LCD_ENGINE == LCD_ENGINE_TIMER)
+	static uint8_t waitStarted = 0;
+
+	if(waitStarted == 0){
+		waitStarted = 1;
+		lcdTimerWaitUs = Copy_uint32WaitUs;
+	}
+	else{
+		waitStarted = 0;
+		LOC_uint8WaitIsOver = 1;
+	}
+
+#endif  /* #if (LCD_ENGINE == LCD_ENGINE_RUNNABLE) */
+
+	return LOC_uint8WaitIsOver;
+}
+
+
+#if (LCD_BUSY_FLAG_MODE == LCD_BUSY_FLAG_POLLING)
+
+/**
+ *@brief : Function that sets the data pins as inputs while the LCD drives them, or back as outputs.
+ *@param : 1 for inputs, 0 for outputs.
+ *@return: void.
+ */
+static void LCD_setDataPinsInput(uint8_t Copy_uint8Input){
+	uint8_t LOC_uint8counter;
+	GPIO_CONFIG_T LOC_LCDPinConfig;
+
+	for(LOC_uint8counter = LCD_FIRST_DATA_PIN; LOC_uint8counter <= LCD_LAST_DATA_PIN; LOC_uint8counter++){
+		LOC_LCDPinConfig.Port = arrayofLCDPinConfig[LOC_uint8counter].LCD_port_number;
+		LOC_LCDPinConfig.Pin = arrayofLCDPinConfig[LOC_uint8counter].LCD_pin_number;
+		LOC_LCDPinConfig.Speed = GPIO_SPEED_HIGH;
+		LOC_LCDPinConfig.Mode = (Copy_uint8Input == 1) ? GPIO_MODE_IN_PD : GPIO_MODE_OP_PP;
+		GPIO_InitPin(&LOC_LCDPinConfig);
+	}
+}
+
+
+/**
+ *@brief : Function that reads the busy flag of the LCD on D7 with RW high, it is read between two
+ *		   writes only as a read in the middle of a write would take the place of its second nibble.
+ *		   Each GPIO call takes more than the 360 ns the LCD needs to put the flag on D7 (checked
+ *		   with tools/lcd_model down to 400 ns per call).
+ *@param : void.
+ *@return: 1 if the LCD is still executing the last instruction, 0 if it takes the next one.
+ */
+static uint8_t LCD_isBusy(void){
+	uint8_t LOC_uint8BusyFlag = 0;
+#if (LCD_DATA_BITS_MODE == LCD_FOUR_BITS_MODE)
+	uint8_t LOC_uint8AddressBit = 0;
+#endif  /* #if (LCD_DATA_BITS_MODE == LCD_FOUR_BITS_MODE) */
+
+	LCD_setDataPinsInput(1);
+	GPIO_SetPinValue(arrayofLCDPinConfig[LCD_RS_PIN].LCD_port_number,\
+			arrayofLCDPinConfig[LCD_RS_PIN].LCD_pin_number,\
+			PIN_STATE_LOW);
+	GPIO_SetPinValue(arrayofLCDPinConfig[LCD_RW_PIN].LCD_port_number,\
+			arrayofLCDPinConfig[LCD_RW_PIN].LCD_pin_number,\
+			PIN_STATE_HIGH);
+	LCD_setEnable(PIN_STATE_HIGH);
+	GPIO_GetPinValue(arrayofLCDPinConfig[LCD_BUSY_FLAG_PIN].LCD_port_number,\
+			arrayofLCDPinConfig[LCD_BUSY_FLAG_PIN].LCD_pin_number,\
+			&LOC_uint8BusyFlag);
+	LCD_setEnable(PIN_STATE_LOW);
+
+#if (LCD_DATA_BITS_MODE == LCD_FOUR_BITS_MODE)
+	/* The second nibble (the rest of the address counter) is read too, so the next write starts
+	 * with the upper nibble, E keeps each level for LCD_ENABLE_HOLD_NS */
+	LCD_setEnable(PIN_STATE_HIGH);
+	GPIO_GetPinValue(arrayofLCDPinConfig[LCD_BUSY_FLAG_PIN].LCD_port_number,\
+			arrayofLCDPinConfig[LCD_BUSY_FLAG_PIN].LCD_pin_number,\
+			&LOC_uint8AddressBit);
+	LCD_setEnable(PIN_STATE_LOW);
+
+#endif  /* #if (LCD_DATA_BITS_MODE == LCD_FOUR_BITS_MODE) */
+
+	GPIO_SetPinValue(arrayofLCDPinConfig[LCD_RW_PIN].LCD_port_number,\
+			arrayofLCDPinConfig[LCD_RW_PIN].LCD_pin_number,\
+			PIN_STATE_LOW);
+	LCD_setDataPinsInput(0);
+
+	return (LOC_uint8BusyFlag == 1);
+}
+
+#endif  /* #if (LCD_BUSY_FLAG_MODE == LCD_BUSY_FLAG_POLLING) */
+
+
+/**
+ *@brief : Function that tells if the LCD executed the last write, by reading the busy flag or by the
+ *		   time since the write (LCD_BUSY_FLAG_MODE).
+ *@param : void.
+ *@return: 1 when the last write is executed, 0 otherwise.
+ */
+static uint8_t LCD_isExecuted(void){
+	uint8_t LOC_uint8IsExecuted = 0;
+
+#if (LCD_BUSY_FLAG_MODE == LCD_BUSY_FLAG_POLLING)
+	LOC_uint8IsExecuted = (LCD_isBusy() == 0);
+
+#elif (LCD_BUSY_FLAG_MODE == LCD_BUSY_FLAG_TIMED)
+	LOC_uint8IsExecuted = ((LCD_GET_CYCLES() - lcdWriteEndCycles) >= lcdExecutionCycles);
+
+#endif  /* #if (LCD_BUSY_FLAG_MODE == LCD_BUSY_FLAG_POLLING) */
+
+	return LOC_uint8IsExecuted;
+}
+
+
+#if (LCD_ENGINE == LCD_ENGINE_RUNNABLE)
+
+/**
+ *@brief : Function that waits for the LCD to execute the last write before the next step of the runnable,
+ *		   inside the call while the rest of the execution fits in what is left of the budget of the call
+ *		   (LCD_STEP_BUDGET_US). The steps in the middle of a write don't wait.
+ *@param : The cycle count at the start of the call of the runnable.
+ *@return: 1 if the next step can run, 0 if the call must end.
+ */
+static uint8_t LCD_waitReady(uint32_t Copy_uint32StartCycles){
+	uint8_t LOC_uint8Ready = (lcdWriteInProgress == 1) || LCD_isExecuted();
+	uint8_t LOC_uint8Wait = 1;
+	uint32_t LOC_uint32Elapsed;
+	uint32_t LOC_uint32Rest;
+
+	while((LOC_uint8Ready == 0) && (LOC_uint8Wait == 1)){
+		/* The rest of the execution, the busy flag of a slow LCD can stay up after it */
+		LOC_uint32Elapsed = LCD_GET_CYCLES() - lcdWriteEndCycles;
+		LOC_uint32Rest = (LOC_uint32Elapsed < lcdExecutionCycles) ? (lcdExecutionCycles - LOC_uint32Elapsed) : 0;
+
+		if(((LCD_GET_CYCLES() - Copy_uint32StartCycles) + LOC_uint32Rest) >= LCD_STEP_BUDGET_CYCLES){
+			LOC_uint8Wait = 0;
+		}
+		else{
+			LOC_uint8Ready = LCD_isExecuted();
+		}
+	}
+
+	return LOC_uint8Ready;
+}
+
+#endif  /* #if (LCD_ENGINE == LCD_ENGINE_RUNNABLE) */
+
+
 /**
  *@brief : Process that initializes the LCD.
  *@param : void.
@@ -536,49 +1159,35 @@ static void LCD_initProcSM(void){
 		entryCounter++;
 		break;
 	case 2:
-	case 3:
-	case 4:
-	case 5:
-	case 6:
-	case 7:
-	case 8:
-	case 9:
-	case 10:
-	case 11:
-	case 12:
-	case 13:
-	case 14:
-	case 15:
-	case 16:
-	case 17:
-	case 18:
-	case 19:
-	case 20:
-	case 21:
-	case 22:
-	case 23:
-	case 24:
-	case 25:
-	case 26:
-	case 27:
-	case 28:
-	case 29:
-	case 30:
-		entryCounter++;
+		/* The call of case 1 was the first period of the power on wait */
+		if(LCD_waitSM(LCD_POWER_ON_WAIT_US - LCD_RUNNABLE_PERIOD_US)){
+			entryCounter = 31;
+		}
 		break;
 		/* When coming here again, 30 milliseconds will have been passed (Power on), write command */
 	case 31:
 
 		if (writeCommandSM_remainingStages > 0){
-			LCD_writeCommandSM(LCD_TWO_LINES_FOUR_BITS_MODE_INIT1);
-			writeCommandSM_remainingStages--;
+			/* Each nibble is a command of the 8-bit interface the LCD starts with, it takes 4.1 ms
+			 * after the first one, so wait before the second nibble */
+			if((writeCommandSM_remainingStages != REMAINING_STAGES_SECOND_NIBBLE) ||
+					LCD_waitSM(LCD_INIT_COMMAND_WAIT_US)){
+				LCD_writeCommandSM(LCD_TWO_LINES_FOUR_BITS_MODE_INIT1);
+				writeCommandSM_remainingStages--;
+			}
 		}
 		else{
 			writeCommandSM_remainingStages = REMAINING_STAGES_4_BIT_MODE_CASE;
-			entryCounter += 5;
+			entryCounter++;
+		}
+		break;
+		/* Wait 5 milliseconds before the next command */
+	case 32:
+		if(LCD_waitSM(LCD_INIT_COMMAND_WAIT_US)){
+			entryCounter = 36;
 		}
 		break;
-		/* When coming here again 5 milliseconds will have been passed, write command */
+		/* 5 milliseconds have been passed, write command */
 	case 36:
 
 		if (writeCommandSM_remainingStages > 0){
@@ -625,10 +1234,16 @@ static void LCD_initProcSM(void){
 		}
 		else{
 			writeCommandSM_remainingStages = REMAINING_STAGES_4_BIT_MODE_CASE;
-			entryCounter += 2;
+			entryCounter++;
 		}
 		break;
-		/* When coming here again 2 milliseconds will have been passed, enter Entry mode set stage */
+		/* Wait till the LCD finishes clearing the display */
+	case 40:
+		if(LCD_isExecuted()){
+			entryCounter++;
+		}
+		break;
+		/* 2 milliseconds have been passed, enter Entry mode set stage */
 	case 41:
 
 		if (writeCommandSM_remainingStages > 0){
@@ -645,6 +1260,7 @@ static void LCD_initProcSM(void){
 	case 42:
 		entryCounter = 0;
 		userReq.state = readyForRequest;
+		TRACE_EVENT(TRACE_REQUEST_END, TRACE_DRIVER_LCD, 0);
 		lcdState = stateOperational;
 		initProc.callBack();
 		break;
@@ -674,41 +1290,16 @@ static void LCD_initProcSM(void){
 
 			GPIO_SetPinValue(arrayofLCDPinConfig[LOC_uint8counter].LCD_port_number,\
 					arrayofLCDPinConfig[LOC_uint8counter].LCD_pin_number,\
-					PIN_STATE_HIGH);
+					PIN_STATE_LOW);
 		}
 
 		entryCounter++;
 		break;
 	case 2:
-	case 3:
-	case 4:
-	case 5:
-	case 6:
-	case 7:
-	case 8:
-	case 9:
-	case 10:
-	case 11:
-	case 12:
-	case 13:
-	case 14:
-	case 15:
-	case 16:
-	case 17:
-	case 18:
-	case 19:
-	case 20:
-	case 21:
-	case 22:
-	case 23:
-	case 24:
-	case 25:
-	case 26:
-	case 27:
-	case 28:
-	case 29:
-	case 30:
-		entryCounter++;
+		/* The call of case 1 was the first period of the power on wait */
+		if(LCD_waitSM(LCD_POWER_ON_WAIT_US - LCD_RUNNABLE_PERIOD_US)){
+			entryCounter = 31;
+		}
 		break;
 		/* When coming here again 30 milliseconds will have been passed (Power on), enter
 		 * Function set stage */
@@ -746,10 +1337,16 @@ static void LCD_initProcSM(void){
 		}
 		else{
 			writeCommandSM_remainingStages = REMAINING_STAGES_8_BIT_MODE_CASE;
-			entryCounter += 2;
+			entryCounter++;
 		}
 		break;
-		/* When coming here again 2 milliseconds will have been passed, enter Entry mode set stage */
+		/* Wait till the LCD finishes clearing the display */
+	case 34:
+		if(LCD_isExecuted()){
+			entryCounter++;
+		}
+		break;
+		/* 2 milliseconds have been passed, enter Entry mode set stage */
 	case 35:
 
 		if (writeCommandSM_remainingStages > 0){
@@ -758,7 +1355,7 @@ static void LCD_initProcSM(void){
 		}
 		else{
 			writeCommandSM_remainingStages = REMAINING_STAGES_8_BIT_MODE_CASE;
-			entryCounter += 2;
+			entryCounter++;
 		}
 		break;
 		/* We reach the end of initialization, change to readyForRequest, enter the stateOperational
@@ -766,6 +1363,7 @@ static void LCD_initProcSM(void){
 	case 36:
 		entryCounter = 0;
 		userReq.state = readyForRequest;
+		TRACE_EVENT(TRACE_REQUEST_END, TRACE_DRIVER_LCD, 0);
 		lcdState = stateOperational;
 		initProc.callBack();
 		break;
@@ -815,9 +1413,7 @@ static void LCD_writeProc(void){
 	else{
 		/* We finished the Printing of the Whole string */
 		entryCounter = 0;
-		userReq.type = Non;
-		userReq.state = readyForRequest;
-		writeProc.callBack();
+		LCD_endRequest();
 	}
 
 #elif (LCD_DATA_BITS_MODE == LCD_EIGHT_BITS_MODE)
@@ -839,9 +1435,7 @@ static void LCD_writeProc(void){
 	else{
 		/* We finished the Printing of the Whole string */
 		entryCounter = 0;
-		userReq.type = Non;
-		userReq.state = readyForRequest;
-		writeProc.callBack();
+		LCD_endRequest();
 	}
 
 #endif  /* #if (LCD_DATA_BITS_MODE == LCD_FOUR_BITS_MODE) */
@@ -870,21 +1464,25 @@ static void LCD_writeNumProc(void) {
 	 * to be printed then in a correct manner. */
 	static uint64_t LOC_uint64InvertedImage = 0;
 
-	/* Its usage is to check if the unit digit in the input number is zero or not */
+	/* Its usage is to count the zeros in the lowest digits of the input number, they are printed last */
 	static uint8_t LOC_uint8ZeroInUnitsChecker = 0;
 
-	/* Its usage is to check if the input number is zero or not */
-	static uint8_t LOC_uint8NumberIsZeroFlag = 0;
-
-	/* Its usage is to check if the input number is zero whether We finished printing it or not */
-	static uint8_t LOC_uint8ZeroIsPrintedFlag = 0;
+	/* Its usage is to check if the input number is zero, 0xFF till the first step of the request,
+	 * 1 while the zero is printed, 2 for another number and 0 at the end */
+	static uint8_t LOC_uint8NumberIsZeroFlag = 0xFF;
 
-	/* Check if the input is zero */
-	if((userReq.number == 0) && (LOC_uint8NumberIsZeroFlag == 0)) {
+	/* Check if the input is zero, only at the first step as the number is divided down to zero */
+	if (userReq.number == 0 && LOC_uint8NumberIsZeroFlag == 0xFF)
+	{
 		LOC_uint8NumberIsZeroFlag = 1;
 	}
+	else if (userReq.number != 0)
+	{
+		LOC_uint8NumberIsZeroFlag = 2;
+	}
 
-	if (LOC_uint8NumberIsZeroFlag == 1 && LOC_uint8ZeroIsPrintedFlag == 0) {
+	if (LOC_uint8NumberIsZeroFlag == 1)
+	{
 		/* Check if the input is zero, print it directly */
 
 		/* Check if We finished all stages of the LCD_writeDataSM or not */
@@ -895,21 +1493,21 @@ static void LCD_writeNumProc(void) {
 		else{
 			/* We finished the printing of one digit */
 			writeDataSM_remainingStages = REMAINING_STAGES_4_BIT_MODE_CASE;
-			LOC_uint8ZeroIsPrintedFlag = 1;
+			LOC_uint8NumberIsZeroFlag = 0;
 		}
-	} else if (userReq.number != 0) {
+	} else if (userReq.number != 0 && LOC_uint8NumberIsZeroFlag == 2) {
 		/* Save an inverted image of the input in a local variable to b able to print it properly */
 		LOC_uint64InvertedImage *= 10;
 		LOC_uint64InvertedImage += userReq.number % 10;
 
-		/* If the unit digit in the input number is zero then raise the Zero checker flag */
+		/* If the unit digit in the input number is zero then count it */
 		if (LOC_uint64InvertedImage == 0) {
-			LOC_uint8ZeroInUnitsChecker = 1;
+			LOC_uint8ZeroInUnitsChecker++;
 		}
 
 		userReq.number /= 10;
 
-	} else if (LOC_uint64InvertedImage != 0) {
+	} else if (LOC_uint64InvertedImage != 0 && LOC_uint8NumberIsZeroFlag == 2) {
 		/* Send the inverted number to be printed digit-by-digit */
 
 		/* Check if We finished all stages of the LCD_writeDataSM or not */
@@ -923,8 +1521,8 @@ static void LCD_writeNumProc(void) {
 			LOC_uint64InvertedImage /= 10;
 		}
 	}
-	/* If the Zero checker flag is set then print Zero as the last thing to be printed */
-	else if (LOC_uint8ZeroInUnitsChecker == 1)
+	/* The counted zeros of the lowest digits are the last things to be printed */
+	else if (LOC_uint8ZeroInUnitsChecker != 0)
 	{
 		/* Check if We finished all stages of the LCD_writeDataSM or not */
 		if(writeDataSM_remainingStages > 0) {
@@ -934,19 +1532,12 @@ static void LCD_writeNumProc(void) {
 		else{
 			/* We finished the printing of one digit */
 			writeDataSM_remainingStages = REMAINING_STAGES_4_BIT_MODE_CASE;
-			LOC_uint8ZeroInUnitsChecker = 0;
+			LOC_uint8ZeroInUnitsChecker--;
 		}
 	} else {
 		/* We finished the Printing of the Whole number */
-		if (LOC_uint8NumberIsZeroFlag == 1) {
-			LOC_uint8NumberIsZeroFlag = 0;
-		}
-		if (LOC_uint8ZeroIsPrintedFlag == 1) {
-			LOC_uint8ZeroIsPrintedFlag = 0;
-		}
-		userReq.type = Non;
-		userReq.state = readyForRequest;
-		writeNumProc.callBack();
+		LOC_uint8NumberIsZeroFlag = 0xFF;
+		LCD_endRequest();
 	}
 
 
@@ -1001,9 +1592,7 @@ static void LCD_writeNumProc(void) {
 		}
 	} else {
 		/* We finished the Printing of the Whole number */
-		userReq.type = Non;
-		userReq.state = readyForRequest;
-		writeNumProc.callBack();
+		LCD_endRequest();
 	}
 
 #endif  /* #if (LCD_DATA_BITS_MODE == LCD_FOUR_BITS_MODE) */
@@ -1033,26 +1622,109 @@ static void LCD_cleanProc(void){
 		LCD_writeCommandSM(LCD_ClearDisplay);
 		writeCommandSM_remainingStages--;
 	}
+	else if(LCD_isExecuted()){
+		/* We finished the clearing of the display, it takes 1.52 ms inside the LCD */
+		writeCommandSM_remainingStages = REMAINING_STAGES_4_BIT_MODE_CASE;
+		LCD_endRequest();
+	}
+
+#elif (LCD_DATA_BITS_MODE == LCD_EIGHT_BITS_MODE)
+
+	if(writeCommandSM_remainingStages > 0){
+		LCD_writeCommandSM(LCD_ClearDisplay);
+		writeCommandSM_remainingStages--;
+	}
+	else if(LCD_isExecuted()){
+		/* We finished the clearing of the display, it takes 1.52 ms inside the LCD */
+		writeCommandSM_remainingStages = REMAINING_STAGES_4_BIT_MODE_CASE;
+		LCD_endRequest();
+	}
+
+#endif  /* #if (LCD_DATA_BITS_MODE == LCD_FOUR_BITS_MODE) */
+
+}
+
+
+static void LCD_sendCommandProc(void){
+
+#if (LCD_DATA_BITS_MODE == LCD_FOUR_BITS_MODE)
+	static uint8_t writeCommandSM_remainingStages = REMAINING_STAGES_4_BIT_MODE_CASE;
+
+#elif (LCD_DATA_BITS_MODE == LCD_EIGHT_BITS_MODE)
+	static uint8_t writeCommandSM_remainingStages = REMAINING_STAGES_8_BIT_MODE_CASE;
+
+#endif  /* #if (LCD_DATA_BITS_MODE == LCD_FOUR_BITS_MODE) */
+
+
+#if (LCD_DATA_BITS_MODE == LCD_FOUR_BITS_MODE)
+
+	if(writeCommandSM_remainingStages > 0){
+		LCD_writeCommandSM(userReq.command);
+		writeCommandSM_remainingStages--;
+	}
+	else if((userReq.command > LCD_LONG_COMMAND_LAST) || LCD_isExecuted()){
+		/* We finished the sending of the command, a return home takes 1.52 ms inside the LCD like a clear */
+		writeCommandSM_remainingStages = REMAINING_STAGES_4_BIT_MODE_CASE;
+		LCD_endRequest();
+	}
+
+#elif (LCD_DATA_BITS_MODE == LCD_EIGHT_BITS_MODE)
+
+	if(writeCommandSM_remainingStages > 0){
+		LCD_writeCommandSM(userReq.command);
+		writeCommandSM_remainingStages--;
+	}
+	else if((userReq.command > LCD_LONG_COMMAND_LAST) || LCD_isExecuted()){
+		/* We finished the sending of the command, a return home takes 1.52 ms inside the LCD like a clear */
+		writeCommandSM_remainingStages = REMAINING_STAGES_4_BIT_MODE_CASE;
+		LCD_endRequest();
+	}
+
+#endif  /* #if (LCD_DATA_BITS_MODE == LCD_FOUR_BITS_MODE) */
+
+}
+
+
+
+
+/**
+ *@brief : Process that set the cursor position.
+ *@param : void.
+ *@return: void.
+ */
+static void LCD_setCursorProc(void){
+
+#if (LCD_DATA_BITS_MODE == LCD_FOUR_BITS_MODE)
+	static uint8_t writeCommandSM_remainingStages = REMAINING_STAGES_4_BIT_MODE_CASE;
+
+#elif (LCD_DATA_BITS_MODE == LCD_EIGHT_BITS_MODE)
+	static uint8_t writeCommandSM_remainingStages = REMAINING_STAGES_8_BIT_MODE_CASE;
+
+#endif  /* #if (LCD_DATA_BITS_MODE == LCD_FOUR_BITS_MODE) */
+
+
+#if (LCD_DATA_BITS_MODE == LCD_FOUR_BITS_MODE)
+
+	if(writeCommandSM_remainingStages > 0){
+		LCD_writeCommandSM(LCD_DDRAM_START_ADDRESS + userReq.cursorLocation);
+		writeCommandSM_remainingStages--;
+	}
 	else{
 		/* We finished the printing of one character */
 		writeCommandSM_remainingStages = REMAINING_STAGES_4_BIT_MODE_CASE;
-		userReq.type = Non;
-		userReq.state = readyForRequest;
-		clearProc.callBack();
+		LCD_endRequest();
 	}
 
 #elif (LCD_DATA_BITS_MODE == LCD_EIGHT_BITS_MODE)
 
 	if(writeCommandSM_remainingStages > 0){
-		LCD_writeCommandSM(LCD_ClearDisplay);
+		LCD_writeCommandSM(LCD_DDRAM_START_ADDRESS + userReq.cursorLocation);
 		writeCommandSM_remainingStages--;
 	}
 	else{
 		/* We finished the printing of one character */
 		writeCommandSM_remainingStages = REMAINING_STAGES_4_BIT_MODE_CASE;
-		userReq.type = Non;
-		userReq.state = readyForRequest;
-		clearProc.callBack();
+		LCD_endRequest();
 	}
 
 #endif  /* #if (LCD_DATA_BITS_MODE == LCD_FOUR_BITS_MODE) */
@@ -1060,54 +1732,223 @@ static void LCD_cleanProc(void){
 }
 
 
+
 /**
- *@brief : Process that set the cursor position.
+ *@brief : Process that writes the cells of the shadow buffer that differ from what the LCD shows,
+ *		   one character at a time, the cursor is moved only to a changed cell that doesn't follow
+ *		   the last written character. The changed rows of the CGRAM are uploaded first the same way,
+ *		   so the cells show the new glyphs once they are written.
  *@param : void.
  *@return: void.
  */
-static void LCD_setCursorProc(void){
+static void LCD_flushProc(void){
+	/* The item the search for a changed one starts from: the CGRAM address of a row of a glyph, then
+	 * LCD_CGRAM_ROWS + row * LCD_FRAME_COLUMNS + column for a cell */
+	static uint8_t flushCell = 0;
+
+	/* The command or the character being written */
+	static uint8_t flushByte = 0;
+	static uint8_t flushIsCommand = 0;
+
+	/* No stages are left between two writes, so a flush starts with the search */
+	static uint8_t writeSM_remainingStages = 0;
+
+	uint8_t LOC_uint8Row = 0;
+	uint8_t LOC_uint8Column = 0;
+	uint8_t LOC_uint8Address;
+
+	if(writeSM_remainingStages > 0){
+		if(flushIsCommand == 1){
+			LCD_writeCommandSM(flushByte);
+		}
+		else{
+			LCD_writeDataSM(flushByte);
+		}
+		writeSM_remainingStages--;
+	}
+	else{
+		/* The last write is followed in cgramDisplay, displayBuffer and the addresses, look for the next
+		 * changed row of the CGRAM or cell */
+		for(; flushCell < LCD_FLUSH_ITEMS; flushCell++){
+			if(flushCell < LCD_CGRAM_ROWS){
+				if(cgramBuffer[flushCell / LCD_GLYPH_ROWS][flushCell % LCD_GLYPH_ROWS] !=
+						cgramDisplay[flushCell / LCD_GLYPH_ROWS][flushCell % LCD_GLYPH_ROWS]){
+					break;
+				}
+			}
+			else{
+				LOC_uint8Row = (flushCell - LCD_CGRAM_ROWS) / LCD_FRAME_COLUMNS;
+				LOC_uint8Column = (flushCell - LCD_CGRAM_ROWS) % LCD_FRAME_COLUMNS;
+				if(frameBuffer[LOC_uint8Row][LOC_uint8Column] != displayBuffer[LOC_uint8Row][LOC_uint8Column]){
+					break;
+				}
+			}
+		}
+
+		if(flushCell == LCD_FLUSH_ITEMS){
+			/* We finished, the LCD shows the whole shadow buffer */
+			flushCell = 0;
+			LCD_endRequest();
+		}
+		else if(flushCell < LCD_CGRAM_ROWS){
+			if(flushCell != lcdCgramAddress){
+				/* Move the CGRAM address to the changed row, the next rows follow it */
+				flushByte = LCD_CGRAM_START_ADDRESS + flushCell;
+				flushIsCommand = 1;
+			}
+			else{
+				flushByte = cgramBuffer[flushCell / LCD_GLYPH_ROWS][flushCell % LCD_GLYPH_ROWS];
+				flushIsCommand = 0;
+			}
 
 #if (LCD_DATA_BITS_MODE == LCD_FOUR_BITS_MODE)
-	static uint8_t writeCommandSM_remainingStages = REMAINING_STAGES_4_BIT_MODE_CASE;
+			writeSM_remainingStages = REMAINING_STAGES_4_BIT_MODE_CASE;
 
 #elif (LCD_DATA_BITS_MODE == LCD_EIGHT_BITS_MODE)
-	static uint8_t writeCommandSM_remainingStages = REMAINING_STAGES_8_BIT_MODE_CASE;
+			writeSM_remainingStages = REMAINING_STAGES_8_BIT_MODE_CASE;
 
 #endif  /* #if (LCD_DATA_BITS_MODE == LCD_FOUR_BITS_MODE) */
+		}
+		else{
+			LOC_uint8Address = (LOC_uint8Row * LCD_SECOND_ROW_ADDRESS) + LOC_uint8Column;
 
+			if(LOC_uint8Address != lcdAddress){
+				/* Move the cursor to the changed cell, its character is written after it */
+				flushByte = LCD_DDRAM_START_ADDRESS + LOC_uint8Address;
+				flushIsCommand = 1;
+			}
+			else{
+				flushByte = frameBuffer[LOC_uint8Row][LOC_uint8Column];
+				flushIsCommand = 0;
+			}
 
 #if (LCD_DATA_BITS_MODE == LCD_FOUR_BITS_MODE)
+			writeSM_remainingStages = REMAINING_STAGES_4_BIT_MODE_CASE;
 
-	if(writeCommandSM_remainingStages > 0){
-		LCD_writeCommandSM(LCD_DDRAM_START_ADDRESS + userReq.cursorLocation);
-		writeCommandSM_remainingStages--;
+#elif (LCD_DATA_BITS_MODE == LCD_EIGHT_BITS_MODE)
+			writeSM_remainingStages = REMAINING_STAGES_8_BIT_MODE_CASE;
+
+#endif  /* #if (LCD_DATA_BITS_MODE == LCD_FOUR_BITS_MODE) */
+		}
+	}
+}
+
+
+/**
+ *@brief : Process that runs one step of the request being served, it takes the next request of the
+ *		   queue when the last one is finished.
+ *@param : void.
+ *@return: void.
+ */
+static void LCD_serveRequest(void){
+	/* The last request is finished, serve the next one in the queue */
+	if(userReq.state == readyForRequest){
+		LCD_takeRequest();
+	}
+
+	if(userReq.state == busyWithRequest){
+		switch(userReq.type){
+		case reqClearScreen:
+			LCD_cleanProc();
+			break;
+		case reqSetCursor:
+			LCD_setCursorProc();
+			break;
+		case reqWriteString:
+			LCD_writeProc();
+			break;
+		case reqWriteNumber:
+			LCD_writeNumProc();
+			break;
+		case reqWriteCommand:
+			LCD_sendCommandProc();
+			break;
+		case reqFlush:
+			LCD_flushProc();
+			break;
+		default:
+			/* Do Nothing */
+			break;
+		}
 	}
 	else{
-		/* We finished the printing of one character */
-		writeCommandSM_remainingStages = REMAINING_STAGES_4_BIT_MODE_CASE;
-		userReq.type = Non;
-		userReq.state = readyForRequest;
-		setCursorProc.callBack();
+		/* Do Nothing */
 	}
+}
 
-#elif (LCD_DATA_BITS_MODE == LCD_EIGHT_BITS_MODE)
 
-	if(writeCommandSM_remainingStages > 0){
-		LCD_writeCommandSM(LCD_DDRAM_START_ADDRESS + userReq.cursorLocation);
-		writeCommandSM_remainingStages--;
+#if (LCD_ENGINE == LCD_ENGINE_TIMER)
+
+/**
+ *@brief : Function that gives the microseconds left till the LCD executes the last write, by the
+ *		   execution times of the datasheet.
+ *@param : void.
+ *@return: The microseconds left, 0 when the last write is executed.
+ */
+static uint32_t LCD_executionRestUs(void){
+	uint32_t LOC_uint32Elapsed = LCD_GET_CYCLES() - lcdWriteEndCycles;
+	uint32_t LOC_uint32RestUs = 0;
+
+	if(LOC_uint32Elapsed < lcdExecutionCycles){
+		LOC_uint32RestUs = ((lcdExecutionCycles - LOC_uint32Elapsed) + LCD_CYCLES_PER_US - 1) / LCD_CYCLES_PER_US;
 	}
-	else{
-		/* We finished the printing of one character */
-		writeCommandSM_remainingStages = REMAINING_STAGES_4_BIT_MODE_CASE;
-		userReq.type = Non;
-		userReq.state = readyForRequest;
-		clearProc.callBack();
+
+	return LOC_uint32RestUs;
+}
+
+
+/**
+ *@brief : Callback of the one-shot timer of LCD_ENGINE_TIMER, it runs the steps of the requests till
+ *		   the LCD has a write to execute and starts the timer again with the time of its execution, or
+ *		   with the wait of the initialization (one step per time while initializing). The timer stays
+ *		   stopped when there is no request left, the next request starts it.
+ *@param : void.
+ *@return: void.
+ */
+static void LCD_timerStep(void){
+	uint32_t LOC_uint32NextUs = 0;
+	uint32_t LOC_uint32Primask;
+
+	switch(lcdState){
+	case stateInitialization:
+		/* One step per time, each nibble of the function sets of the 8-bit interface is an instruction
+		 * of its own, so each step waits for the execution of an instruction at least */
+		LCD_initProcSM();
+		LOC_uint32NextUs = (lcdTimerWaitUs > LCD_COMMAND_EXECUTION_US) ? lcdTimerWaitUs : LCD_COMMAND_EXECUTION_US;
+		lcdTimerWaitUs = 0;
+		break;
+	case stateOperational:
+		while(((lcdWriteInProgress == 1) || LCD_isExecuted()) &&
+				((userReq.state == busyWithRequest) || (queueCount > 0))){
+			LCD_serveRequest();
+		}
+		break;
+	default:
+		/* Do Nothing */
+		break;
 	}
 
-#endif  /* #if (LCD_DATA_BITS_MODE == LCD_FOUR_BITS_MODE) */
+	/* The next step comes after the LCD executes the last write, in the polling mode the busy
+	 * flag is read then and the timer is started again with LCD_TIMER_MIN_US if it is still up */
+	if(LCD_executionRestUs() > LOC_uint32NextUs){
+		LOC_uint32NextUs = LCD_executionRestUs();
+	}
+	if(LOC_uint32NextUs < LCD_TIMER_MIN_US){
+		LOC_uint32NextUs = LCD_TIMER_MIN_US;
+	}
 
+	/* The interrupts are masked, so a request queued between the check and the stop starts the timer */
+	LOC_uint32Primask = LCD_ENTER_CRITICAL();
+	if((lcdState == stateOperational) && (userReq.state == readyForRequest) && (queueCount == 0)){
+		lcdTimerIdle = 1;
+	}
+	else{
+		LCD_TIMER_START(LOC_uint32NextUs);
+	}
+	LCD_EXIT_CRITICAL(LOC_uint32Primask);
 }
 
+#endif  /* #if (LCD_ENGINE == LCD_ENGINE_TIMER) */
 
 
 /************************************************************************************/
@@ -1134,7 +1975,21 @@ LCD_enuError_t LCD_enuInitAsync(void (*callBackFn)(void)){
 	}
 	else if((lcdState == stateOff) && (userReq.state == readyForRequest)){
 		initProc.callBack = callBackFn;
+		LCD_clearBuffer(frameBuffer);
+		LCD_clearCgram();
+		LCD_prepareBus();
+		LCD_START_CYCLES();
 		userReq.state = busyWithRequest;
+		TRACE_EVENT(TRACE_REQUEST_START, TRACE_DRIVER_LCD, LCD_TRACE_INIT_REQUEST);
+#if (LCD_ENGINE == LCD_ENGINE_RUNNABLE)
+		/* Wake up the LCD runnable to serve the request */
+		SCHED_Resume(LCD_SCHED_RUNNABLE_ID);
+#elif (LCD_ENGINE == LCD_ENGINE_TIMER)
+		/* The first step comes a period after, like the first call of the runnable */
+		LCD_TIMER_INIT(LCD_timerStep);
+		lcdTimerIdle = 0;
+		LCD_TIMER_START(LCD_RUNNABLE_PERIOD_US);
+#endif  /* #if (LCD_ENGINE == LCD_ENGINE_RUNNABLE) */
 		lcdState = stateInitialization;
 	}
 	else{
@@ -1171,6 +2026,161 @@ LCD_enuError_t LCD_enuGetState(uint8_t* State){
 }
 
 
+/**
+ *@brief : Function that returns the number of requests the queue takes now, so a whole screen can be
+ *			sent in one go when there is room for all its requests.
+ *@param : pointer inside which We will return the number of free places in the requests queue.
+ *@return: Error State.
+ */
+LCD_enuError_t LCD_enuGetFreeRequests(uint8_t* FreeRequests){
+	/* A local variable to assign the error state inside it and use only one return in the whole function
+	 * through returning the value of this local variable.
+	 * Initially we assume that everything is OK, if not its value will be changed according to a definite
+	 * error type */
+	LCD_enuError_t LOC_enuErrorStatus = LCD_enuOk;
+
+	/* Check on the passed pointer that it isn't a NULL pointer */
+	if(FreeRequests == NULL){
+		/* The passed pointer is a NULL pointer, return an error */
+		LOC_enuErrorStatus = LCD_enuNullPointer;
+	}
+	else if(lcdState == stateOff){
+		/* No request is taken before LCD_enuInitAsync */
+		*FreeRequests = 0;
+	}
+	else{
+		*FreeRequests = LCD_REQUEST_QUEUE_SIZE - queueCount;
+	}
+
+	return LOC_enuErrorStatus;
+}
+
+
+/**
+ *@brief : Function that draws a string in the shadow buffer of the screen, nothing is sent to the LCD
+ *			till LCD_enuFlushAsync, so a screen drawn by many calls is sent by one request.
+ *@param : The row and the column of the first character, and the string, the characters after the
+ *			last column of the shadow buffer (LCD_FRAME_COLUMNS) are not drawn.
+ *@return: Error State.
+ */
+LCD_enuError_t LCD_enuDrawString(LCD_enuRowNumber_t row, uint8_t column, uint8_t* string){
+	/* A local variable to assign the error state inside it and use only one return in the whole function
+	 * through returning the value of this local variable.
+	 * Initially we assume that everything is OK, if not its value will be changed according to a definite
+	 * error type */
+	LCD_enuError_t LOC_enuErrorStatus = LCD_enuOk;
+
+	/* Check on the passed pointer that it isn't a NULLL pointer */
+	if(string == NULL){
+		/* The passed pointer is a NULLL pointer, return an error */
+		LOC_enuErrorStatus = LCD_enuNullPointer;
+	}
+	else if(row > LCD_enuSecondRow){
+		LOC_enuErrorStatus = LCD_enuWrongRowNumber;
+	}
+	else if(column >= LCD_FRAME_COLUMNS){
+		LOC_enuErrorStatus = LCD_enuWrongColumnNumber;
+	}
+	else{
+		/* A cell drawn while a flush is served is sent by it if the flush didn't pass it yet, by the
+		 * next flush otherwise */
+		while((column < LCD_FRAME_COLUMNS) && (*string != '\0')){
+			frameBuffer[row][column] = *string;
+			column++;
+			string++;
+		}
+	}
+
+	return LOC_enuErrorStatus;
+}
+
+
+/**
+ *@brief : Function that draws a custom glyph in the shadow buffer of the screen, in the block of the
+ *			CGRAM that holds it or else in the least recently used block no other cell shows. Nothing
+ *			is sent to the LCD till LCD_enuFlushAsync, it uploads the changed rows of the CGRAM.
+ *@param : The row and the column of the cell, and the LCD_GLYPH_ROWS rows of the glyph.
+ *@return: Error State.
+ */
+LCD_enuError_t LCD_enuDrawGlyph(LCD_enuRowNumber_t row, uint8_t column, const uint8_t* glyph){
+	/* A local variable to assign the error state inside it and use only one return in the whole function
+	 * through returning the value of this local variable.
+	 * Initially we assume that everything is OK, if not its value will be changed according to a definite
+	 * error type */
+	LCD_enuError_t LOC_enuErrorStatus = LCD_enuOk;
+	uint8_t LOC_uint8Block;
+	uint8_t LOC_uint8Row;
+
+	/* Check on the passed pointer that it isn't a NULL pointer */
+	if(glyph == NULL){
+		/* The passed pointer is a NULL pointer, return an error */
+		LOC_enuErrorStatus = LCD_enuNullPointer;
+	}
+	else if(row > LCD_enuSecondRow){
+		LOC_enuErrorStatus = LCD_enuWrongRowNumber;
+	}
+	else if(column >= LCD_FRAME_COLUMNS){
+		LOC_enuErrorStatus = LCD_enuWrongColumnNumber;
+	}
+	else{
+		/* A glyph the CGRAM holds already is drawn with no upload */
+		LOC_uint8Block = LCD_findGlyphBlock(glyph);
+
+		if(LOC_uint8Block == LCD_CGRAM_BLOCKS){
+			LOC_uint8Block = LCD_evictGlyphBlock(row, column);
+			if(LOC_uint8Block != LCD_CGRAM_BLOCKS){
+				for(LOC_uint8Row = 0; LOC_uint8Row < LCD_GLYPH_ROWS; LOC_uint8Row++){
+					cgramBuffer[LOC_uint8Block][LOC_uint8Row] = glyph[LOC_uint8Row] & LCD_GLYPH_DOTS_MASK;
+				}
+			}
+		}
+
+		if(LOC_uint8Block == LCD_CGRAM_BLOCKS){
+			LOC_enuErrorStatus = LCD_enuNoFreeBlock;
+		}
+		else{
+			cgramUseCounter++;
+			cgramLastUse[LOC_uint8Block] = cgramUseCounter;
+			frameBuffer[row][column] = LOC_uint8Block;
+		}
+	}
+
+	return LOC_enuErrorStatus;
+}
+
+
+/**
+ *@brief : Function that draws a digit two rows tall in the shadow buffer, from the glyphs of its upper
+ *			and lower halves.
+ *@param : The column of the digit and the digit, from 0 to 9.
+ *@return: Error State.
+ */
+LCD_enuError_t LCD_enuDrawBigDigit(uint8_t column, uint8_t digit){
+	/* A local variable to assign the error state inside it and use only one return in the whole function
+	 * through returning the value of this local variable.
+	 * Initially we assume that everything is OK, if not its value will be changed according to a definite
+	 * error type */
+	LCD_enuError_t LOC_enuErrorStatus = LCD_enuOk;
+	uint8_t LOC_arrGlyph[LCD_GLYPH_ROWS];
+	uint8_t LOC_uint8Half;
+
+	if(digit >= LCD_BIG_DIGITS){
+		LOC_enuErrorStatus = LCD_enuNotOk;
+	}
+	else if(column >= LCD_FRAME_COLUMNS){
+		LOC_enuErrorStatus = LCD_enuWrongColumnNumber;
+	}
+	else{
+		for(LOC_uint8Half = LCD_enuFirstRow; (LOC_uint8Half < LCD_ROWS) && (LOC_enuErrorStatus == LCD_enuOk); LOC_uint8Half++){
+			LCD_makeBigDigitGlyph(bigDigitSegments[digit], LOC_uint8Half, LOC_arrGlyph);
+			LOC_enuErrorStatus = LCD_enuDrawGlyph(LOC_uint8Half, column, LOC_arrGlyph);
+		}
+	}
+
+	return LOC_enuErrorStatus;
+}
+
+
 /**
  *@brief : Function that clears the screen.
  *@param : a callback function you want to be called after finishing your request.
@@ -1183,18 +2193,18 @@ LCD_enuError_t LCD_enuClearScreenAsync(void (*callBackFn)(void)){
 	 * error type */
 	LCD_enuError_t LOC_enuErrorStatus = LCD_enuOk;
 
+	/* The request that is added to the queue */
+	request_t LOC_strRequest = {0};
+
 	/* Check on the Passed Pointer whether it is a NULL pointer or not */
 	if(callBackFn == NULL){
 		/* if the passed pointer is a NULL, return error */
 		LOC_enuErrorStatus = LCD_enuNullPointer;
 	}
-	else if ((lcdState == stateOperational) && (userReq.state == readyForRequest)){
-		clearProc.callBack = callBackFn;
-		userReq.type = reqClearScreen;
-		userReq.state = busyWithRequest;
-	}
 	else{
-		/* Do Nothing */
+		LOC_strRequest.type = reqClearScreen;
+		LOC_strRequest.callBack = callBackFn;
+		LOC_enuErrorStatus = LCD_enqueueRequest(&LOC_strRequest);
 	}
 
 	return LOC_enuErrorStatus;
@@ -1214,10 +2224,18 @@ LCD_enuError_t LCD_enuSetCursorAsync(LCD_enuRowNumber_t row, uint8_t column, voi
 	 * error type */
 	LCD_enuError_t LOC_enuErrorStatus = LCD_enuOk;
 
+	/* The request that is added to the queue */
+	request_t LOC_strRequest = {0};
+
+	/* Check on the Passed Pointer whether it is a NULL pointer or not */
+	if(callBackFn == NULL){
+		/* if the passed pointer is a NULL, return error */
+		LOC_enuErrorStatus = LCD_enuNullPointer;
+	}
 	/* The compiler will generate the following warning:
 	 * "comparison is always false due to limited range of data type [-Wtype-limits]"
 	 * ignore it */
-	if ((row < LCD_enuFirstRow) || (row > LCD_enuSecondRow)){
+	else if ((row < LCD_enuFirstRow) || (row > LCD_enuSecondRow)){
 		LOC_enuErrorStatus = LCD_enuWrongRowNumber;
 	}
 	/* The compiler will generate the following warning:
@@ -1226,25 +2244,22 @@ LCD_enuError_t LCD_enuSetCursorAsync(LCD_enuRowNumber_t row, uint8_t column, voi
 	else if ((column < LCD_enuColumn_1) || (column > LCD_enuColumn_40)){
 		LOC_enuErrorStatus = LCD_enuWrongColumnNumber;
 	}
-	else if ((lcdState == stateOperational) && (userReq.state == readyForRequest)){
+	else{
 
 		/* Seems like the inputs are correct, then let us go to the required location */
 
 		if (row == LCD_enuFirstRow){
-			userReq.cursorLocation = column;
+			LOC_strRequest.cursorLocation = column;
 		}
 		else{
 			/* Then Copy_uint8X equals LCD_enuSecondRow */
 
-			userReq.cursorLocation = LCD_CGRAM_START_ADDRESS + column;
+			LOC_strRequest.cursorLocation = LCD_CGRAM_START_ADDRESS + column;
 		}
 
-		setCursorProc.callBack = callBackFn;
-		userReq.type = reqSetCursor;
-		userReq.state = busyWithRequest;
-	}
-	else{
-		/* Do Nothing */
+		LOC_strRequest.type = reqSetCursor;
+		LOC_strRequest.callBack = callBackFn;
+		LOC_enuErrorStatus = LCD_enqueueRequest(&LOC_strRequest);
 	}
 
 	return LOC_enuErrorStatus;
@@ -1257,19 +2272,19 @@ LCD_enuError_t LCD_enuSendCommandAsync(uint8_t Copy_uint8Command ,void (*callBac
 	 * error type */
 	LCD_enuError_t LOC_enuErrorStatus = LCD_enuOk;
 
+	/* The request that is added to the queue */
+	request_t LOC_strRequest = {0};
+
 	/* Check on the Passed Pointer whether it is a NULL pointer or not */
 	if(callBackFn == NULL){
 		/* if the passed pointer is a NULL, return error */
 		LOC_enuErrorStatus = LCD_enuNullPointer;
 	}
-	else if ((lcdState == stateOperational) && (userReq.state == readyForRequest)){
-		sendCommandProc.callBack = callBackFn;
-		userReq.command = Copy_uint8Command;
-		userReq.type = reqWriteCommand;
-		userReq.state = busyWithRequest;
-	}
 	else{
-		/* Do Nothing */
+		LOC_strRequest.command = Copy_uint8Command;
+		LOC_strRequest.type = reqWriteCommand;
+		LOC_strRequest.callBack = callBackFn;
+		LOC_enuErrorStatus = LCD_enqueueRequest(&LOC_strRequest);
 	}
 
 	return LOC_enuErrorStatus;
@@ -1290,19 +2305,20 @@ LCD_enuError_t LCD_enuWriteStringAsync(uint8_t* string, void (*callBackFn)(void)
 	 * error type */
 	LCD_enuError_t LOC_enuErrorStatus = LCD_enuOk;
 
+	/* The request that is added to the queue */
+	request_t LOC_strRequest = {0};
+
 	/* Check on the passed pointers whether NULL pointers or can be accessed */
 	if((string == NULL) || (callBackFn == NULL)){
 		/* The passed pointer is a NULL pointer, return an error */
 		LOC_enuErrorStatus = LCD_enuNullPointer;
 	}
-	else if ((lcdState == stateOperational) && (userReq.state == readyForRequest)){
-		writeProc.callBack = callBackFn;
-		userReq.string = string;
-		userReq.type = reqWriteString;
-		userReq.state = busyWithRequest;
-	}
 	else{
-		/* Do Nothing */
+		/* Only the pointer is queued, the string is read when it is printed */
+		LOC_strRequest.string = string;
+		LOC_strRequest.type = reqWriteString;
+		LOC_strRequest.callBack = callBackFn;
+		LOC_enuErrorStatus = LCD_enqueueRequest(&LOC_strRequest);
 	}
 
 	return LOC_enuErrorStatus;
@@ -1321,13 +2337,50 @@ LCD_enuError_t LCD_enuWriteNumberAsync(uint64_t Copy_uint64Number, void (*callBa
 	 * error type */
 	LCD_enuError_t LOC_enuErrorStatus = LCD_enuOk;
 
-	if ((lcdState == stateOperational) && (userReq.state == readyForRequest)) {
-		writeNumProc.callBack = callBackFn;
-		userReq.number = Copy_uint64Number;
-		userReq.type = reqWriteNumber;
-		userReq.state = busyWithRequest;
-	} else {
-		/* Do Nothing */
+	/* The request that is added to the queue */
+	request_t LOC_strRequest = {0};
+
+	/* Check on the Passed Pointer whether it is a NULL pointer or not */
+	if(callBackFn == NULL){
+		/* if the passed pointer is a NULL, return error */
+		LOC_enuErrorStatus = LCD_enuNullPointer;
+	}
+	else{
+		LOC_strRequest.number = Copy_uint64Number;
+		LOC_strRequest.type = reqWriteNumber;
+		LOC_strRequest.callBack = callBackFn;
+		LOC_enuErrorStatus = LCD_enqueueRequest(&LOC_strRequest);
+	}
+
+	return LOC_enuErrorStatus;
+}
+
+
+/**
+ *@brief : Function that writes to the LCD the cells of the shadow buffer that differ from what it shows,
+ *			the cells are compared when the request is served.
+ *@param : a callback function you want to be called after finishing your request.
+ *@return: Error State.
+ */
+LCD_enuError_t LCD_enuFlushAsync(void (*callBackFn)(void)){
+	/* A local variable to assign the error state inside it and use only one return in the whole function
+	 * through returning the value of this local variable.
+	 * Initially we assume that everything is OK, if not its value will be changed according to a definite
+	 * error type */
+	LCD_enuError_t LOC_enuErrorStatus = LCD_enuOk;
+
+	/* The request that is added to the queue */
+	request_t LOC_strRequest = {0};
+
+	/* Check on the Passed Pointer whether it is a NULL pointer or not */
+	if(callBackFn == NULL){
+		/* if the passed pointer is a NULL, return error */
+		LOC_enuErrorStatus = LCD_enuNullPointer;
+	}
+	else{
+		LOC_strRequest.type = reqFlush;
+		LOC_strRequest.callBack = callBackFn;
+		LOC_enuErrorStatus = LCD_enqueueRequest(&LOC_strRequest);
 	}
 
 	return LOC_enuErrorStatus;
@@ -1337,43 +2390,36 @@ LCD_enuError_t LCD_enuWriteNumberAsync(uint64_t Copy_uint64Number, void (*callBa
 /************************************************************************************/
 /************************************************************************************/
 /************************************************************************************/
+#if (LCD_ENGINE == LCD_ENGINE_RUNNABLE)
+
 /**
  *@brief : Runnable with periodicity 1 millisecond.
  *@param : void.
  *@return: void.
  */
 void RUNNABLE_LCD(void){
+	uint32_t LOC_uint32Primask;
+	uint32_t LOC_uint32StartCycles;
+	uint8_t LOC_uint8Step;
+
 	/* Jump to the current LCD's state */
 	switch(lcdState){
 	case stateInitialization:
 		LCD_initProcSM();
 		break;
 	case stateOperational:
-		if(userReq.state == busyWithRequest){
-			switch(userReq.type){
-			case reqClearScreen:
-				LCD_cleanProc();
-				break;
-			case reqSetCursor:
-				LCD_setCursorProc();
-				break;
-			case reqWriteString:
-				LCD_writeProc();
-				break;
-			case reqWriteNumber:
-				LCD_writeNumProc();
-				break;
-			case reqWriteCommand:
-				LCD_sendCommandProc();
-				break;
-			default:
-				/* Do Nothing */
-				break;
+		/* Run the steps of the requests till the budget of the call is spent, the LCD takes longer than
+		 * what is left of it to execute the last write or there is no request left */
+		LOC_uint32StartCycles = LCD_GET_CYCLES();
+		LOC_uint8Step = 1;
+		while(LOC_uint8Step == 1){
+			LOC_uint8Step = LCD_waitReady(LOC_uint32StartCycles);
+			if(LOC_uint8Step == 1){
+				LCD_serveRequest();
+				LOC_uint8Step = ((LCD_GET_CYCLES() - LOC_uint32StartCycles) < LCD_STEP_BUDGET_CYCLES) &&
+						((userReq.state == busyWithRequest) || (queueCount > 0));
 			}
 		}
-		else{
-			/* Do Nothing */
-		}
 		break;
 	case stateOff:
 
@@ -1382,8 +2428,30 @@ void RUNNABLE_LCD(void){
 		/* Do Nothing */
 		break;
 	}
+
+	/* Nothing to do till the next request, so stop the scheduler from calling this runnable.
+	 * The check is after the callbacks, so a request sent from a callback keeps it running, and the
+	 * interrupts are masked, so a request queued between the check and the suspend is not left waiting */
+	LOC_uint32Primask = LCD_ENTER_CRITICAL();
+	if((lcdState == stateOperational) && (userReq.state == readyForRequest) && (queueCount == 0)){
+		SCHED_Suspend(LCD_SCHED_RUNNABLE_ID);
+	}
+	LCD_EXIT_CRITICAL(LOC_uint32Primask);
+}
+
+#elif (LCD_ENGINE == LCD_ENGINE_TIMER)
+
+/**
+ *@brief : Runnable of the scheduler, the timer runs the LCD so it suspends itself at its first call.
+ *@param : void.
+ *@return: void.
+ */
+void RUNNABLE_LCD(void){
+	SCHED_Suspend(LCD_SCHED_RUNNABLE_ID);
 }
 
+#endif  /* #if (LCD_ENGINE == LCD_ENGINE_RUNNABLE) */
+
 
 
 #endif /* #if ((LCD_DATA_BITS_MODE != LCD_FOUR_BITS_MODE) && (LCD_DATA_BITS_MODE != LCD_EIGHT_BITS_MODE)) */
\ No newline at end of file
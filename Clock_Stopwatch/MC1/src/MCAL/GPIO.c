@@ -16,6 +16,7 @@
 #define PIN_PUPDR_OFFSET                        0x00000002
 
 #define BSRR_OFFSET                             16
+#define BSRR_PINS_MSK                           0x0000FFFF
 
 #define READ_MSK                                1
 
@@ -92,13 +93,13 @@ GPIO_ERROR_STATE GPIO_SetPinValue(uint32_t GPIO_PORT, uint32_t GPIO_PIN, uint32_
 
     if (PIN_STATE == PIN_STATE_HIGH)
     {
-        GPIO_Ports[GPIO_PORT]->BSRR |= (PIN_STATE_HIGH << GPIO_PIN);
+        GPIO_Ports[GPIO_PORT]->BSRR = (PIN_STATE_HIGH << GPIO_PIN);
         Error_State = GPIO_ENUM_OK;
     }
 
     else if (PIN_STATE == PIN_STATE_LOW)
     {
-        GPIO_Ports[GPIO_PORT]->BSRR |= (PIN_STATE_HIGH << (GPIO_PIN + BSRR_OFFSET));
+        GPIO_Ports[GPIO_PORT]->BSRR = (PIN_STATE_HIGH << (GPIO_PIN + BSRR_OFFSET));
         Error_State = GPIO_ENUM_OK;
     }
 
@@ -109,6 +110,22 @@ GPIO_ERROR_STATE GPIO_SetPinValue(uint32_t GPIO_PORT, uint32_t GPIO_PIN, uint32_
     return Error_State;
 }
 
+GPIO_ERROR_STATE GPIO_SetPortBits(uint32_t GPIO_PORT, uint32_t SET_MASK, uint32_t RESET_MASK)
+{
+    GPIO_ERROR_STATE Error_State = GPIO_ENUM_NOK;
+
+    if (GPIO_PORT > GPIO_PORT_C)
+    {
+        Error_State = GPIO_ENUM_INVALID_CONFIG;
+    }
+    else
+    {
+        GPIO_Ports[GPIO_PORT]->BSRR = (SET_MASK & BSRR_PINS_MSK) | ((RESET_MASK & BSRR_PINS_MSK) << BSRR_OFFSET);
+        Error_State = GPIO_ENUM_OK;
+    }
+    return Error_State;
+}
+
 GPIO_ERROR_STATE GPIO_GetPinValue(uint32_t GPIO_PORT, uint32_t GPIO_PIN, uint8_t * PinValue)
 {
     GPIO_ERROR_STATE Error_State = GPIO_ENUM_NOK;
@@ -1,4 +1,5 @@
 #include "MCAL/SYSTICK.h"
+#include "Service/TRACE.h"
 
 #define SYSTICK_BASE_ADDRESS       0xE000E010 
 #define STK_SOURCE_BIT             0x00000004   
@@ -6,6 +7,7 @@
 #define STK_ENABLE_BIT             0x00000001 
 #define AHB_PRESCALAR_VALUE        8
 #define MS_DIVISION_FACTOR         1000
+#define US_DIVISION_FACTOR         1000000
 #define EXTRA_TICK                 1
 #define MAX_TIMER_VALUE            0x00FFFFFF
 
@@ -53,22 +55,41 @@ STK_ERROR_STATE STK_Init(uint32_t SOURCE)
 STK_ERROR_STATE STK_SetTimeMS(uint32_t Time_Value)
 {
     STK_ERROR_STATE ERROR_STATE = STK_ENUM_NOK;
+    uint32_t Counts_Per_MS = CLOCK_FREQUENCY_AHB / MS_DIVISION_FACTOR;
     if (Loc_STK_Freq == SOURCE_AHB_DIV_8)
     {
-        Time_Value = (CLOCK_FREQUENCY_AHB / AHB_PRESCALAR_VALUE) * Time_Value;
+        Counts_Per_MS = Counts_Per_MS / AHB_PRESCALAR_VALUE;
+    }
+    /*the time is checked before the multiplication, the clock times the ms overflows 32 bits above 268 ms*/
+    if ((Time_Value == 0) || (Time_Value > ((MAX_TIMER_VALUE + EXTRA_TICK) / Counts_Per_MS)))
+    {
+        ERROR_STATE = STK_ENUM_INVALID_TIME;
     }
     else
     {
-        Time_Value = CLOCK_FREQUENCY_AHB * Time_Value;
+        STK->LOAD = (Counts_Per_MS * Time_Value) - EXTRA_TICK;
+        ERROR_STATE = STK_ENUM_OK;
+    }
+    return ERROR_STATE;
+}
+
+
+
+STK_ERROR_STATE STK_SetTimeUS(uint32_t Time_Value)
+{
+    STK_ERROR_STATE ERROR_STATE = STK_ENUM_NOK;
+    uint32_t Counts_Per_US = CLOCK_FREQUENCY_AHB / US_DIVISION_FACTOR;
+    if (Loc_STK_Freq == SOURCE_AHB_DIV_8)
+    {
+        Counts_Per_US = Counts_Per_US / AHB_PRESCALAR_VALUE;
     }
-    Time_Value = (Time_Value / MS_DIVISION_FACTOR) - EXTRA_TICK;
-    if (Time_Value > MAX_TIMER_VALUE)
+    if ((Time_Value == 0) || (Counts_Per_US == 0) || (Time_Value > ((MAX_TIMER_VALUE + EXTRA_TICK) / Counts_Per_US)))
     {
         ERROR_STATE = STK_ENUM_INVALID_TIME;
     }
     else
     {
-        STK->LOAD = Time_Value;
+        STK->LOAD = (Counts_Per_US * Time_Value) - EXTRA_TICK;
         ERROR_STATE = STK_ENUM_OK;
     }
     return ERROR_STATE;
@@ -133,6 +154,7 @@ STK_ERROR_STATE STK_SetCallback(systickcfg_t Callback)
 
 void SysTick_Handler(void)
 {
+    TRACE_EVENT(TRACE_ISR_ENTRY, TRACE_ISR_SYSTICK, 0);
     if (Systick_Loc_Callback)
 	{
         if (Loc_STK_Mode == STK_MODE_ONESHOT)
@@ -148,4 +170,5 @@ void SysTick_Handler(void)
 	else
 	{
 	}
+    TRACE_EVENT(TRACE_ISR_EXIT, TRACE_ISR_SYSTICK, 0);
 }
\ No newline at end of file
@@ -0,0 +1,104 @@
+#include "MCAL/TIM2.h"
+#include "MCAL/RCC.h"
+#include "MCAL/NVIC.h"
+#include "Service/TRACE.h"
+
+#define TIM2_BASE_ADDRESS          0x40000000
+#define TIM2_CEN_BIT               0x00000001
+#define TIM2_URS_BIT               0x00000004   /*only the end of a time interrupts, not the update of the prescaler*/
+#define TIM2_OPM_BIT               0x00000008   /*the counter stops at the end of a time*/
+#define TIM2_UIE_BIT               0x00000001
+#define TIM2_UIF_BIT               0x00000001
+#define TIM2_UG_BIT                0x00000001
+#define US_DIVISION_FACTOR         1000000
+#define EXTRA_TICK                 1
+
+typedef struct
+{
+    volatile uint32_t CR1;
+    volatile uint32_t CR2;
+    volatile uint32_t SMCR;
+    volatile uint32_t DIER;
+    volatile uint32_t SR;
+    volatile uint32_t EGR;
+    volatile uint32_t CCMR1;
+    volatile uint32_t CCMR2;
+    volatile uint32_t CCER;
+    volatile uint32_t CNT;
+    volatile uint32_t PSC;
+    volatile uint32_t ARR;
+}TIM2_T;
+
+static tim2cfg_t Tim2_Loc_Callback = 0;
+static TIM2_T * const TIM2 = (TIM2_T*)TIM2_BASE_ADDRESS;
+
+
+TIM2_ERROR_STATE TIM2_Init(tim2cfg_t Callback)
+{
+    TIM2_ERROR_STATE ERROR_STATE = TIM2_ENUM_NOK;
+    if (!Callback)
+    {
+        ERROR_STATE = TIM2_ENUM_NULL;
+    }
+    else
+    {
+        Tim2_Loc_Callback = Callback;
+        RCC_Control_APB1Peripherals(RCC_PERI_APB1ENR_TIM2, Status_Enable);
+        TIM2->CR1 = TIM2_URS_BIT | TIM2_OPM_BIT;
+        TIM2->PSC = (CLOCK_FREQUENCY_TIM2 / US_DIVISION_FACTOR) - EXTRA_TICK;
+        TIM2->DIER = TIM2_UIE_BIT;
+        TIM2->SR = 0;
+        NVIC_EnableIRQ(TIM2_IRQ);
+        ERROR_STATE = TIM2_ENUM_OK;
+    }
+    return ERROR_STATE;
+}
+
+
+
+TIM2_ERROR_STATE TIM2_StartOneShotUS(uint32_t Time_Value)
+{
+    TIM2_ERROR_STATE ERROR_STATE = TIM2_ENUM_NOK;
+    if (Time_Value < TIM2_MIN_TIME_US)
+    {
+        ERROR_STATE = TIM2_ENUM_INVALID_TIME;
+    }
+    else
+    {
+        TIM2->CR1 &= ~TIM2_CEN_BIT;
+        TIM2->CNT = 0;
+        TIM2->ARR = Time_Value - EXTRA_TICK;
+        /*loads the prescaler, URS keeps it from interrupting*/
+        TIM2->EGR = TIM2_UG_BIT;
+        TIM2->SR = 0;
+        TIM2->CR1 |= TIM2_CEN_BIT;
+        ERROR_STATE = TIM2_ENUM_OK;
+    }
+    return ERROR_STATE;
+}
+
+
+
+void TIM2_Stop()
+{
+    TIM2->CR1 &= ~TIM2_CEN_BIT;
+    TIM2->SR = 0;
+    /*an end that came before the stop doesn't call the callback*/
+    NVIC_ClearPending(TIM2_IRQ);
+}
+
+
+
+void TIM2_IRQHandler(void)
+{
+    TRACE_EVENT(TRACE_ISR_ENTRY, TRACE_ISR_TIM2, 0);
+    TIM2->SR = ~TIM2_UIF_BIT;
+    if (Tim2_Loc_Callback)
+	{
+		Tim2_Loc_Callback();
+	}
+	else
+	{
+	}
+    TRACE_EVENT(TRACE_ISR_EXIT, TRACE_ISR_TIM2, 0);
+}
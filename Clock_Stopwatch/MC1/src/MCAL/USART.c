@@ -1,4 +1,8 @@
 #include "MCAL/USART.h"
+#include "Service/TRACE.h"
+#if (USART_CALLBACK == USART_CALLBACK_DEFERRED)
+#include "Service/SCHED.h"
+#endif
 
 #define USART1_BASE_ADDRESS             0x40011000
 #define USART2_BASE_ADDRESS             0x40004400
@@ -60,6 +64,30 @@ static uint8_t * USART1_addBufferValue;
 static uint8_t * USART2_addBufferValue;
 static uint8_t * USART6_addBufferValue;
 
+#if (USART_CALLBACK == USART_CALLBACK_DEFERRED)
+/* The interrupt queues the callback itself, so a callback registered again before the scheduler runs it does not
+   change the call that was queued */
+static void USART_RunCallBack(uint32_t CallBackFunction)
+{
+	((CallBack)(uintptr_t)CallBackFunction)();
+}
+
+/* If the queue is full the callback is called in the interrupt, late work is better than a lost transfer end */
+static void USART_DeferCallBack(CallBack CallBackFunction)
+{
+	if(SCHED_Defer(USART_RunCallBack, (uint32_t)(uintptr_t)CallBackFunction) != Ok)
+	{
+		CallBackFunction();
+	}
+}
+
+#define USART_CALL_TX(Channel)		USART_DeferCallBack(cbfTX[Channel])
+#define USART_CALL_RX(Channel)		USART_DeferCallBack(cbfRX[Channel])
+#else
+#define USART_CALL_TX(Channel)		cbfTX[Channel]()
+#define USART_CALL_RX(Channel)		cbfRX[Channel]()
+#endif
+
 
 USART_ErrorStatus USART_Init(const USART_Config* ConfigPtr)
 {
@@ -169,6 +197,7 @@ USART_ErrorStatus USART_SendByteAsynchronous(USART_Channel Channel, uint8_t Copy
 	}
 	else
 	{
+		TRACE_EVENT(TRACE_REQUEST_START, TRACE_DRIVER_USART_TX, Channel);
 		switch(Channel)
 			{
 			case USART1:
@@ -208,6 +237,7 @@ USART_ErrorStatus USART_ReceiveBuffer(USART_RXBuffer * ReceiveBuffer)
 	USART_ErrorStatus ErrorStatus = USART_enuNOK;
 	if(USART_prvRxBusyFlag[ReceiveBuffer->Channel] == 0)
 	{
+		TRACE_EVENT(TRACE_REQUEST_START, TRACE_DRIVER_USART_RX, ReceiveBuffer->Channel);
 		USART_prvRxBufferReceive[ReceiveBuffer->Channel] = (uint8_t *)&ReceiveBuffer->Data;
 		USART_prvRxBufferIndex[ReceiveBuffer->Channel] = ReceiveBuffer->Index; 
 		USART_prvRxBufferSize[ReceiveBuffer->Channel] = ReceiveBuffer->Size;
@@ -257,26 +287,30 @@ USART_ErrorStatus USART_SendBufferZeroCopy(USART_TXBuffer* Copy_ConfigBuffer)
 
 	else
 	{
+		TRACE_EVENT(TRACE_REQUEST_START, TRACE_DRIVER_USART_TX, Copy_ConfigBuffer->Channel);
 		switch(Copy_ConfigBuffer->Channel)
 		{
 		case USART1:
 
 			USART1_addBufferValue = Copy_ConfigBuffer->Data;
-			USART_1->DR  = Copy_ConfigBuffer->Data[USART_prvTXBufferIndex[USART1]];
+			USART_1->DR  = Copy_ConfigBuffer->Data[0];
+			USART_1->CR1 |= Loc_Interrupt_Cfg_Arr.Transmit;
 			ErrorStatus = USART_enuOK;
 			break;
 
 		case USART2:
 
 			USART2_addBufferValue = Copy_ConfigBuffer->Data;
-			USART_2->DR  = Copy_ConfigBuffer->Data[USART_prvTXBufferIndex[USART2]];
+			USART_2->DR  = Copy_ConfigBuffer->Data[0];
+			USART_2->CR1 |= Loc_Interrupt_Cfg_Arr.Transmit;
 			ErrorStatus = USART_enuOK;
 			break;
 
 		case USART6:
 
 			USART6_addBufferValue = Copy_ConfigBuffer->Data;
-			USART_6->DR  = Copy_ConfigBuffer->Data[USART_prvTXBufferIndex[USART6]];
+			USART_6->DR  = Copy_ConfigBuffer->Data[0];
+			USART_6->CR1 |= Loc_Interrupt_Cfg_Arr.Transmit;
 			ErrorStatus = USART_enuOK;
 			break;
 
@@ -285,7 +319,6 @@ USART_ErrorStatus USART_SendBufferZeroCopy(USART_TXBuffer* Copy_ConfigBuffer)
 		USART_prvTXBusyFlag[Copy_ConfigBuffer->Channel] = 1;
 		USART_prvTXBufferIndex[Copy_ConfigBuffer->Channel] = 1;
 		USART_prvTXBufferSize[Copy_ConfigBuffer->Channel] = Copy_ConfigBuffer->Size;
-		USART_1->CR1 |= Loc_Interrupt_Cfg_Arr.Transmit;
 
 
 	}
@@ -320,15 +353,17 @@ USART_ErrorStatus USART_RegisterCallBackFunction(USART_Channel Channel, USART_Mo
 
 void USART1_IRQHandler(void)
 {
+	TRACE_EVENT(TRACE_ISR_ENTRY, TRACE_ISR_USART1, 0);
 	if((USART_1->SR >> 6) & 0x01)
 	{
 		if(USART_prvTXBufferIndex[USART1] == USART_prvTXBufferSize[USART1])
 		{
 			USART_prvTXBusyFlag[USART1] = 0;
+			TRACE_EVENT(TRACE_REQUEST_END, TRACE_DRIVER_USART_TX, USART1);
 			USART_prvTXBufferSize[USART1] = 0;
 			if(cbfTX[USART1])
 			{			
-				cbfTX[USART1]();
+				USART_CALL_TX(USART1);
 			}
 			USART_1->SR &= ~(1 << 6);
 		}
@@ -348,16 +383,18 @@ void USART1_IRQHandler(void)
 		{
 			USART_1->CR1 &= ~(1 << 5);
 			USART_prvRxBusyFlag[USART1] = 0;
+			TRACE_EVENT(TRACE_REQUEST_END, TRACE_DRIVER_USART_RX, USART1);
 			USART_prvRxBufferSize[USART1] = 0;
 			if(cbfRX[USART1])
 			{
-				cbfRX[USART1]();
+				USART_CALL_RX(USART1);
 			}
 		}
 	}
 	else
 	{
 	}
+	TRACE_EVENT(TRACE_ISR_EXIT, TRACE_ISR_USART1, 0);
 }
 
 void USART2_IRQHandler(void)
@@ -367,10 +404,11 @@ void USART2_IRQHandler(void)
 		if(USART_prvTXBufferIndex[USART2] == USART_prvTXBufferSize[USART2])
 		{
 			USART_prvTXBusyFlag[USART2] = 0;
+			TRACE_EVENT(TRACE_REQUEST_END, TRACE_DRIVER_USART_TX, USART2);
 			USART_prvTXBufferSize[USART2] = 0;
 			if(cbfTX[USART2])
 			{			
-				cbfTX[USART2]();
+				USART_CALL_TX(USART2);
 			}
 			USART_2->SR &= ~(1 << 6);
 		}
@@ -390,10 +428,11 @@ void USART2_IRQHandler(void)
 		{
 			USART_2->CR1 &= ~(1 << 5);
 			USART_prvRxBusyFlag[USART2] = 0;
+			TRACE_EVENT(TRACE_REQUEST_END, TRACE_DRIVER_USART_RX, USART2);
 			USART_prvRxBufferSize[USART2] = 0;
 			if(cbfRX[USART2])
 			{
-				cbfRX[USART2]();
+				USART_CALL_RX(USART2);
 			}
 		}
 	}
@@ -409,10 +448,11 @@ void USART6_IRQHandler(void)
 		if(USART_prvTXBufferIndex[USART6] == USART_prvTXBufferSize[USART6])
 		{
 			USART_prvTXBusyFlag[USART6] = 0;
+			TRACE_EVENT(TRACE_REQUEST_END, TRACE_DRIVER_USART_TX, USART6);
 			USART_prvTXBufferSize[USART6] = 0;
 			if(cbfTX[USART6])
 			{			
-				cbfTX[USART6]();
+				USART_CALL_TX(USART6);
 			}
 			USART_6->SR &= ~(1 << 6);
 		}
@@ -432,10 +472,11 @@ void USART6_IRQHandler(void)
 		{
 			USART_6->CR1 &= ~(1 << 5);
 			USART_prvRxBusyFlag[USART6] = 0;
+			TRACE_EVENT(TRACE_REQUEST_END, TRACE_DRIVER_USART_RX, USART6);
 			USART_prvRxBufferSize[USART6] = 0;
 			if(cbfRX[USART6])
 			{
-				cbfRX[USART6]();
+				USART_CALL_RX(USART6);
 			}
 		}
 	}
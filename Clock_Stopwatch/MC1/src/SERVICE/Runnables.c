@@ -1,5 +1,6 @@
 #include <Service/RUNNABLE.h>
 #include <Service/SCHED.h>
+#include <Service/SCHED_PHASE.h>
 /*---------------------------------------------------------------------------------------------------*/
 /*                                           Extern Prototypes                                       */
 /*---------------------------------------------------------------------------------------------------*/
@@ -21,33 +22,44 @@ Runnable_t Runnables_Arr [_RunnableNumber]=
         .Name = "Lcd_runnable",
         .Periodicity = 1,
         .CB = &RUNNABLE_LCD,
+        .BacklogPolicy = SCHED_BACKLOG_COALESCE,
+        .Class = SCHED_CLASS_PREEMPTIVE
     },
     [Clock_Runner]=
     {
         .Name = "Clock_runnable",
         .Periodicity = 200,
         .CB = &Clock_RunnerTask,
-        .DelayMs = 200
+        .DelayMs = 200 + SCHED_PHASE_Clock_Runner,
+        .BudgetUs = 500
     },
     [Stopwatch_Runner]=
     {
         .Name = "Stopwatch_runnable",
         .Periodicity = 200,
         .CB = &Stopwatch_RunnerTask,
-        .DelayMs = 320
+        .DelayMs = 320 + SCHED_PHASE_Stopwatch_Runner,
+        .BudgetUs = 500
     },
     [Switch_Runner]=
     {
         .Name = "Switch_runnable",
         .Periodicity = 200,
         .CB = &Switch_runnable,
-        .DelayMs = 300
+        /*slot of the button frames, 4 ms after the one of Switch_check on MC2 and 4 ms before the one of
+          Recieve_Runnable, they hold with SCHED_SYNC*/
+        .DelayMs = 304,
+        .BacklogPolicy = SCHED_BACKLOG_COALESCE,
+        .Events = SCHED_EVENT_MASK(Button_Received_Event),
+        .BudgetUs = 500
     },
     [sw_runner]=
     {
         .Name = "sw_runner",
         .Periodicity = 10,
         .CB = &SW_Runnable,
-        .DelayMs = 320
+        .DelayMs = 320 + SCHED_PHASE_sw_runner,
+        .BacklogPolicy = SCHED_BACKLOG_COALESCE,
+        .BudgetUs = 200
     }
 };
\ No newline at end of file
@@ -1,53 +1,101 @@
 /*---------------------------------------------------------------------------------------------------*/
 /*                                           Includes:                                               */
 /*---------------------------------------------------------------------------------------------------*/
-#include <MCAL/SYSTICK.h>
 #include <Service/RUNNABLE.h>
 #include <Service/SCHED.h>
+/*the dispatcher is shared with MC2 in COMMON/SCHED_KERNEL, built by SCHED_COMMON.c, CFG/SCHED_CORE_cfg.h maps the
+  options of SCHED.h on it*/
+#include "../../../COMMON/include/SCHED_KERNEL.h"
 
 /*---------------------------------------------------------------------------------------------------*/
 /*                                           Typedefs:                                               */
 /*---------------------------------------------------------------------------------------------------*/
-typedef struct
-{
-    Runnable_t* Runnable;
-    uint32_t RemainingTime;
-}ExtraRunnableInfo_t;
+/*the table must have room for all the runnables of Runnables_Arr*/
+typedef char SCHED_TableSizeCheck_t [(SCHED_MAX_RUNNABLES >= _RunnableNumber) ? 1 : -1];
+
+/*the backlog policies and the classes are given to the kernel as they are*/
+typedef char SCHED_BacklogCheck_t [(((uint32_t)SCHED_BACKLOG_RUN_ALL == (uint32_t)SCHED_CORE_BACKLOG_RUN_ALL) &&
+                                    ((uint32_t)SCHED_BACKLOG_COALESCE == (uint32_t)SCHED_CORE_BACKLOG_COALESCE) &&
+                                    ((uint32_t)SCHED_BACKLOG_SKIP == (uint32_t)SCHED_CORE_BACKLOG_SKIP)) ? 1 : -1];
+
+typedef char SCHED_ClassCheck_t [(((uint32_t)SCHED_CLASS_COOPERATIVE == SCHED_KERNEL_CLASS_COOPERATIVE) &&
+                                  ((uint32_t)SCHED_CLASS_PREEMPTIVE == SCHED_KERNEL_CLASS_PREEMPTIVE)) ? 1 : -1];
+
+#if (SCHED_BUDGET == SCHED_BUDGET_ENABLED)
+typedef char SCHED_BudgetCheck_t [(((uint32_t)SCHED_BUDGET_KEEP == (uint32_t)SCHED_KERNEL_BUDGET_KEEP) &&
+                                   ((uint32_t)SCHED_BUDGET_SLOW_DOWN == (uint32_t)SCHED_KERNEL_BUDGET_SLOW_DOWN) &&
+                                   ((uint32_t)SCHED_BUDGET_SUSPEND == (uint32_t)SCHED_KERNEL_BUDGET_SUSPEND)) ? 1 : -1];
+#endif
+
+#if (SCHED_MODE == SCHED_MODE_TABLE)
+/*a release table generated before a runnable was added or removed or for another tick must be generated again*/
+typedef char SCHED_ReleaseTableCheck_t [((SCHED_TABLE_RUNNABLES == _RunnableNumber) && (SCHED_TABLE_TICK_US == SCHED_TICK_US)) ? 1 : -1];
+#endif
 
 
 /*---------------------------------------------------------------------------------------------------*/
 /*                                           Variables:                                              */
 /*---------------------------------------------------------------------------------------------------*/
-static volatile uint32_t SCHED_PendingTicks = 1 ;
+#if (SCHED_BUDGET == SCHED_BUDGET_ENABLED)
+/*budget policy set by SCHED_SetBudgetHook, the kernel calls it through SCHED_BudgetPolicy*/
+static SCHED_BudgetHook_t SCHED_BudgetHook = NULL ;
+#endif
 
 /*---------------------------------------------------------------------------------------------------*/
 /*                                           Extern:                                                 */
 /*---------------------------------------------------------------------------------------------------*/
 extern Runnable_t Runnables_Arr [_RunnableNumber];
-ExtraRunnableInfo_t Runnable_Info_Array [_RunnableNumber];
+
 /*---------------------------------------------------------------------------------------------------*/
 /*                                           Static Function:                                        */
 /*---------------------------------------------------------------------------------------------------*/
-static void TickIncrement (void)
+/*the errors of the kernel as the APIs of MC1 report them*/
+static ErrorStatus_t SCHED_Status (SCHED_KernelStatus_t Status)
+{
+    ErrorStatus_t Ret_ErrorStatus = NotOk;
+    switch(Status)
+    {
+        case SCHED_KERNEL_OK:
+            Ret_ErrorStatus = Ok;
+            break;
+        case SCHED_KERNEL_NULL_POINTER:
+            Ret_ErrorStatus = NullPointerError;
+            break;
+        case SCHED_KERNEL_INVALID_ID:
+        case SCHED_KERNEL_INVALID_PERIOD:
+        case SCHED_KERNEL_INVALID_CLASS:
+        case SCHED_KERNEL_INVALID_NAME:
+        case SCHED_KERNEL_INVALID_WINDOW:
+            Ret_ErrorStatus = ArgumentError;
+            break;
+        default:
+            Ret_ErrorStatus = NotOk;
+            break;
+    }
+    return Ret_ErrorStatus;
+}
+
+static SCHED_KernelStatus_t SCHED_RegisterRunnable (const Runnable_t* Runnable, uint32_t* RunnableID)
 {
-    SCHED_PendingTicks++;
+    SCHED_KernelRunnable_t Kernel;
+    Kernel.Name = Runnable->Name;
+    Kernel.CB = Runnable->CB;
+    Kernel.Class = Runnable->Class;
+    Kernel.DelayMs = Runnable->DelayMs;
+    Kernel.PeriodicityMs = Runnable->Periodicity;
+    Kernel.PeriodicityUs = Runnable->PeriodicityUs;
+    Kernel.BacklogPolicy = Runnable->BacklogPolicy;
+    Kernel.Events = Runnable->Events;
+    Kernel.BudgetUs = Runnable->BudgetUs;
+    return SCHED_KernelRegister(&Kernel, RunnableID);
 }
 
-static void SCHED (void)
+#if (SCHED_BUDGET == SCHED_BUDGET_ENABLED)
+static uint32_t SCHED_BudgetPolicy (uint32_t RunnableID, uint32_t Overruns)
 {
-    static uint32_t Current_Runnable = 0;
-    for(Current_Runnable =0 ; Current_Runnable < _RunnableNumber ; Current_Runnable++)
-    {
-        /**check if the delay time is passed and call back function is set*/
-        if((Runnables_Arr[Current_Runnable].CB) && (Runnable_Info_Array[Current_Runnable].RemainingTime == 0))
-        {
-         
-            Runnables_Arr[Current_Runnable].CB();
-            Runnable_Info_Array[Current_Runnable].RemainingTime = Runnable_Info_Array[Current_Runnable].Runnable->Periodicity;
-        }
-         Runnable_Info_Array[Current_Runnable].RemainingTime -= SCHED_TICK_TIME;
-    }
+    return (uint32_t)SCHED_BudgetHook(RunnableID, Overruns);
 }
+#endif
 
 /*---------------------------------------------------------------------------------------------------*/
 /*                                           APIs:                                                   */
@@ -56,37 +104,264 @@ static void SCHED (void)
 /**
  * @brief Call this function at the start to initialize the scheduler.
  * @param NoThing
- * @return NoThing 
+ * @return NoThing
  */
 void SCHED_Init (void)
 {
-    STK_Init(SOURCE_AHB);
-    STK_SetTimeMS(SCHED_TICK_TIME);
-    STK_SetCallback(TickIncrement);
-    STK_EnableInterrupt();
-
-    for(uint32_t itr =0 ; itr < _RunnableNumber ; itr++)
+    uint32_t RunnableID = 0;
+    SCHED_KernelInit();
+    /*the runnables of Runnables_Arr take the first IDs in their order, the ones without a CB are never released*/
+    for(uint32_t itr = 0 ; itr < _RunnableNumber ; itr++)
     {
-        Runnable_Info_Array[itr].Runnable = &Runnables_Arr[itr];
-        Runnable_Info_Array[itr].RemainingTime = Runnables_Arr[itr].DelayMs;
+        (void)SCHED_RegisterRunnable(&Runnables_Arr[itr], &RunnableID);
     }
 }
 
 /**
  * @brief this function to start the schedular after initialize it.
+ *        in tickless mode the core sleeps (WFI) between runnable deadlines, the runnables are released
+ *        at the same timestamps as the periodic mode.
  * @param NoThing
- * @return NoThing 
+ * @return NoThing
  */
 void SCHED_Start (void)
 {
-    STK_Start(STK_MODE_PERIODIC);
-    while (1)
+    SCHED_KernelStart();
+}
+
+/**
+ * @brief post events from an ISR (or anywhere), every active runnable subscribed to one of them through its
+ *        Events mask is called at the next dispatch without waiting for its periodic release.
+ * @param Events : mask of the posted events, SCHED_EVENT_MASK(Event) | ...
+ * @return NoThing
+ */
+void SCHED_PostEvent (uint32_t Events)
+{
+    SCHED_KernelPostEvent(Events);
+}
+
+/**
+ * @brief mark the entry of an ISR, its time till SCHED_ExitISR is taken off the execution time of the runnable it
+ *        interrupted, for the budget and the statistics. The systick and PendSV are marked by the scheduler.
+ * @param NoThing
+ * @return uint32_t : the mark to give to SCHED_ExitISR
+ */
+uint32_t SCHED_EnterISR (void)
+{
+    return SCHED_KernelEnterIsr();
+}
+
+/**
+ * @brief mark the exit of the ISR, call it last in the ISR.
+ * @param Mark : the value returned by SCHED_EnterISR
+ * @return NoThing
+ */
+void SCHED_ExitISR (uint32_t Mark)
+{
+    SCHED_KernelExitIsr(Mark);
+}
+
+/**
+ * @brief queue a function from an ISR (or anywhere) instead of calling it there, the scheduler calls it at the
+ *        priority chosen by SCHED_DEFER in the order of the calls, it never masks the interrupts.
+ * @param Work : the function to call
+ * @param Arg : the value given to the function
+ * @return ErrorStatus_t : Ok, NullPointerError or NotOk if the queue is full (the work is dropped and counted)
+ */
+ErrorStatus_t SCHED_Defer (SCHED_DeferredWork_t Work, uint32_t Arg)
+{
+    return SCHED_Status(SCHED_KernelDefer(Work, Arg));
+}
+
+/**
+ * @brief get the number of works dropped by SCHED_Defer because the queue was full, SCHED_DEFER_QUEUE_SIZE
+ *        must grow if it is not 0.
+ * @param Drops : pointer to the variable that will hold the count
+ * @return ErrorStatus_t : Ok or NullPointerError
+ */
+ErrorStatus_t SCHED_GetDeferDrops (uint32_t* Drops)
+{
+    ErrorStatus_t Ret_ErrorStatus = Ok;
+    if(Drops == NULL)
+    {
+        Ret_ErrorStatus = NullPointerError;
+    }
+    else
+    {
+        *Drops = SCHED_KernelGetDeferDrops();
+    }
+    return Ret_ErrorStatus;
+}
+
+/**
+ * @brief add a runnable to the scheduler at runtime, it is released first after its DelayMs from now.
+ * @param Runnable : pointer to the runnable, it is copied
+ * @param RunnableID : pointer to the variable that will hold the ID used by the other APIs
+ * @return ErrorStatus_t : Ok, NullPointerError, ArgumentError if the Class is wrong or NotOk if the table is full
+ *                         (always NotOk in table mode)
+ */
+ErrorStatus_t SCHED_Register (Runnable_t* Runnable, uint32_t* RunnableID)
+{
+    ErrorStatus_t Ret_ErrorStatus = Ok;
+    if((Runnable == NULL) || (Runnable->CB == NULL) || (RunnableID == NULL))
+    {
+        Ret_ErrorStatus = NullPointerError;
+    }
+    else
+    {
+        Ret_ErrorStatus = SCHED_Status(SCHED_RegisterRunnable(Runnable, RunnableID));
+    }
+    return Ret_ErrorStatus;
+}
+
+/**
+ * @brief stop dispatching a runnable till SCHED_Resume is called, it costs nothing while suspended.
+ * @param RunnableID : index in Runnables_Arr or the ID returned by SCHED_Register
+ * @return ErrorStatus_t : Ok or ArgumentError if the ID is not registered
+ */
+ErrorStatus_t SCHED_Suspend (uint32_t RunnableID)
+{
+    return SCHED_Status(SCHED_KernelSuspend(RunnableID));
+}
+
+/**
+ * @brief dispatch a suspended runnable again, it keeps its phase so it is released at the first
+ *        DelayMs + n * Periodicity that is not in the past.
+ *        in tickless mode the release may wait till the end of the systick interval that is counting.
+ * @param RunnableID : index in Runnables_Arr or the ID returned by SCHED_Register
+ * @return ErrorStatus_t : Ok or ArgumentError if the ID is not registered or the runnable has no CB
+ */
+ErrorStatus_t SCHED_Resume (uint32_t RunnableID)
+{
+    return SCHED_Status(SCHED_KernelResume(RunnableID));
+}
+
+/**
+ * @brief change the periodicity of a runnable, the new value applies after its next release.
+ * @param RunnableID : index in Runnables_Arr or the ID returned by SCHED_Register
+ * @param Periodicity : the new periodicity in ms, 0 is not allowed
+ * @return ErrorStatus_t : Ok, ArgumentError or NotOk in table mode
+ */
+ErrorStatus_t SCHED_SetPeriod (uint32_t RunnableID, uint32_t Periodicity)
+{
+    return SCHED_Status(SCHED_KernelSetPeriod(RunnableID, Periodicity));
+}
+
+/**
+ * @brief get the number of releases of a runnable that were coalesced or skipped by its BacklogPolicy.
+ * @param Name : the Name of the runnable as written in Runnables_Arr
+ * @param MissedReleases : pointer to the variable that will hold the count
+ * @return ErrorStatus_t : Ok, NullPointerError or ArgumentError if no runnable has this name
+ */
+ErrorStatus_t SCHED_GetMissedReleases (const char* Name, uint32_t* MissedReleases)
+{
+    return SCHED_Status(SCHED_KernelGetMissedReleases(Name, MissedReleases));
+}
+
+#if (SCHED_BUDGET == SCHED_BUDGET_ENABLED)
+/**
+ * @brief replace the default budget policy, the hook is called from the dispatcher of the runnable class right
+ *        after the call that made SCHED_BUDGET_STRIKES overruns in a row, NULL goes back to the default policy
+ *        (SCHED_BUDGET_SLOW_DOWN). A slowed down runnable comes back by halves after SCHED_BUDGET_RECOVERY_RUNS
+ *        calls in a row within its budget.
+ * @param Hook : the budget policy
+ * @return NoThing
+ */
+void SCHED_SetBudgetHook (SCHED_BudgetHook_t Hook)
+{
+    SCHED_BudgetHook = Hook;
+    SCHED_KernelSetBudgetHook((Hook) ? SCHED_BudgetPolicy : NULL);
+}
+
+/**
+ * @brief get the number of calls of a runnable that took longer than its BudgetUs.
+ * @param Name : the Name of the runnable as written in Runnables_Arr
+ * @param Overruns : pointer to the variable that will hold the count
+ * @return ErrorStatus_t : Ok, NullPointerError or ArgumentError if no runnable has this name
+ */
+ErrorStatus_t SCHED_GetBudgetOverruns (const char* Name, uint32_t* Overruns)
+{
+    return SCHED_Status(SCHED_KernelGetBudgetOverruns(Name, Overruns));
+}
+#endif
+
+#if (SCHED_SYNC == SCHED_SYNC_MASTER)
+/**
+ * @brief set the function that sends the sync frame to the other board, it is called from the systick
+ *        interrupt at every scheduler time that is a multiple of SCHED_SYNC_PERIOD_MS, so it must be short
+ *        (start an asynchronous send and return).
+ * @param Hook : the function that sends the sync frame, NULL stops the sync frames
+ * @return NoThing
+ */
+void SCHED_SetSyncHook (CallBacK_Pointer_t Hook)
+{
+    SCHED_KernelSetSyncHook(Hook);
+}
+#endif
+
+#if (SCHED_STATS == SCHED_STATS_ENABLED)
+/**
+ * @brief get the execution time and start jitter statistics of a runnable.
+ * @param Name : the Name of the runnable as written in Runnables_Arr
+ * @param Stats : pointer to the struct that will be filled with the statistics
+ * @return ErrorStatus_t : Ok, NullPointerError or ArgumentError if no runnable has this name
+ */
+ErrorStatus_t SCHED_GetRunnableStats (const char* Name, SCHED_RunnableStats_t* Stats)
+{
+    SCHED_KernelStats_t Kernel;
+    ErrorStatus_t Ret_ErrorStatus = NullPointerError;
+    if(Stats != NULL)
+    {
+        Ret_ErrorStatus = SCHED_Status(SCHED_KernelGetRunnableStats(Name, &Kernel));
+    }
+    if(Ret_ErrorStatus == Ok)
+    {
+        Stats->Runs = Kernel.Runs;
+        Stats->MinExecCycles = Kernel.MinExecCycles;
+        Stats->MaxExecCycles = Kernel.MaxExecCycles;
+        Stats->MeanExecCycles = Kernel.MeanExecCycles;
+        Stats->MinStartJitter = Kernel.MinStartJitter;
+        Stats->MaxStartJitter = Kernel.MaxStartJitter;
+        Stats->Overruns = Kernel.Overruns;
+    }
+    return Ret_ErrorStatus;
+}
+
+/**
+ * @brief get the worst release latency of a class, the longest delay in core clock cycles between the
+ *        release time of any runnable of the class and its call.
+ * @param Class : SCHED_CLASS_COOPERATIVE or SCHED_CLASS_PREEMPTIVE
+ * @param MaxLatency : pointer to the variable that will hold the latency
+ * @return ErrorStatus_t : Ok, NullPointerError or ArgumentError
+ */
+ErrorStatus_t SCHED_GetClassLatency (SCHED_Class_t Class, uint32_t* MaxLatency)
+{
+    return SCHED_Status(SCHED_KernelGetClassLatency(Class, MaxLatency));
+}
+#endif
+
+#if (SCHED_LOAD == SCHED_LOAD_ENABLED)
+/**
+ * @brief get the CPU load measured over the last complete window, to show it on the LCD or send it over USART.
+ * @param Window : SCHED_LOAD_WINDOW_SHORT or SCHED_LOAD_WINDOW_LONG
+ * @param Load : pointer to the struct that will be filled with the load
+ * @return ErrorStatus_t : Ok, NullPointerError, ArgumentError or NotOk if no window is complete yet
+ */
+ErrorStatus_t SCHED_GetLoad (SCHED_LoadWindow_t Window, SCHED_Load_t* Load)
+{
+    SCHED_KernelLoad_t Kernel;
+    ErrorStatus_t Ret_ErrorStatus = NullPointerError;
+    if(Load != NULL)
+    {
+        Ret_ErrorStatus = SCHED_Status(SCHED_KernelGetLoad(Window, &Kernel));
+    }
+    if(Ret_ErrorStatus == Ok)
     {
-        if(SCHED_PendingTicks)
-        {
-            SCHED_PendingTicks--;
-            SCHED();
-        }
+        Load->BusyCycles = Kernel.BusyCycles;
+        Load->IdleCycles = Kernel.IdleCycles;
+        Load->Utilisation = Kernel.Utilisation;
+        Load->PeakTickUtilisation = Kernel.PeakTickUtilisation;
     }
-    
+    return Ret_ErrorStatus;
 }
+#endif
@@ -0,0 +1,164 @@
+/*---------------------------------------------------------------------------------------------------*/
+/*                                           Includes:                                               */
+/*---------------------------------------------------------------------------------------------------*/
+#include <MCAL/SYSTICK.h>
+#include <MCAL/USART.h>
+#include <Service/TRACE.h>
+#include "../../../COMMON/include/CPU.h"
+
+#if (TRACE == TRACE_ENABLED)
+/*---------------------------------------------------------------------------------------------------*/
+/*                                           Defines:                                                */
+/*---------------------------------------------------------------------------------------------------*/
+#if ((TRACE_BUFFER_EVENTS & (TRACE_BUFFER_EVENTS - 1)) != 0)
+#error "TRACE_BUFFER_EVENTS must be a power of 2"
+#endif
+
+#define TRACE_INDEX_MASK            (TRACE_BUFFER_EVENTS - 1)
+
+/*the USART driver counts the bytes of a buffer in 8 bits, so the ring is sent in parts of 240 bytes*/
+#define TRACE_PART_EVENTS           30
+
+/*---------------------------------------------------------------------------------------------------*/
+/*                                           Variables:                                              */
+/*---------------------------------------------------------------------------------------------------*/
+static TRACE_Event_t TRACE_Buffer [TRACE_BUFFER_EVENTS] ;
+
+/*number of events recorded since TRACE_Init, the next one goes to TRACE_Buffer[TRACE_Head & TRACE_INDEX_MASK]*/
+static volatile uint32_t TRACE_Head = 0 ;
+static volatile uint32_t TRACE_Recording = 0 ;
+
+/*the dump being sent, the events from TRACE_DumpNext to TRACE_DumpEnd (counted like TRACE_Head) are left*/
+static volatile uint32_t TRACE_Dumping = 0 ;
+static uint32_t TRACE_DumpNext = 0 ;
+static uint32_t TRACE_DumpEnd = 0 ;
+static TRACE_DumpHeader_t TRACE_Header ;
+static USART_TXBuffer TRACE_TxBuffer = {.Channel = TRACE_USART_CHANNEL} ;
+
+/*---------------------------------------------------------------------------------------------------*/
+/*                                           Static Function:                                        */
+/*---------------------------------------------------------------------------------------------------*/
+/*called by the USART at the end of each part, it sends the next part or restarts the recording*/
+static void TRACE_SendNext (void)
+{
+    uint32_t Position = TRACE_DumpNext & TRACE_INDEX_MASK;
+    uint32_t Count = TRACE_DumpEnd - TRACE_DumpNext;
+
+    if(Count == 0)
+    {
+        TRACE_Dumping = 0;
+        TRACE_Recording = 1;
+    }
+    else
+    {
+        /*a part stops at the end of the ring, the next one starts from its beginning*/
+        if(Count > (TRACE_BUFFER_EVENTS - Position))
+        {
+            Count = TRACE_BUFFER_EVENTS - Position;
+        }
+        if(Count > TRACE_PART_EVENTS)
+        {
+            Count = TRACE_PART_EVENTS;
+        }
+        TRACE_TxBuffer.Data = (uint8_t*)&TRACE_Buffer[Position];
+        TRACE_TxBuffer.Size = Count * sizeof(TRACE_Event_t);
+        TRACE_DumpNext += Count;
+        USART_SendBufferZeroCopy(&TRACE_TxBuffer);
+    }
+}
+
+/*---------------------------------------------------------------------------------------------------*/
+/*                                           APIs:                                                   */
+/*---------------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief start the DWT cycle counter and the recording, call it first in main so the requests of the
+ *        initialisation are recorded too.
+ * @param NoThing
+ * @return NoThing
+ */
+void TRACE_Init (void)
+{
+    CPU_StartCycleCounter();
+    TRACE_Head = 0;
+    TRACE_Recording = 1;
+}
+
+/**
+ * @brief add an event to the ring, safe to call from an ISR, use TRACE_EVENT so it costs nothing when the
+ *        trace is disabled.
+ * @param Type : TRACE_EventType_t
+ * @param ID : the runnable, class, ISR or driver of the event
+ * @param Arg : extra value of the event
+ * @return NoThing
+ */
+void TRACE_Record (uint8_t Type, uint8_t ID, uint16_t Arg)
+{
+    uint32_t Primask = 0;
+    TRACE_Event_t* Event = NULL;
+
+    if(TRACE_Recording)
+    {
+        /*an ISR may record between taking the slot and filling it*/
+        Primask = CPU_EnterCritical();
+        Event = &TRACE_Buffer[TRACE_Head & TRACE_INDEX_MASK];
+        TRACE_Head++;
+        Event->Timestamp = CPU_GetCycles();
+        Event->Type = Type;
+        Event->ID = ID;
+        Event->Arg = Arg;
+        CPU_ExitCritical(Primask);
+    }
+}
+
+/**
+ * @brief stop the recording and send the header then the events of the ring on TRACE_USART_CHANNEL,
+ *        the recording goes on after the last byte, tools/trace_to_perfetto.py converts the dump.
+ * @param NoThing
+ * @return ErrorStatus_t : Ok or NotOk if a dump is being sent or the USART is busy
+ */
+ErrorStatus_t TRACE_Dump (void)
+{
+    ErrorStatus_t Error = Ok;
+    uint32_t Primask = 0;
+    uint32_t Events = 0;
+
+    Primask = CPU_EnterCritical();
+    if(TRACE_Dumping)
+    {
+        Error = NotOk;
+    }
+    else
+    {
+        TRACE_Dumping = 1;
+        TRACE_Recording = 0;
+    }
+    CPU_ExitCritical(Primask);
+
+    if(Error == Ok)
+    {
+        Events = (TRACE_Head < TRACE_BUFFER_EVENTS) ? TRACE_Head : TRACE_BUFFER_EVENTS;
+        TRACE_DumpNext = TRACE_Head - Events;
+        TRACE_DumpEnd = TRACE_Head;
+
+        TRACE_Header.Magic[0] = 'T';
+        TRACE_Header.Magic[1] = 'R';
+        TRACE_Header.Magic[2] = 'C';
+        TRACE_Header.Magic[3] = '1';
+        TRACE_Header.CyclesPerSecond = CLOCK_FREQUENCY_AHB;
+        TRACE_Header.Events = Events;
+        TRACE_Header.LostEvents = TRACE_Head - Events;
+
+        TRACE_TxBuffer.Data = (uint8_t*)&TRACE_Header;
+        TRACE_TxBuffer.Size = sizeof(TRACE_Header);
+        USART_RegisterCallBackFunction(TRACE_USART_CHANNEL, SEND, TRACE_SendNext);
+        if(USART_SendBufferZeroCopy(&TRACE_TxBuffer) != USART_enuOK)
+        {
+            TRACE_Dumping = 0;
+            TRACE_Recording = 1;
+            Error = NotOk;
+        }
+    }
+    return Error;
+}
+#endif
@@ -18,6 +18,8 @@
 #ifndef LCD_CFG_H_
 #define LCD_CFG_H_
 
+#include "../../../../COMMON/include/CPU.h"
+
 
 /****************************************************************************************/
 /*							Configuration Macros Declaration							*/
@@ -30,4 +32,80 @@
 #define	LCD_DATA_BITS_MODE		LCD_FOUR_BITS_MODE	
 /*****************************************************************************************/
 
+/* Description: The ID of RUNNABLE_LCD in the scheduler (RunnablesList_t), the driver suspends
+ * 				its runnable while it has no request and resumes it when a new request comes */
+
+#define	LCD_SCHED_RUNNABLE_ID	lcdRunnable
+/*****************************************************************************************/
+
+/* Description: The periodicity in microseconds of RUNNABLE_LCD in the scheduler, the driver
+ * 				counts the waits of the initialization in calls of the runnable, keep it equal to
+ * 				the runnable's periodicity (periodicityUS below 1 ms needs SCHED_TICK_US below 1000) */
+
+#define	LCD_RUNNABLE_PERIOD_US	1000
+/*****************************************************************************************/
+
+/* Description: The number of requests (clear, set cursor, write string, write number, command) the
+ * 				driver queues while it serves another one, from 1 to 255, each one takes 24 bytes of RAM */
+
+#define	LCD_REQUEST_QUEUE_SIZE	8
+/*****************************************************************************************/
+
+/* Description: The columns of each row kept in the shadow buffer of LCD_enuDrawString, from 1 to 40,
+ * 				16 for the visible columns of a 16 x 2 LCD or 40 for the whole row of the DDRAM,
+ * 				each column takes 4 bytes of RAM */
+
+#define	LCD_FRAME_COLUMNS		16
+/*****************************************************************************************/
+
+/* Description: Choose how the driver waits for the LCD to finish an instruction
+ * Options:		LCD_BUSY_FLAG_TIMED		the execution times of the datasheet are timed with the cycle
+ * 										counter, RW may be tied to ground
+ * 		or		LCD_BUSY_FLAG_POLLING	the busy flag is read on D7 with RW high before each write and
+ * 										at the end of a clear, RW must be wired to its pin */
+
+#define	LCD_BUSY_FLAG_MODE		LCD_BUSY_FLAG_TIMED
+/*****************************************************************************************/
+
+/* Description: The critical section of the requests queue, the PRIMASK is saved and the interrupts
+ * 				are masked so the Async functions can be called from an ISR */
+
+#define	LCD_ENTER_CRITICAL()		CPU_EnterCritical()
+#define	LCD_EXIT_CRITICAL(State)	CPU_ExitCritical(State)
+/*****************************************************************************************/
+
+/* Description: Choose what runs the steps of the requests
+ * Options:		LCD_ENGINE_RUNNABLE		RUNNABLE_LCD, called by the scheduler every LCD_RUNNABLE_PERIOD_US
+ * 		or		LCD_ENGINE_TIMER		the interrupt of the one-shot timer below (TIM2), started again after
+ * 										each write with the time the LCD takes to execute it, RUNNABLE_LCD
+ * 										suspends itself at its first call and the callbacks of the requests
+ * 										run in the interrupt */
+
+#define	LCD_ENGINE				LCD_ENGINE_RUNNABLE
+/*****************************************************************************************/
+
+/* Description: The one-shot timer of LCD_ENGINE_TIMER, LCD_TIMER_MIN_US is the shortest time it is
+ * 				started with (TIM2 takes 2 us at least) */
+
+#define	LCD_TIMER_MIN_US			10
+#define	LCD_TIMER_INIT(CallBack)	MTIM2_enuInit(CallBack)
+#define	LCD_TIMER_START(US)			MTIM2_enuStartOneShotUS(US)
+/*****************************************************************************************/
+
+/* Description: The time in microseconds RUNNABLE_LCD may take in one call, it runs the steps of the
+ * 				requests one after the other and waits for the LCD to execute a command or a character
+ * 				(up to 59 us) inside the call while the wait fits in what is left of the budget, a longer
+ * 				wait (a clear) ends the call. 0 runs one step per call, keep it under LCD_RUNNABLE_PERIOD_US */
+
+#define	LCD_STEP_BUDGET_US		200
+/*****************************************************************************************/
+
+/* Description: The cycle counter that times the steps of RUNNABLE_LCD, the DWT counts the core clock
+ * 				(the 16 MHz HSI), LCD_CYCLES_PER_US is its frequency in MHz */
+
+#define	LCD_CYCLES_PER_US		16
+#define	LCD_START_CYCLES()		CPU_StartCycleCounter()
+#define	LCD_GET_CYCLES()		CPU_GetCycles()
+/*****************************************************************************************/
+
 #endif /* LCD_CFG_H_ */
@@ -0,0 +1,7 @@
+#ifndef MCAL_MTIM2_MTIM2_CONFIG_H_
+#define MCAL_MTIM2_MTIM2_CONFIG_H_
+
+//define the clock of TIM2 (the APB1 timers clock), a multiple of 1 MHz as the timer counts microseconds
+#define TIM2_CLK_SRC 16000000
+
+#endif
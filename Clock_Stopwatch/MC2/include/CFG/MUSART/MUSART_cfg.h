@@ -15,4 +15,13 @@
 
 #define USART_CLK 16000000
 
+/* Options of USART_CALLBACK */
+#define USART_CALLBACK_IN_ISR 0
+#define USART_CALLBACK_DEFERRED 1
+
+/* Where the request and break callbacks run, USART_CALLBACK_DEFERRED hands them to the scheduler by
+   SCHED_enuDefer so the interrupt only moves the bytes (it still calls a callback the full queue cannot take),
+   USART_CALLBACK_IN_ISR calls them inside the interrupt */
+#define USART_CALLBACK USART_CALLBACK_DEFERRED
+
 #endif // USART_CFG_
@@ -13,6 +13,116 @@
 #ifndef SCHED_RUNNABLES_CFG_H_
 #define SCHED_RUNNABLES_CFG_H_
 
+/************************************************************************************/
+/*									Configurations									*/
+/************************************************************************************/
+
+/**
+ *@brief : Size of the runnables table, the runnables of arrayOfRunnables and the ones added
+ *		   in the runtime by SCHED_enuRegister (254 at most).
+ */
+#define SCHED_MAX_RUNNABLES		16
+
+/**
+ *@brief : Tick of the scheduler in us, 1000 or a divisor of it (500, 250, 100, ...) for the
+ *		   runnables faster than 1 ms. The periods and delays stay in ms and are converted to
+ *		   ticks, every tick costs a systick interrupt.
+ */
+#define SCHED_TICK_US		1000
+
+/**
+ *@brief : Measure every runnable with the DWT cycle counter.
+ *		   Options: SCHED_STATS_ENABLED, SCHED_STATS_DISABLED
+ */
+#define SCHED_STATS		SCHED_STATS_DISABLED
+
+/**
+ *@brief : Measure the busy and idle cycles of the CPU with the DWT cycle counter.
+ *		   Options: SCHED_LOAD_ENABLED, SCHED_LOAD_DISABLED
+ */
+#define SCHED_LOAD		SCHED_LOAD_DISABLED
+
+/**
+ *@brief : Lengths in ms of the two windows the load is measured over, a window must stay
+ *		   below 2^32 core clock cycles (10 s is 160M cycles at 16 MHz).
+ */
+#define SCHED_LOAD_SHORT_WINDOW_MS		1000
+#define SCHED_LOAD_LONG_WINDOW_MS		10000
+
+/**
+ *@brief : Time every call with the DWT cycle counter and check it against the budgetUS of the runnable,
+ *		   the default policy slows down a runnable that overran it SCHED_BUDGET_STRIKES times in a row.
+ *		   No runnable of arrayOfRunnables has a budgetUS yet.
+ *		   Options: SCHED_BUDGET_ENABLED, SCHED_BUDGET_DISABLED
+ */
+#define SCHED_BUDGET		SCHED_BUDGET_DISABLED
+
+/**
+ *@brief : Budget overruns in a row of a runnable that call the budget policy.
+ */
+#define SCHED_BUDGET_STRIKES		3
+
+/**
+ *@brief : A slowed down runnable is called at 1 of 2, 4 ... up to 1 of this many of its periodic releases,
+ *		   a power of 2.
+ */
+#define SCHED_BUDGET_MAX_SLOWDOWN		8
+
+/**
+ *@brief : Calls in a row within the budget that halve the slowdown of a runnable.
+ */
+#define SCHED_BUDGET_RECOVERY_RUNS		10
+
+/**
+ *@brief : How the releases are found, the list of the next releases walked at the ticks that
+ *		   release a runnable (the others only compare the time with the earliest release), the heap of
+ *		   the next releases or the table generated by tools/sched_table.py from arrayOfRunnables (run it
+ *		   again after changing the runnables). tools/sched_bench (host cycles, see
+ *		   COMMON/include/SCHED_CORE.h for the build) shows the same mean tick for both up to 20
+ *		   runnables and a lower mean and worst tick for the scan at 100. The table has no release
+ *		   counters, so the backlogPolicy, SCHED_enuRegister, SCHED_enuSetPeriod and SCHED_enuSleep are not used with it.
+ *		   Options: SCHED_DISPATCH_SCAN, SCHED_DISPATCH_HEAP, SCHED_DISPATCH_TABLE
+ */
+#define SCHED_DISPATCH		SCHED_DISPATCH_SCAN
+
+/**
+ *@brief : Priority of the work that the ISRs hand over by SCHED_enuDefer, in PendSV right after the ISR
+ *		   or in the super loop between the cooperative runnables.
+ *		   Options: SCHED_DEFER_PREEMPTIVE, SCHED_DEFER_COOPERATIVE
+ */
+#define SCHED_DEFER		SCHED_DEFER_PREEMPTIVE
+
+/**
+ *@brief : Slots of the deferred work queue, a power of 2, SCHED_enuDefer fails while all of them are waiting.
+ */
+#define SCHED_DEFER_QUEUE_SIZE		16
+
+/**
+ *@brief : Align the scheduler time on the sync frames of MC1 (SCHED_SYNC_MASTER on MC1) so the runnables
+ *		   that exchange the button frames keep the slots of their firstDelay (Switch_check, Recieve_Runnable),
+ *		   the receive callback gives the sync frames to SCHED_enuSync.
+ *		   Options: SCHED_SYNC_DISABLED, SCHED_SYNC_SLAVE
+ */
+#define SCHED_SYNC		SCHED_SYNC_DISABLED
+
+/**
+ *@brief : Period of the sync frames in ms, the same as SCHED_SYNC_PERIOD_MS of MC1.
+ */
+#define SCHED_SYNC_PERIOD_MS		200
+
+/**
+ *@brief : Time in us from the master tick that sends a sync frame to the call of SCHED_enuSync,
+ *		   one byte of 10 bits at 9600 baud.
+ */
+#define SCHED_SYNC_LATENCY_US		1042
+
+/**
+ *@brief : Phase errors up to this many ticks are left alone, the sync frame comes at any point of a tick
+ *		   so an aligned scheduler is measured 1 tick early or late too.
+ */
+#define SCHED_SYNC_DEADBAND_TICKS		1
+
+
 /************************************************************************************/
 /*							User-defined Types Declaration							*/
 /************************************************************************************/
@@ -26,6 +136,7 @@ typedef enum
 	Switch_check,
 	Switch_Debounce,
 	Clock_Runnable,
+	Clock_Display,
 	Stopwatch_Runnable,
 	Recieve_Runnable,
 
@@ -33,5 +144,18 @@ typedef enum
 	_RunnablesNumber_
 }RunnablesList_t;
 
+/**
+ *@brief : Write down the names of the events that the ISRs post by SCHED_postEvent (32 at most).
+ */
+typedef enum
+{
+	buttonReceivedEvent,
+	clockLcdDoneEvent,
+	clockSecondEvent,
+
+	/* DO NOT DELETE THIS ↓↓↓, please :)*/
+	_EventsNumber_
+}EventsList_t;
+
 
 #endif /* SCHED_RUNNABLES_CFG_H_ */
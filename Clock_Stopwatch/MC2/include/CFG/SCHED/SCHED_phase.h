@@ -0,0 +1,25 @@
+/******************************************************************************
+ *
+ * File Name: SCHED_phase.h
+ *
+ * Description: Phases of the runnables, generated by tools/sched_offsets.py from the
+ * 				WCETs in tools/mc2_wcet.txt, do not edit, run the tool again after changing the
+ * 				runnables or their WCETs.
+ *
+ *******************************************************************************/
+
+#ifndef SCHED_PHASE_H_
+#define SCHED_PHASE_H_
+
+/************************************************************************************/
+/*								Macros Declaration									*/
+/************************************************************************************/
+
+/* Extra first delay in ms of the runnables of src/CFG/SCHED/SCHED_config.c, worst tick load
+ * 125 us with all the phases 0, 65 us with these ones */
+#define SCHED_PHASE_Switch_Debounce			3
+#define SCHED_PHASE_Clock_Runnable			2
+#define SCHED_PHASE_Clock_Display			1
+#define SCHED_PHASE_Stopwatch_Runnable		0
+
+#endif /* SCHED_PHASE_H_ */
@@ -0,0 +1,44 @@
+/******************************************************************************
+ *
+ * File Name: SCHED_table.h
+ *
+ * Description: Release table of the runnables, generated by tools/sched_table.py
+ * 				from src/CFG/SCHED/SCHED_config.c, do not edit, run the tool again after changing
+ * 				the runnables.
+ *
+ *******************************************************************************/
+
+#ifndef SCHED_TABLE_H_
+#define SCHED_TABLE_H_
+
+/************************************************************************************/
+/*									Includes										*/
+/************************************************************************************/
+
+#include "LIB/STD_TYPES.h"
+
+/************************************************************************************/
+/*								Macros Declaration									*/
+/************************************************************************************/
+
+/* Number of runnables the table was generated for */
+#define SCHED_TABLE_RUNNABLES		7
+/* SCHED_TICK_US the table was generated for */
+#define SCHED_TABLE_TICK_US			1000
+/* Ticks before the repeated part (first delays and one-shot runnables) */
+#define SCHED_TABLE_PROLOGUE		308
+/* The prologue then one hyperperiod of 600 ticks */
+#define SCHED_TABLE_LENGTH			908
+/* Most runnables released at a single tick */
+#define SCHED_TABLE_PEAK_RELEASES	2
+
+/************************************************************************************/
+/*							User-defined Types Declaration							*/
+/************************************************************************************/
+
+typedef u8 SCHED_tableEntry_t;
+
+/* Bit n of entry t is set if the runnable with ID n is released at tick t */
+extern const SCHED_tableEntry_t SCHED_releaseTable [SCHED_TABLE_LENGTH];
+
+#endif /* SCHED_TABLE_H_ */
@@ -0,0 +1,78 @@
+#ifndef SCHED_CORE_CFG_H_
+#define SCHED_CORE_CFG_H_
+
+/************************************************************************************/
+/*									Configurations									*/
+/************************************************************************************/
+
+#include "LIB/STD_TYPES.h"
+#include "MCAL/MSYSTICK/MSYSTICK_interface.h"
+#include "SERVICES/SCHED/SCHED_interface.h"
+#include "../../../COMMON/include/CPU.h"
+#if (SCHED_DISPATCH == SCHED_DISPATCH_TABLE)
+#include "CFG/SCHED/SCHED_table.h"
+#endif
+
+/**
+ *@brief : Configuration of COMMON/SCHED_CORE for MC2, the runnables and the classes are the ones
+ *		   of SCHED_config.h and SCHED_interface.h.
+ */
+#define SCHED_CORE_MAX_RUNNABLES		SCHED_MAX_RUNNABLES
+#define SCHED_CORE_CLASSES				_SCHED_CLASSES_NUMBER_
+#define SCHED_CORE_QUEUE				((SCHED_DISPATCH == SCHED_DISPATCH_HEAP) ? SCHED_CORE_QUEUE_HEAP : SCHED_CORE_QUEUE_SCAN)
+
+/**
+ *@brief : Critical section of the core and of the kernel, PRIMASK is saved so they may be called from an ISR.
+ */
+#define SCHED_CORE_ENTER_CRITICAL()		CPU_EnterCritical()
+#define SCHED_CORE_EXIT_CRITICAL(state)	CPU_ExitCritical(state)
+
+/**
+ *@brief : Configuration of COMMON/SCHED_KERNEL for MC2, the options of SCHED_config.h. The systick fires
+ *		   every tick (no tickless mode) and MC2 has no trace.
+ */
+#define SCHED_KERNEL_TICK_US				SCHED_TICK_US
+/* The DWT counts the core clock which also feeds the systick */
+#define SCHED_KERNEL_CYCLES_PER_US			(CLK_SRC / 1000000)
+#define SCHED_KERNEL_MAX_SLEEP_MS			0
+
+#if (SCHED_DISPATCH == SCHED_DISPATCH_TABLE)
+#define SCHED_KERNEL_MODE					SCHED_KERNEL_MODE_TABLE
+#define SCHED_KERNEL_TABLE					SCHED_releaseTable
+#define SCHED_KERNEL_TABLE_LENGTH			SCHED_TABLE_LENGTH
+#define SCHED_KERNEL_TABLE_PROLOGUE			SCHED_TABLE_PROLOGUE
+#define SCHED_KERNEL_TABLE_RUNNABLES		SCHED_TABLE_RUNNABLES
+#else
+#define SCHED_KERNEL_MODE					SCHED_KERNEL_MODE_PERIODIC
+#endif
+
+#define SCHED_KERNEL_STATS					((SCHED_STATS == SCHED_STATS_ENABLED) ? SCHED_KERNEL_ENABLED : SCHED_KERNEL_DISABLED)
+#define SCHED_KERNEL_LOAD					((SCHED_LOAD == SCHED_LOAD_ENABLED) ? SCHED_KERNEL_ENABLED : SCHED_KERNEL_DISABLED)
+#define SCHED_KERNEL_LOAD_SHORT_WINDOW_MS	SCHED_LOAD_SHORT_WINDOW_MS
+#define SCHED_KERNEL_LOAD_LONG_WINDOW_MS	SCHED_LOAD_LONG_WINDOW_MS
+#define SCHED_KERNEL_BUDGET					((SCHED_BUDGET == SCHED_BUDGET_ENABLED) ? SCHED_KERNEL_ENABLED : SCHED_KERNEL_DISABLED)
+#define SCHED_KERNEL_BUDGET_STRIKES			SCHED_BUDGET_STRIKES
+#define SCHED_KERNEL_BUDGET_MAX_SLOWDOWN	SCHED_BUDGET_MAX_SLOWDOWN
+#define SCHED_KERNEL_BUDGET_RECOVERY_RUNS	SCHED_BUDGET_RECOVERY_RUNS
+#define SCHED_KERNEL_SLEEP					SCHED_KERNEL_ENABLED
+#define SCHED_KERNEL_DEFER					((SCHED_DEFER == SCHED_DEFER_PREEMPTIVE) ? SCHED_KERNEL_DEFER_PREEMPTIVE : SCHED_KERNEL_DEFER_COOPERATIVE)
+#define SCHED_KERNEL_DEFER_QUEUE_SIZE		SCHED_DEFER_QUEUE_SIZE
+#define SCHED_KERNEL_SYNC					((SCHED_SYNC == SCHED_SYNC_SLAVE) ? SCHED_KERNEL_SYNC_SLAVE : SCHED_KERNEL_SYNC_DISABLED)
+#define SCHED_KERNEL_SYNC_PERIOD_MS			SCHED_SYNC_PERIOD_MS
+#define SCHED_KERNEL_SYNC_LATENCY_US		SCHED_SYNC_LATENCY_US
+#define SCHED_KERNEL_SYNC_DEADBAND_TICKS	SCHED_SYNC_DEADBAND_TICKS
+
+#define SCHED_KERNEL_TIMER_INIT(callBack)	do { MSYSTICK_vidInit(); (void)MSYSTICK_enuSetCallback(callBack); } while (0)
+#define SCHED_KERNEL_TIMER_SET_US(us)		(void)MSYSTICK_enuSetTimeUS(us)
+#define SCHED_KERNEL_TIMER_START()			(void)MSYSTICK_enuStart(SYSTICK_PERIODIC)
+#define SCHED_KERNEL_PREEMPTIVE_INIT()		CPU_SetPendSVLowest()
+#define SCHED_KERNEL_PEND_PREEMPTIVE()		CPU_PendSV()
+#define SCHED_KERNEL_CYCLES_INIT()			CPU_StartCycleCounter()
+#define SCHED_KERNEL_CYCLES()				CPU_GetCycles()
+#define SCHED_KERNEL_IDLE_LOCK()			CPU_DisableInterrupts()
+#define SCHED_KERNEL_IDLE_WAIT()			CPU_WaitForInterrupt()
+#define SCHED_KERNEL_IDLE_UNLOCK()			CPU_EnableInterrupts()
+#define SCHED_KERNEL_TRACE(type, id, arg)
+#define SCHED_KERNEL_TRACE_PENDSV(type)
+
+#endif /* SCHED_CORE_CFG_H_ */
@@ -151,6 +151,23 @@ MGPIO_enuErrorStatus_t MGPIO_enuSetPinConfig (MGPIO_PIN_config_t* Add_strPinConf
  */
 MGPIO_enuErrorStatus_t MGPIO_enuSetPinValue(u32 Copy_u32Port, u32 Copy_u32Pin, u32 Copy_u32Value);
 
+/*
+ * Function: MGPIO_enuSetPortBits
+ * -------------------------------
+ * Description:
+ * Sets and resets several pins of the specified GPIO port at the same time with one write of its
+ * BSRR register. A pin in both masks is set.
+ *
+ * Parameters:
+ * - Copy_u32Port: The GPIO port number.
+ * - Copy_u32SetMask: The pins to set, bit n for the pin n.
+ * - Copy_u32ResetMask: The pins to reset, bit n for the pin n.
+ *
+ * Returns:
+ * - MGPIO_enuErrorStatus_t: Error status indicating the success or failure of setting the pins.
+ */
+MGPIO_enuErrorStatus_t MGPIO_enuSetPortBits(u32 Copy_u32Port, u32 Copy_u32SetMask, u32 Copy_u32ResetMask);
+
 /*
  * Function: MGPIO_getPinValue
  * ----------------------------
@@ -30,6 +30,7 @@ typedef enum{
     MSYSTICK_enuNOK                , // Enumeration for operation failure
     MSYSTICK_enuNULLPOINTER        , // Enumeration for NULL pointer error
     MSYSTICK_enuWRONG_TIMER_TYPE   , // Enumeration for wrong timer type error
+    MSYSTICK_enuWRONG_TIME         , // Enumeration for a time that does not fit the reload register
 }MSYSTICK_enuErrorStatus;            // Enumeration for error status
 
 /********************************************************************************************************/
@@ -49,6 +50,14 @@ void MSYSTICK_vidInit(void);
  */
 MSYSTICK_enuErrorStatus MSYSTICK_enuSetTimeMS(u32 Copy_u32MS_TIME);
 
+/**
+ * @brief Set the time in microseconds for SysTick timer, for the ticks shorter than 1 ms.
+ * 
+ * @param Copy_u32US_TIME: Time in microseconds
+ * @return MSYSTICK_enuErrorStatus: Status of the operation (OK or WRONG_TIME if it is 0 or longer than the 24-bit reload)
+ */
+MSYSTICK_enuErrorStatus MSYSTICK_enuSetTimeUS(u32 Copy_u32US_TIME);
+
 /**
  * @brief Start the SysTick timer.
  * 
@@ -0,0 +1,53 @@
+#ifndef MCAL_MTIM2_MTIM2_INTERFACE_H_
+#define MCAL_MTIM2_MTIM2_INTERFACE_H_
+
+/********************************************************************************************************/
+/************************************************Includes************************************************/
+/********************************************************************************************************/
+#include "LIB/STD_TYPES.h"
+#include "CFG/MTIM2/MTIM2_config.h"
+
+/********************************************************************************************************/
+/************************************************Defines*************************************************/
+/********************************************************************************************************/
+#define TIM2_MIN_TIME_US                 2          // Define the shortest one-shot time, the counter needs a reload of 1 at least
+
+/********************************************************************************************************/
+/************************************************Types***************************************************/
+/********************************************************************************************************/
+
+typedef void (*TIM2_CBF_t)(void);  // Define a function pointer type for TIM2 callback function
+
+typedef enum{
+    MTIM2_enuOK                 , // Enumeration for operation success
+    MTIM2_enuNOK                , // Enumeration for operation failure
+    MTIM2_enuNULLPOINTER        , // Enumeration for NULL pointer error
+    MTIM2_enuWRONG_TIME         , // Enumeration for a time shorter than TIM2_MIN_TIME_US
+}MTIM2_enuErrorStatus;            // Enumeration for error status
+
+/********************************************************************************************************/
+/************************************************APIs****************************************************/
+/********************************************************************************************************/
+
+/**
+ * @brief Initialize TIM2 as a one-shot timer counting microseconds, enable its clock and its interrupt.
+ *
+ * @param Copy_pfvCBFunc: Pointer to the function called in the interrupt when a one-shot time is over
+ * @return MTIM2_enuErrorStatus: Status of the operation (OK or NULLPOINTER)
+ */
+MTIM2_enuErrorStatus MTIM2_enuInit(void (*Copy_pfvCBFunc)(void));
+
+/**
+ * @brief Start a one-shot time of TIM2, a running one is restarted with the new time.
+ *
+ * @param Copy_u32US_TIME: Time in microseconds, from TIM2_MIN_TIME_US (the counter is 32 bits)
+ * @return MTIM2_enuErrorStatus: Status of the operation (OK or WRONG_TIME)
+ */
+MTIM2_enuErrorStatus MTIM2_enuStartOneShotUS(u32 Copy_u32US_TIME);
+
+/**
+ * @brief Stop TIM2, the callback of the running one-shot time isn't called.
+ */
+void MTIM2_vidStop(void);
+
+#endif
@@ -27,6 +27,41 @@
 
 
 
+/************************************************************************************/
+/*								Macros Declaration									*/
+/************************************************************************************/
+
+
+/* Options of SCHED_STATS in SCHED_config.h */
+#define SCHED_STATS_DISABLED		0
+#define SCHED_STATS_ENABLED			1
+
+/* Options of SCHED_LOAD in SCHED_config.h */
+#define SCHED_LOAD_DISABLED			0
+#define SCHED_LOAD_ENABLED			1
+
+/* Options of SCHED_BUDGET in SCHED_config.h */
+#define SCHED_BUDGET_DISABLED		0
+#define SCHED_BUDGET_ENABLED		1
+
+/* Options of SCHED_DISPATCH in SCHED_config.h */
+#define SCHED_DISPATCH_HEAP			0
+#define SCHED_DISPATCH_TABLE		1
+#define SCHED_DISPATCH_SCAN			2
+
+/* Options of SCHED_DEFER in SCHED_config.h */
+#define SCHED_DEFER_PREEMPTIVE		0
+#define SCHED_DEFER_COOPERATIVE		1
+
+/* Options of SCHED_SYNC in SCHED_config.h */
+#define SCHED_SYNC_DISABLED			0
+#define SCHED_SYNC_SLAVE			1
+
+/* Mask of an event of EventsList_t, masks of many events can be ORed */
+#define SCHED_EVENT_MASK(event)		(1UL << (event))
+
+
+
 /************************************************************************************/
 /*							User-defined types Declaration							*/
 /************************************************************************************/
@@ -35,15 +70,123 @@
  * and returns nothing (void) */
 typedef void (*runnableCB_t)(void);
 
+/* The type of the work that an ISR hands over by SCHED_enuDefer, the argument of SCHED_enuDefer
+ * is given back to it */
+typedef void (*deferredWork_t)(u32 arg);
+
+/* What the scheduler does with the releases of a runnable that were missed while the
+ * scheduler was late (after an overrun) */
+typedef enum{
+	/* Call the runnable once for every missed release (default) */
+	SCHED_BACKLOG_RUN_ALL,
+	/* Call the runnable once for all the missed releases */
+	SCHED_BACKLOG_COALESCE,
+	/* Drop the late releases and wait for the next period */
+	SCHED_BACKLOG_SKIP,
+}backlogPolicy_t;
+
+/* Priority class of a runnable, the preemptive runnables are called from the PendSV handler so they
+ * preempt the cooperative runnables of the super loop, they must be short and never wait for a
+ * cooperative runnable */
+typedef enum{
+	/* Run to completion in the super loop (default) */
+	SCHED_CLASS_COOPERATIVE,
+	/* Run to completion in PendSV, preempts the cooperative runnables */
+	SCHED_CLASS_PREEMPTIVE,
+
+	/* DO NOT DELETE THIS ↓↓↓, please :)*/
+	_SCHED_CLASSES_NUMBER_
+}schedClass_t;
+
 /* Structure that includes the necessary data for each runnable, You will need to define
- * each of these three members for each runnable in the array */
+ * each of these three members for each runnable in the array (periodicityMS 0 runs it once) */
 typedef struct{
 	char* name;
 	u32 periodicityMS;
 	u32 firstDelay;
 	runnableCB_t callBackFn;
+	backlogPolicy_t backlogPolicy;
+	/* Events that release the runnable at once, SCHED_EVENT_MASK(event) | ... */
+	u32 events;
+	schedClass_t schedClass;
+	/* Periodicity in us of a runnable faster than 1 ms (a multiple of SCHED_TICK_US), it replaces periodicityMS */
+	u32 periodicityUS;
+	/* Longest call in us before it is a budget overrun (0 has no budget), the systick, the preemptive
+	 * runnables and the ISRs that call SCHED_u32EnterISR in the middle of the call are taken off */
+	u32 budgetUS;
 }runnable_t;
 
+/* Error status of the scheduler's APIs */
+typedef enum{
+	SCHED_enuOk,
+	SCHED_enuNotOk,
+	SCHED_enuNullPointer,
+	SCHED_enuInvalidName,
+	SCHED_enuInvalidID,
+	SCHED_enuInvalidPeriod,
+	SCHED_enuTableFull,
+	SCHED_enuInvalidClass,
+	SCHED_enuInvalidWindow,
+	SCHED_enuQueueFull,
+}SCHED_enuErrorStatus_t;
+
+#if (SCHED_BUDGET == SCHED_BUDGET_ENABLED)
+/* What the scheduler does with a runnable that overran its budget SCHED_BUDGET_STRIKES times in a row,
+ * the runnable cannot be stopped in the middle of a call so the policy protects the other runnables
+ * from its next calls */
+typedef enum{
+	/* Keep calling it as it is */
+	SCHED_BUDGET_KEEP,
+	/* Call it at half of the periodic releases it is called at now */
+	SCHED_BUDGET_SLOW_DOWN,
+	/* Stop calling it till SCHED_enuResume */
+	SCHED_BUDGET_SUSPEND,
+}budgetAction_t;
+
+/* Budget policy, it gets the ID of the runnable and the number of its budget overruns since the start */
+typedef budgetAction_t (*budgetHook_t)(u32 runnableID, u32 overruns);
+#endif
+
+#if (SCHED_STATS == SCHED_STATS_ENABLED)
+/* Statistics of one runnable, all the values are in core clock cycles */
+typedef struct{
+	u32 runs;
+	u32 minExecCycles;
+	u32 maxExecCycles;
+	u32 meanExecCycles;
+	/* Delay between the release time of the runnable and the actual call */
+	u32 minStartJitter;
+	u32 maxStartJitter;
+	/* Calls that took longer than periodicityMS */
+	u32 overruns;
+}SCHED_runnableStats_t;
+#endif
+
+#if (SCHED_LOAD == SCHED_LOAD_ENABLED)
+/* The windows the CPU load is measured over */
+typedef enum{
+	/* SCHED_LOAD_SHORT_WINDOW_MS */
+	SCHED_LOAD_WINDOW_SHORT,
+	/* SCHED_LOAD_LONG_WINDOW_MS */
+	SCHED_LOAD_WINDOW_LONG,
+
+	/* DO NOT DELETE THIS ↓↓↓, please :)*/
+	_SCHED_LOAD_WINDOWS_NUMBER_
+}schedLoadWindow_t;
+
+/* CPU load of the last complete window, the cycles are core clock cycles and the utilisations are
+ * in 0.1 % (0 - 1000). Busy is the time in the dispatchers and the runnables of both classes,
+ * the other interrupts count as idle */
+typedef struct{
+	u32 busyCycles;
+	u32 idleCycles;
+	/* Busy share of the window */
+	u32 utilisation;
+	/* Busy share of the busiest tick of the window */
+	u32 peakTickUtilisation;
+}SCHED_load_t;
+#endif
+
 
 
 /************************************************************************************/
@@ -67,5 +210,167 @@ void SCHED_init(void);
 void SCHED_start(void);
 
 
+/**
+ *@brief : Function that posts events from an ISR (or anywhere), every active runnable subscribed to one
+ *		   of them by its events mask is called in the next dispatch without waiting for its period.
+ *@param : Mask of the posted events, SCHED_EVENT_MASK(event) | ...
+ *@return: void.
+ */
+void SCHED_postEvent(u32 events);
+
+
+/**
+ *@brief : Function that marks the entry of an ISR, its time till SCHED_exitISR is taken off the execution
+ *		   time of the runnable it interrupted, for the budget and the statistics. The systick and PendSV
+ *		   are marked by the scheduler.
+ *@param : void.
+ *@return: The mark to give to SCHED_exitISR.
+ */
+u32 SCHED_u32EnterISR(void);
+
+
+/**
+ *@brief : Function that marks the exit of the ISR, call it last in the ISR.
+ *@param : The value returned by SCHED_u32EnterISR.
+ *@return: void.
+ */
+void SCHED_exitISR(u32 mark);
+
+
+/**
+ *@brief : Function that queues a function from an ISR (or anywhere) instead of calling it there, the scheduler
+ *		   calls it with the priority of SCHED_DEFER in the order of the calls. It never masks the interrupts.
+ *@param : The function, the value given to it.
+ *@return: SCHED_enuOk, SCHED_enuNullPointer or SCHED_enuQueueFull (the work is dropped and counted).
+ */
+SCHED_enuErrorStatus_t SCHED_enuDefer(deferredWork_t work, u32 arg);
+
+
+/**
+ *@brief : Function that gets the number of works dropped by SCHED_enuDefer because the queue was full,
+ *		   SCHED_DEFER_QUEUE_SIZE must grow if it is not 0.
+ *@param : Pointer to the count.
+ *@return: SCHED_enuOk or SCHED_enuNullPointer.
+ */
+SCHED_enuErrorStatus_t SCHED_enuGetDeferDrops(u32* drops);
+
+#if (SCHED_SYNC == SCHED_SYNC_SLAVE)
+/**
+ *@brief : Function that aligns the scheduler time on the master, call it when a sync frame is received.
+ *		   The systick gives 2 ticks (or 0) to the dispatchers instead of 1 till the phase error is made up,
+ *		   so the runnables are released faster (or wait) for as many ticks as the error, never skipped.
+ *@param : void.
+ *@return: SCHED_enuOk.
+ */
+SCHED_enuErrorStatus_t SCHED_enuSync(void);
+#endif
+
+
+/**
+ *@brief : Function that adds a runnable in the runtime, it is released first after its firstDelay from now.
+ *@param : Pointer to the runnable (it is copied), pointer to the ID that the other APIs use.
+ *@return: SCHED_enuOk, SCHED_enuNullPointer, SCHED_enuInvalidClass or SCHED_enuTableFull
+ *		   (always SCHED_enuNotOk with SCHED_DISPATCH_TABLE).
+ */
+SCHED_enuErrorStatus_t SCHED_enuRegister(const runnable_t* runnable, u32* runnableID);
+
+
+/**
+ *@brief : Function that stops calling a runnable till SCHED_enuResume, it costs nothing while suspended.
+ *@param : The runnable's index in RunnablesList_t or the ID returned by SCHED_enuRegister.
+ *@return: SCHED_enuOk or SCHED_enuInvalidID.
+ */
+SCHED_enuErrorStatus_t SCHED_enuSuspend(u32 runnableID);
+
+
+/**
+ *@brief : Function that calls a suspended runnable again, it keeps its phase so it is released at the
+ *		   first (firstDelay + n * periodicityMS) that is not in the past.
+ *@param : The runnable's index in RunnablesList_t or the ID returned by SCHED_enuRegister.
+ *@return: SCHED_enuOk or SCHED_enuInvalidID.
+ */
+SCHED_enuErrorStatus_t SCHED_enuResume(u32 runnableID);
+
+
+/**
+ *@brief : Function that holds a runnable for a delay, it is not called by its period or by the events till
+ *		   the delay passes then its periodic releases continue from the wake time. A runnable that sleeps
+ *		   while it runs is released again at the wake time even if it has no periodicity, see SCHED_pt.h.
+ *@param : The runnable's index in RunnablesList_t or the ID returned by SCHED_enuRegister, the delay in ms
+ *		   (0 is not allowed).
+ *@return: SCHED_enuOk, SCHED_enuInvalidID, SCHED_enuInvalidPeriod or SCHED_enuNotOk with SCHED_DISPATCH_TABLE.
+ */
+SCHED_enuErrorStatus_t SCHED_enuSleep(u32 runnableID, u32 delayMS);
+
+
+/**
+ *@brief : Function that changes the periodicity of a runnable, the new value applies after its next release.
+ *@param : The runnable's index in RunnablesList_t or the ID returned by SCHED_enuRegister, the new
+ *		   periodicity in ms (0 is not allowed).
+ *@return: SCHED_enuOk, SCHED_enuInvalidID, SCHED_enuInvalidPeriod or SCHED_enuNotOk with SCHED_DISPATCH_TABLE.
+ */
+SCHED_enuErrorStatus_t SCHED_enuSetPeriod(u32 runnableID, u32 periodicityMS);
+
+
+/**
+ *@brief : Function that gets the number of releases of a runnable that were coalesced or skipped
+ *		   by its backlogPolicy.
+ *@param : The name of the runnable as written in arrayOfRunnables, pointer to the count.
+ *@return: SCHED_enuOk, SCHED_enuNullPointer or SCHED_enuInvalidName.
+ */
+SCHED_enuErrorStatus_t SCHED_enuGetMissedReleases(const char* name, u32* missedReleases);
+
+
+#if (SCHED_BUDGET == SCHED_BUDGET_ENABLED)
+/**
+ *@brief : Function that replaces the default budget policy (SCHED_BUDGET_SLOW_DOWN), the hook is called
+ *		   right after the call that made SCHED_BUDGET_STRIKES overruns in a row, NULL_PTR goes back to the
+ *		   default one. A slowed down runnable comes back by halves after SCHED_BUDGET_RECOVERY_RUNS calls
+ *		   in a row within its budget.
+ *@param : The budget policy.
+ *@return: void.
+ */
+void SCHED_setBudgetHook(budgetHook_t hook);
+
+
+/**
+ *@brief : Function that gets the number of calls of a runnable that took longer than its budgetUS.
+ *@param : The name of the runnable as written in arrayOfRunnables, pointer to the count.
+ *@return: SCHED_enuOk, SCHED_enuNullPointer or SCHED_enuInvalidName.
+ */
+SCHED_enuErrorStatus_t SCHED_enuGetBudgetOverruns(const char* name, u32* overruns);
+#endif
+
+
+#if (SCHED_STATS == SCHED_STATS_ENABLED)
+/**
+ *@brief : Function that gets the execution time and start jitter statistics of a runnable.
+ *@param : The name of the runnable as written in arrayOfRunnables, pointer to the statistics struct.
+ *@return: SCHED_enuOk, SCHED_enuNullPointer or SCHED_enuInvalidName.
+ */
+SCHED_enuErrorStatus_t SCHED_enuGetRunnableStats(const char* name, SCHED_runnableStats_t* stats);
+
+
+/**
+ *@brief : Function that gets the worst release latency of a class, the longest delay in core clock cycles
+ *		   between the release time of any runnable of the class and its call.
+ *@param : The class (SCHED_CLASS_COOPERATIVE or SCHED_CLASS_PREEMPTIVE), pointer to the latency.
+ *@return: SCHED_enuOk, SCHED_enuNullPointer or SCHED_enuInvalidClass.
+ */
+SCHED_enuErrorStatus_t SCHED_enuGetClassLatency(schedClass_t schedClass, u32* maxLatency);
+#endif
+
+
+#if (SCHED_LOAD == SCHED_LOAD_ENABLED)
+/**
+ *@brief : Function that gets the CPU load measured over the last complete window, to be shown on the
+ *		   LCD or sent over USART.
+ *@param : The window (SCHED_LOAD_WINDOW_SHORT or SCHED_LOAD_WINDOW_LONG), pointer to the load struct.
+ *@return: SCHED_enuOk, SCHED_enuNullPointer, SCHED_enuInvalidWindow or SCHED_enuNotOk if no window is complete yet.
+ */
+SCHED_enuErrorStatus_t SCHED_enuGetLoad(schedLoadWindow_t window, SCHED_load_t* load);
+#endif
+
+
 
 #endif /* SCHED_INTERFACE_H_ */
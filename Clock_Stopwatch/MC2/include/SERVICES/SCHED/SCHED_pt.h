@@ -0,0 +1,75 @@
+/******************************************************************************
+*
+* Module: Scheduler Driver.
+*
+* File Name: SCHED_pt.h
+*
+* Description: Stackless coroutines (protothreads) for the runnables, a runnable
+* 				written with them waits for a driver or for a time and continues
+* 				from the same line in its next call instead of counting its calls
+* 				in a switch.
+*
+* Author: Shaher Shah Abdalla Kamal
+*
+* Date:	15-03-2024
+*
+*******************************************************************************/
+
+
+#ifndef SCHED_PT_H_
+#define SCHED_PT_H_
+
+
+/************************************************************************************/
+/*									Includes										*/
+/************************************************************************************/
+
+
+#include "SERVICES/SCHED/SCHED_interface.h"
+
+
+
+/************************************************************************************/
+/*							User-defined types Declaration							*/
+/************************************************************************************/
+
+/* State of a coroutine, the line it waits at (0 before its first line).
+ * The coroutine is a switch on this line, so:
+ * 	- The local variables of the runnable are lost at every wait, keep them static or global.
+ * 	- A switch can not be written between SCHED_PT_BEGIN and SCHED_PT_END around a wait.
+ * 	- Only one wait can be written in a line of code. */
+typedef struct{
+	u16 line;
+}SCHED_pt_t;
+
+
+
+/************************************************************************************/
+/*								Macros Declaration									*/
+/************************************************************************************/
+
+
+/* Start the coroutine from its first line in the next call, it can be called from another runnable */
+#define SCHED_PT_INIT(pt)					((pt)->line = 0)
+
+/* The first and the last lines of the coroutine in the runnable, after the last line the coroutine
+ * starts again from its first line */
+#define SCHED_PT_BEGIN(pt)					switch ((pt)->line) { case 0:
+#define SCHED_PT_END(pt)					} (pt)->line = 0
+
+/* Return from the runnable and continue after this line in its next call */
+#define SCHED_PT_YIELD(pt)					do { (pt)->line = __LINE__; return; case __LINE__: ; } while (0)
+
+/* Return from the runnable in every call till the condition is true, subscribe the runnable to the event
+ * that the driver posts when the condition changes so it is called at once instead of waiting its period */
+#define SCHED_PT_WAIT_UNTIL(pt, condition)	do { (pt)->line = __LINE__; case __LINE__: if (!(condition)) { return; } } while (0)
+
+/* Start the coroutine again from its first line now */
+#define SCHED_PT_RESTART(pt)				do { (pt)->line = 0; return; } while (0)
+
+/* Hold the runnable by SCHED_enuSleep then continue after this line, it is not called at all meanwhile */
+#define SCHED_PT_SLEEP_MS(pt, runnableID, delayMS)	do { (void)SCHED_enuSleep((runnableID), (delayMS)); SCHED_PT_YIELD(pt); } while (0)
+
+
+
+#endif /* SCHED_PT_H_ */
@@ -20,6 +20,35 @@
 
 #include "MCAL/MUSART/MUSART_interface.h"
 #include "HAL/HLCD/HLCD_interface.h"
+#include "SERVICES/SCHED/SCHED_pt.h"
+
+
+
+/************************************************************************************/
+/*								Macros Declaration									*/
+/************************************************************************************/
+
+/* The cursor of the edit mode is set again to the place the user stopped at every this time */
+#define CLOCK_EDIT_CURSOR_REFRESH_MS		200
+
+/* The LCD requests of the whole screen of the date and time, it is drawn in the shadow buffer of
+ * the LCD and sent by one flush */
+#define CLOCK_SCREEN_REQUESTS				1
+
+/* 1 to show the hours and the minutes with digits two rows tall, the seconds and the date are drawn
+ * beside them, 0 for the rows "Date:" and "Time:". The edit mode uses the rows of text in both cases */
+#define CLOCK_BIG_DIGITS					1
+
+/* The columns of the big digits, of the separator between the hours and the minutes, and of the
+ * seconds and the date beside them */
+#define CLOCK_BIG_HOURS_COLUMN				LCD_enuColumn_1
+#define CLOCK_BIG_SEPARATOR_COLUMN			LCD_enuColumn_3
+#define CLOCK_BIG_MINUTES_COLUMN			LCD_enuColumn_4
+#define CLOCK_BIG_SECONDS_COLUMN			LCD_enuColumn_6
+#define CLOCK_BIG_DATE_COLUMN				LCD_enuColumn_7
+
+/* The middle dot of the character ROM of the LCD, one on each row makes the separator */
+#define CLOCK_BIG_SEPARATOR					0xA5
 
 
 
@@ -80,10 +109,21 @@ u8 setCursorNeedded = FALSE ;
 /* Counter that is responsible of updating the clock variables in the background */
 u32  entryCounter  = 0;
 
-/* Variable related to the updating of the clock during the displaying */
-u32  printCounter  = 0;
+/* Coroutines of the display of the date and time and of the cursor of the edit mode, the receive
+ * runnable starts them again by SCHED_PT_INIT when it changes the screen */
+SCHED_pt_t clockDisplayPt = {0};
+SCHED_pt_t editModePt = {0};
 
-u8 editModeCounter= 0 ;
+/* The seconds shown by the last screen */
+static u8 printedSeconds = 0;
+
+/* The date and time as they are drawn on the screen */
+static u8 timeString [] = "00:00:00";
+static u8 dateString [] = "00/00/0000";
+
+/* The separator and the seconds of the screen of big digits, the seconds clear the rest of their row */
+static u8 bigSeparatorString [] = {CLOCK_BIG_SEPARATOR, '\0'};
+static u8 bigSecondsString [] = ":00        ";
 
 /* Variables related to the date and time. Initially We are setting them as follows */
 u8 hours   = 6;
@@ -106,16 +146,116 @@ extern LCD_enuColumnNumber_t CurrentCol;
 
 
 /**
- *@brief : Dummy function that passed to any Asynchronus function.
+ *@brief : Callback of the LCD requests of the display, the LCD calls it when it finishes a request.
  *@param : void.
  *@return: void.
  */
-static void DummyCB(void)
+static void clockLcdDoneCB(void)
 {
+	/* Call the display runnable at once, the LCD has room for its next requests */
+	SCHED_postEvent(SCHED_EVENT_MASK(clockLcdDoneEvent));
+}
 
+
+/**
+ *@brief : Function that checks if the LCD takes a request now.
+ *@param : void.
+ *@return: TRUE if it is ready, FALSE if it is busy with a request.
+ */
+static u8 clockLcdReady(void)
+{
+	u8 ready = FALSE;
+	LCD_enuIsReady(&ready);
+	return ready;
 }
 
 
+/**
+ *@brief : Function that returns the number of requests the LCD queue takes now.
+ *@param : void.
+ *@return: The free places in the queue of the LCD.
+ */
+static u8 clockLcdFreeRequests(void)
+{
+	u8 freeRequests = 0;
+	LCD_enuGetFreeRequests(&freeRequests);
+	return freeRequests;
+}
+
+
+/**
+ *@brief : Function that writes a number as decimal digits with the leading zeros.
+ *@param : Where the digits are written, the number and the number of digits.
+ *@return: void.
+ */
+static void clockFormatDigits(u8* string, u16 number, u8 digits)
+{
+	while (digits > 0)
+	{
+		digits--;
+		string[digits] = '0' + (number % 10);
+		number /= 10;
+	}
+}
+
+
+/**
+ *@brief : Function that writes the date and time in the strings of the screen.
+ *@param : void.
+ *@return: void.
+ */
+static void clockFormatScreen(void)
+{
+	clockFormatDigits(&dateString[0], day, 2);
+	clockFormatDigits(&dateString[3], month, 2);
+	clockFormatDigits(&dateString[6], year, 4);
+	clockFormatDigits(&timeString[0], hours, 2);
+	clockFormatDigits(&timeString[3], minutes, 2);
+	clockFormatDigits(&timeString[6], seconds, 2);
+	clockFormatDigits(&bigSecondsString[1], seconds, 2);
+}
+
+
+/**
+ *@brief : Function that draws the rows "Date:" and "Time:" in the shadow buffer of the LCD, the edit
+ *		   mode moves the cursor over them.
+ *@param : void.
+ *@return: void.
+ */
+static void clockDrawTextScreen(void)
+{
+	LCD_enuDrawString(LCD_enuFirstRow,LCD_enuColumn_1,"Date: ");
+	LCD_enuDrawString(LCD_enuFirstRow,LCD_enuColumn_7,dateString);
+	LCD_enuDrawString(LCD_enuSecondRow,LCD_enuColumn_1,"Time:   ");
+	LCD_enuDrawString(LCD_enuSecondRow,LCD_enuColumn_9,timeString);
+}
+
+
+#if (CLOCK_BIG_DIGITS == 1)
+
+/**
+ *@brief : Function that draws the hours and the minutes with big digits in the shadow buffer of the LCD,
+ *		   with the date and the seconds beside them. The glyphs of a digit that didn't change are in the
+ *		   CGRAM already, so the flush uploads and writes only the glyphs of the digits that changed.
+ *@param : void.
+ *@return: void.
+ */
+static void clockDrawBigScreen(void)
+{
+	LCD_enuDrawBigDigit(CLOCK_BIG_HOURS_COLUMN, hours / 10);
+	LCD_enuDrawBigDigit(CLOCK_BIG_HOURS_COLUMN + 1, hours % 10);
+	LCD_enuDrawString(LCD_enuFirstRow,CLOCK_BIG_SEPARATOR_COLUMN,bigSeparatorString);
+	LCD_enuDrawString(LCD_enuSecondRow,CLOCK_BIG_SEPARATOR_COLUMN,bigSeparatorString);
+	LCD_enuDrawBigDigit(CLOCK_BIG_MINUTES_COLUMN, minutes / 10);
+	LCD_enuDrawBigDigit(CLOCK_BIG_MINUTES_COLUMN + 1, minutes % 10);
+	LCD_enuDrawString(LCD_enuFirstRow,CLOCK_BIG_SECONDS_COLUMN," ");
+	LCD_enuDrawString(LCD_enuFirstRow,CLOCK_BIG_DATE_COLUMN,dateString);
+	LCD_enuDrawString(LCD_enuSecondRow,CLOCK_BIG_SECONDS_COLUMN,bigSecondsString);
+}
+
+#endif  /* #if (CLOCK_BIG_DIGITS == 1) */
+
+
 
 /************************************************************************************/
 /*								Functions' Implementation							*/
@@ -123,7 +263,8 @@ static void DummyCB(void)
 
 
 /**
- *@brief : A runnable that comes every 10 milliseconds to update the date and time.
+ *@brief : A runnable that comes every 10 milliseconds to update the date and time, clockDisplayRunnable
+ *		   displays them.
  *@param : void.
  *@return: void.
  */
@@ -135,8 +276,9 @@ void clockRunnable(void)
 	/************************************************************************************/
 	if(entryCounter % 100 == 0)
 	{    
-		/* Every 1 second update the seconds variable */
+		/* Every 1 second update the seconds variable, and call the display runnable to show it */
 		seconds++;
+		SCHED_postEvent(SCHED_EVENT_MASK(clockSecondEvent));
 		if(seconds == 60)
 		{
 			/* If 60 seconds passed reset the seconds digits and increment the minutes digits by one */
@@ -188,480 +330,64 @@ void clockRunnable(void)
 
 	/* Increment the counter which is responsible of updating the date and time variables. */
 	entryCounter ++ ;
+}
 
-	/************************************************************************************/
-	/* 	The following part checks on the selected mode, if it is the CLOCK_MODE, it Will
-		display Date and Time after each update.
-		We are updating the whole screen once each one second, and the part of the hours, minutes,
-		seconds are being updated twice during the one second. */
-	/************************************************************************************/
+
+/**
+ *@brief : A runnable that displays the date and time in the CLOCK_MODE, and keeps the cursor at the
+ *		   place the user stopped at in the edit mode. It is called when the LCD finishes a request
+ *		   and when the seconds change, the whole screen is drawn in the shadow buffer of the LCD
+ *		   and one flush sends only the characters that changed.
+ *@param : void.
+ *@return: void.
+ */
+void clockDisplayRunnable(void)
+{
 	if(Mode == CLOCK_MODE )
-	{   
+	{
 		if(EditMode == NOT_ACTIVATED)
 		{
-			switch(printCounter)
-			{
-			/* The empty cases are because the LCD driver is not buffering the coming requests,
-			 * so We need to hold on the required time for each request from the LCD */
-			case 0:
-				LCD_enuSetCursorAsync(LCD_enuSecondRow,LCD_enuColumn_1,DummyCB);
-				printCounter ++;
-				break;
-			case 1:
-				printCounter ++;
-				break;
-			case 2:
-				LCD_enuWriteStringAsync("Time:   ",DummyCB);
-				printCounter ++;
-				break;
-			case 3:
-			case 4:
-			case 5:
-			case 6:
-			case 7:
-			case 8:
-			case 9:
-			case 10:
-			case 11:
-			case 12:
-			case 13:
-			case 14:
-				printCounter ++;
-				break;
-			case 15:
-				if (hours < 10)
-				{
-					LCD_enuWriteStringAsync("0",DummyCB);
-				}
-				else
-				{
-					LCD_enuWriteNumberAsync(hours,DummyCB);
-				}
-				printCounter ++;
-				break;
-			case 16:
-				printCounter ++;
-				break;
-			case 17:
-				if(hours < 10)
-				{
-					LCD_enuWriteNumberAsync(hours,DummyCB);
-				}
-				else
-				{
-
-				}
-				printCounter ++ ;
-				break;
-			case 18:
-				printCounter ++;
-				break;
-			case 19:
-				LCD_enuWriteStringAsync(":",DummyCB);
-				printCounter ++;
-				break;
-			case 20:
-				printCounter ++;
-				break;
-			case 21:
-				if (minutes < 10)
-				{
-					LCD_enuWriteStringAsync("0",DummyCB);
-				}
-				else
-				{
-					LCD_enuWriteNumberAsync(minutes,DummyCB);
-				}
-				printCounter ++;
-				break;
-			case 22:
-				printCounter ++;
-				break;
-			case 23:
-				if(minutes < 10)
-				{
-					LCD_enuWriteNumberAsync(minutes,DummyCB);
-				}
-				else
-				{
-
-				}
-				printCounter ++ ;
-				break;
-			case 24:
-				printCounter ++;
-				break;
-			case 25:
-				LCD_enuWriteStringAsync(":",DummyCB);
-				printCounter ++;
-				break;
-			case 26:
-				printCounter ++;
-				break;
-			case 27:
-				if (seconds < 10)
-				{
-					LCD_enuWriteStringAsync("0",DummyCB);
-				}
-				else
-				{
-					LCD_enuWriteNumberAsync(seconds,DummyCB);
-				}
-				printCounter ++;
-				break;
-			case 28:
-				printCounter ++;
-				break;
-			case 29:
-				if(seconds < 10)
-				{
-					LCD_enuWriteNumberAsync(seconds,DummyCB);
-				}
-				else
-				{
-
-				}
-				printCounter ++ ;
-				break;
-			case 30:
-				printCounter ++;
-				break;
-			case 31:
-				LCD_enuSetCursorAsync(LCD_enuFirstRow,LCD_enuColumn_1,DummyCB);
-				printCounter ++;
-				break;
-			case 32:
-				printCounter ++;
-				break;
-			case 33:
-				LCD_enuWriteStringAsync("Date: ",DummyCB);
-				printCounter ++;
-				break;
-			case 34:
-			case 35:
-			case 36:
-			case 37:
-			case 38:
-			case 39:
-			case 40:
-			case 41:
-			case 42:
-				printCounter ++;
-				break;
-			case 43:
-				if (day < 10)
-				{
-					LCD_enuWriteStringAsync("0",DummyCB);
-				}
-				else
-				{
-					LCD_enuWriteNumberAsync(day,DummyCB);
-				}
-				printCounter++;
-				break;
-			case 44:
-				printCounter++;
-				break;
-			case 45:
-				if (day < 10)
-				{
-					LCD_enuWriteNumberAsync(day,DummyCB);
-				}
-				else
-				{
-
-				}
-				printCounter++;
-				break;
-			case 46:
-				printCounter++;
-				break;
-			case 47:
-				LCD_enuWriteStringAsync("/",DummyCB);
-				printCounter++;
-				break;
-			case 48:
-				printCounter++;
-				break;
-			case 49:
-				if (month < 10)
-				{
-					LCD_enuWriteStringAsync("0",DummyCB);
-				}
-				else
-				{
-					LCD_enuWriteNumberAsync(month,DummyCB);
-				}
-				printCounter++;
-				break;
-			case 50:
-				printCounter++;
-				break;
-			case 51:
-				if (month < 10)
-				{
-					LCD_enuWriteNumberAsync(month,DummyCB);
-				}
-				else
-				{
-
-				}
-				printCounter++;
-				break;
-			case 52:
-				printCounter++;
-				break;
-			case 53:
-				LCD_enuWriteStringAsync("/",DummyCB);
-				printCounter++;
-				break;
-			case 54:
-				printCounter++;
-				break;
-			case 55:
-				if (year < 1000)
-				{
-					LCD_enuWriteStringAsync("0",DummyCB);
-				}
-				else if (year < 100)
-				{
-					LCD_enuWriteStringAsync("00",DummyCB);
-				}
-				else if (year < 10)
-				{
-					LCD_enuWriteStringAsync("000",DummyCB);
-				}
-				else if (year < 1)
-				{
-					LCD_enuWriteStringAsync("0000",DummyCB);
-				}
-				else
-				{
-					LCD_enuWriteNumberAsync(year,DummyCB);
-				}
-				printCounter++;
-				break;
-			case 56:
-			case 57:
-			case 58:
-			case 59:
-			case 60:
-			case 61:
-				printCounter++;
-				break;
-			case 62:
-				if (year < 1000)
-				{
-					LCD_enuWriteNumberAsync(year,DummyCB);
-				}
-				else if (year < 100)
-				{
-					LCD_enuWriteNumberAsync(year,DummyCB);
-				}
-				else if (year < 10)
-				{
-					LCD_enuWriteNumberAsync(year,DummyCB);
-				}
-				else if (year < 1)
-				{
-					LCD_enuWriteNumberAsync(year,DummyCB);
-				}
-				else
-				{
-
-				}
-				printCounter++;
-				break;
-			case 63:
-			case 64:
-			case 65:
-			case 66:
-				printCounter++;
-				break;
-			case 67:
-				LCD_enuSetCursorAsync(LCD_enuSecondRow,LCD_enuColumn_9,DummyCB);
-				printCounter++;
-				break;
-			case 68:
-				printCounter++;
-				break;
-			case 69:
-				if (hours < 10)
-				{
-					LCD_enuWriteStringAsync("0",DummyCB);
-				}
-				else
-				{
-					LCD_enuWriteNumberAsync(hours,DummyCB);
-				}
-				printCounter ++;
-				break;
-			case 70:
-				printCounter ++;
-				break;
-			case 71:
-				if(hours < 10)
-				{
-					LCD_enuWriteNumberAsync(hours,DummyCB);
-				}
-				else
-				{
-
-				}
-				printCounter ++ ;
-				break;
-			case 72:
-				printCounter ++;
-				break;
-			case 73:
-				LCD_enuWriteStringAsync(":",DummyCB);
-				printCounter ++;
-				break;
-			case 74:
-				printCounter ++;
-				break;
-			case 75:
-				if (minutes < 10)
-				{
-					LCD_enuWriteStringAsync("0",DummyCB);
-				}
-				else
-				{
-					LCD_enuWriteNumberAsync(minutes,DummyCB);
-				}
-				printCounter ++;
-				break;
-			case 76:
-				printCounter ++;
-				break;
-			case 77:
-				if(minutes < 10)
-				{
-					LCD_enuWriteNumberAsync(minutes,DummyCB);
-				}
-				else
-				{
-
-				}
-				printCounter ++ ;
-				break;
-			case 78:
-				printCounter ++;
-				break;
-			case 79:
-				LCD_enuWriteStringAsync(":",DummyCB);
-				printCounter ++;
-				break;
-			case 80:
-				printCounter ++;
-				break;
-			case 81:
-				if (seconds < 10)
-				{
-					LCD_enuWriteStringAsync("0",DummyCB);
-				}
-				else
-				{
-					LCD_enuWriteNumberAsync(seconds,DummyCB);
-				}
-				printCounter ++;
-				break;
-			case 82:
-				printCounter ++;
-				break;
-			case 83:
-				if(seconds < 10)
-				{
-					LCD_enuWriteNumberAsync(seconds,DummyCB);
-				}
-				else
-				{
-
-				}
-				printCounter ++ ;
-				break;
-			case 84:
-				printCounter ++;
-				break;
-			case 85:
-			case 86:
-			case 87:
-			case 88:
-			case 89:
-			case 90:
-			case 91:
-			case 92:
-			case 93:
-			case 94:
-			case 95:
-			case 96:
-			case 97:
-			case 98:
-				printCounter ++;
-				break;
-			case 99:
-				printCounter = 0;
-				break;
-			}
+			/* The whole screen is drawn once each second, when the seconds change, the flush sends the
+			 * digits that changed (mostly the seconds) and moves the cursor only to reach them */
+			SCHED_PT_BEGIN(&clockDisplayPt);
+			SCHED_PT_WAIT_UNTIL(&clockDisplayPt, clockLcdFreeRequests() >= CLOCK_SCREEN_REQUESTS);
+			printedSeconds = seconds;
+			clockFormatScreen();
+#if (CLOCK_BIG_DIGITS == 1)
+			clockDrawBigScreen();
+#else
+			clockDrawTextScreen();
+#endif
+			LCD_enuFlushAsync(clockLcdDoneCB);
+			SCHED_PT_WAIT_UNTIL(&clockDisplayPt, seconds != printedSeconds);
+			SCHED_PT_END(&clockDisplayPt);
 		}
 		else
 		{
 			/* When the edit mode is activated We need to set the cursor to the tens digit of the
 			 * days, and turning the cursor on without blinking and always make sure that the cursor
 			 * is at the place the user stopped at */
-			switch (editModeCounter)
+			SCHED_PT_BEGIN(&editModePt);
+			if(setCursorNeedded == TRUE)
 			{
-			case 0:
-			case 1:
-			case 2:
-			case 3:
-			case 4:
-			case 5:
-			case 6:
-			case 7:
-			case 8:
-			case 9:
-			case 10:
-			case 11:
-				editModeCounter ++ ;
-				break;
-			case 12:
-				if(setCursorNeedded == TRUE)
-				{
-					LCD_enuSetCursorAsync (LCD_enuFirstRow,LCD_enuColumn_7,DummyCB);
-				}
-				editModeCounter ++;
-				break;
-			case 13:
-			case 14:
-				editModeCounter ++ ;
-				break;
-			case 15:
-				if(setCursorNeedded == TRUE)
-				{
-					LCD_enuSendCommandAsync(LCD_DisplayON_CursorON_BlinkOFF,DummyCB);
-					setCursorNeedded = FALSE ;
-				}
-				editModeCounter ++;
-				break;
-			case 16:
-			case 17:
-				editModeCounter ++ ;
-				break;
-			case 18:
-				LCD_enuSetCursorAsync(CurrentRow,CurrentCol,DummyCB);
-				editModeCounter ++ ;
-				break;
-			case 19:
-			case 20:
-				editModeCounter ++ ;
-				break;
-			case 21:
-				editModeCounter = 0 ;
-				break;
+#if (CLOCK_BIG_DIGITS == 1)
+				/* The rows of text take the place of the big digits before the cursor moves over them */
+				SCHED_PT_WAIT_UNTIL(&editModePt, clockLcdFreeRequests() >= CLOCK_SCREEN_REQUESTS);
+				clockFormatScreen();
+				clockDrawTextScreen();
+				LCD_enuFlushAsync(clockLcdDoneCB);
+#endif
+				SCHED_PT_WAIT_UNTIL(&editModePt, clockLcdReady());
+				LCD_enuSetCursorAsync(LCD_enuFirstRow,LCD_enuColumn_7,clockLcdDoneCB);
+				SCHED_PT_WAIT_UNTIL(&editModePt, clockLcdReady());
+				LCD_enuSendCommandAsync(LCD_DisplayON_CursorON_BlinkOFF,clockLcdDoneCB);
+				setCursorNeedded = FALSE ;
 			}
+			SCHED_PT_WAIT_UNTIL(&editModePt, clockLcdReady());
+			LCD_enuSetCursorAsync(CurrentRow,CurrentCol,clockLcdDoneCB);
+			SCHED_PT_SLEEP_MS(&editModePt, Clock_Display, CLOCK_EDIT_CURSOR_REFRESH_MS);
+			SCHED_PT_END(&editModePt);
 		}
-
 	}
 	else
 	{
@@ -19,6 +19,7 @@
 /************************************************************************************/
 #include "MCAl/MUSART/MUSART_interface.h"
 #include "HAL/HLCD/HLCD_interface.h"
+#include "SERVICES/SCHED/SCHED_pt.h"
 
 
 
@@ -40,6 +41,10 @@
 
 #define CORRUPTED_MESSAGE			0xFF
 
+/* Frame that MC1 sends at the start of every sync period (SCHED_SYNC), its two nibbles differ so it
+ * is never taken for a button */
+#define SYNC_FRAME					0x5A
+
 /* These defines are used in edit mode to know which position did the user set the cursor,
  * We are only concerned with the editable positions. */
 #define DAY_TENS_POSITION			6
@@ -108,13 +113,10 @@ static u8 CursorPos = 0;
 
 /* Used flags */
 u8 receiveFlag = 0 ;
-extern u8 clearOnce ;
 extern u8 startFlag ;
 static u8 resetFlag = FALSE ;
-extern u8 stopwatchNotStarted ;
 static u8 buttonHandled = TRUE ;
 static OKSTATE OKState = NOT_PRESSED;
-extern u8 printEntireScreen ;
 
 /* Variables related to the date and time. */
 extern u8 hours ;
@@ -124,11 +126,10 @@ extern u8 day;
 extern u8 month;
 extern u16 year ;
 
-/* Variable related to the updating of the clock during the displaying */
-extern u32 printCounter;
-extern u32 S_LCD_Counter;
-extern u32 S_printCounter;
-extern u8 editModeCounter;
+/* Variable related to the updating of the clock and the stopwatch during the displaying */
+extern SCHED_pt_t clockDisplayPt;
+extern SCHED_pt_t editModePt;
+extern SCHED_pt_t stopwatchDisplayPt;
 
 /* Variables related to the date and time. Initially We are setting them as follows */
 extern u8  S_hours   ;
@@ -170,6 +171,12 @@ static void DummyCB(void)
 
 }
 
+/* The callback of the buffer, it re-arms the buffer after a sync frame */
+void receiveCallback (void);
+
+/* The buffer that would be received */
+USART_Req_t received_Bytes = {.length = 1, .buffer = recivedMessage, .USART_Peri = USART_Peri_1, .CB = receiveCallback};
+
 /**
  *@brief : Callback function which is called whenever the receiving done.
  *@param : void.
@@ -177,13 +184,27 @@ static void DummyCB(void)
  */
 void receiveCallback (void)
 {
+#if (SCHED_SYNC == SCHED_SYNC_SLAVE)
+	if (recivedMessage[0] == SYNC_FRAME)
+	{
+		/* Not a request, align the scheduler on it and wait for the next frame at once */
+		SCHED_enuSync();
+		USART_RXBufferAsyncZC(received_Bytes);
+	}
+	else
+	{
+		/* The button frames come right before the slot of receiveRunnable, no event is needed */
+		receiveFlag = 1 ;
+		buttonHandled = FALSE ;
+	}
+#else
 	receiveFlag = 1 ;
 	buttonHandled = FALSE ;
+	/* Handle the button now instead of waiting for the next period of receiveRunnable */
+	SCHED_postEvent(SCHED_EVENT_MASK(buttonReceivedEvent));
+#endif
 }
 
-/* The buffer that would be received */
-USART_Req_t received_Bytes = {.length = 1, .buffer = recivedMessage, .USART_Peri = USART_Peri_1, .CB = receiveCallback};
-
 
 
 /************************************************************************************/
@@ -288,7 +309,7 @@ void receiveRunnable(void)
 							}
 						}
 						LCD_enuWriteNumberAsync(day,DummyCB);
-						editModeCounter = 0;
+						SCHED_PT_INIT(&editModePt);
 						break;
 					case DAY_UNITS_POSITION:
 						/* The cursor now is at the position of the Days' units */
@@ -309,7 +330,7 @@ void receiveRunnable(void)
 							day++;
 						}
 						LCD_enuWriteNumberAsync(day%10,DummyCB);
-						editModeCounter = 0;
+						SCHED_PT_INIT(&editModePt);
 						break;
 					case MONTHS_TENS_POSITION:
 						if ((month == 1) || (month == 2))
@@ -325,7 +346,7 @@ void receiveRunnable(void)
 							month -= 10;
 						}
 						LCD_enuWriteNumberAsync(month,DummyCB);
-						editModeCounter = 0;
+						SCHED_PT_INIT(&editModePt);
 						break ;
 					case MONTHS_UNITS_POSITION:
 						if(month == 12)
@@ -337,27 +358,27 @@ void receiveRunnable(void)
 							month++;
 						}
 						LCD_enuWriteNumberAsync(month%10,DummyCB);
-						editModeCounter = 0;
+						SCHED_PT_INIT(&editModePt);
 						break;
 					case YEARS_THOUSANDS_POSITION:
 						year += 1000;
 						LCD_enuWriteNumberAsync(year,DummyCB);
-						editModeCounter = 0;
+						SCHED_PT_INIT(&editModePt);
 						break;
 					case YEARS_HUNDREDS_POSITION:
 						year += 100;
 						LCD_enuWriteNumberAsync(year%1000,DummyCB);
-						editModeCounter = 0;
+						SCHED_PT_INIT(&editModePt);
 						break;
 					case YEARS_TENS_POSITION:
 						year += 10;
 						LCD_enuWriteNumberAsync(year%100,DummyCB);
-						editModeCounter = 0;
+						SCHED_PT_INIT(&editModePt);
 						break;
 					case YEARS_UNITS_POSITION:
 						year += 1;
 						LCD_enuWriteNumberAsync(year%10,DummyCB);
-						editModeCounter = 0;
+						SCHED_PT_INIT(&editModePt);
 						break;
 					case HOURS_TENS_POSITION:
 						if ((hours >= 0) && (hours <= 13))
@@ -369,7 +390,7 @@ void receiveRunnable(void)
 							hours -= 10;
 						}
 						LCD_enuWriteNumberAsync(hours,DummyCB);
-						editModeCounter = 0;
+						SCHED_PT_INIT(&editModePt);
 						break;
 					case HOURS_UNITS_POSITION:
 						if((hours >= 0) && (hours <= 22))
@@ -381,7 +402,7 @@ void receiveRunnable(void)
 							/* Do Nothing as 23 is the last hour could be displayed in the hours digits */
 						}
 						LCD_enuWriteNumberAsync(hours%10,DummyCB);
-						editModeCounter = 0;
+						SCHED_PT_INIT(&editModePt);
 						break;
 					case MINUTES_TENS_POSITION:
 						if((minutes >= 0) && (minutes <= 49))
@@ -393,7 +414,7 @@ void receiveRunnable(void)
 							minutes -= 50;
 						}
 						LCD_enuWriteNumberAsync(minutes,DummyCB);
-						editModeCounter = 0;
+						SCHED_PT_INIT(&editModePt);
 						break;
 					case MINUTES_UNITS_POSITION:
 						if((minutes >= 0) && (minutes <= 58))
@@ -405,7 +426,7 @@ void receiveRunnable(void)
 							/* Do Nothing as 59 is the last minutes could be displayed in the minutes digits */
 						}
 						LCD_enuWriteNumberAsync(minutes%10,DummyCB);
-						editModeCounter = 0;
+						SCHED_PT_INIT(&editModePt);
 						break;
 					case SECONDS_TENS_POSITION:
 						if((seconds >= 0) && (seconds <= 49))
@@ -417,7 +438,7 @@ void receiveRunnable(void)
 							seconds -= 50;
 						}
 						LCD_enuWriteNumberAsync(seconds,DummyCB);
-						editModeCounter = 0;
+						SCHED_PT_INIT(&editModePt);
 						break;
 					case SECONDS_UNITS_POSITION:
 						if((seconds >= 0) && (seconds <= 58))
@@ -429,7 +450,7 @@ void receiveRunnable(void)
 							/* Do Nothing as 59 is the last seconds could be displayed in the seconds digits */
 						}
 						LCD_enuWriteNumberAsync(seconds%10,DummyCB);
-						editModeCounter = 0;
+						SCHED_PT_INIT(&editModePt);
 						break;
 					default:
 						/* You are in a position that you can not edit the data in it,
@@ -476,7 +497,7 @@ void receiveRunnable(void)
 							day -= 10;
 						}
 						LCD_enuWriteNumberAsync(day,DummyCB);
-						editModeCounter = 0;
+						SCHED_PT_INIT(&editModePt);
 						break;
 					case DAY_UNITS_POSITION:
 						if( day == 10 ||day == 20 ||day == 30 )
@@ -488,7 +509,7 @@ void receiveRunnable(void)
 							day--;
 						}
 						LCD_enuWriteNumberAsync(day%10,DummyCB);
-						editModeCounter = 0;
+						SCHED_PT_INIT(&editModePt);
 						break;
 					case MONTHS_TENS_POSITION:
 						if((month >= 1) && (month <= 10))
@@ -500,7 +521,7 @@ void receiveRunnable(void)
 							month -= 10;
 						}
 						LCD_enuWriteNumberAsync(month,DummyCB);
-						editModeCounter = 0;
+						SCHED_PT_INIT(&editModePt);
 						break ;
 					case MONTHS_UNITS_POSITION:
 						if((month == 1) || (month == 10))
@@ -513,7 +534,7 @@ void receiveRunnable(void)
 							month--;
 						}
 						LCD_enuWriteNumberAsync(month%10,DummyCB);
-						editModeCounter = 0;
+						SCHED_PT_INIT(&editModePt);
 						break;
 					case YEARS_THOUSANDS_POSITION:
 						if (year < 1000)
@@ -524,7 +545,7 @@ void receiveRunnable(void)
 						{
 							year -= 1000;
 						}LCD_enuWriteNumberAsync(year,DummyCB);
-						editModeCounter = 0;
+						SCHED_PT_INIT(&editModePt);
 						break;
 					case YEARS_HUNDREDS_POSITION:
 						if (year < 100)
@@ -536,7 +557,7 @@ void receiveRunnable(void)
 							year -= 100;
 						}
 						LCD_enuWriteNumberAsync(year%1000,DummyCB);
-						editModeCounter = 0;
+						SCHED_PT_INIT(&editModePt);
 						break;
 					case YEARS_TENS_POSITION:
 						if (year < 10)
@@ -548,7 +569,7 @@ void receiveRunnable(void)
 							year -= 10;
 						}
 						LCD_enuWriteNumberAsync(year%100,DummyCB);
-						editModeCounter = 0;
+						SCHED_PT_INIT(&editModePt);
 						break;
 					case YEARS_UNITS_POSITION:
 						if (year < 1)
@@ -560,7 +581,7 @@ void receiveRunnable(void)
 							year--;
 						}
 						LCD_enuWriteNumberAsync(year%10,DummyCB);
-						editModeCounter = 0;
+						SCHED_PT_INIT(&editModePt);
 						break;
 					case HOURS_TENS_POSITION:
 						if((hours >= 0) && (hours <= 9))
@@ -572,7 +593,7 @@ void receiveRunnable(void)
 							hours -= 10;
 						}
 						LCD_enuWriteNumberAsync(hours,DummyCB);
-						editModeCounter = 0;
+						SCHED_PT_INIT(&editModePt);
 						break;
 					case HOURS_UNITS_POSITION:
 						if((hours == 0) || (hours == 10) || (hours == 20))
@@ -584,7 +605,7 @@ void receiveRunnable(void)
 							hours--;
 						}
 						LCD_enuWriteNumberAsync(hours%10,DummyCB);
-						editModeCounter = 0;
+						SCHED_PT_INIT(&editModePt);
 						break;
 					case MINUTES_TENS_POSITION:
 						if((minutes >= 0) && (minutes <= 9))
@@ -596,7 +617,7 @@ void receiveRunnable(void)
 							minutes -= 10;
 						}
 						LCD_enuWriteNumberAsync(minutes,DummyCB);
-						editModeCounter = 0;
+						SCHED_PT_INIT(&editModePt);
 						break;
 					case MINUTES_UNITS_POSITION:
 						if((minutes % 10) == 0)
@@ -608,7 +629,7 @@ void receiveRunnable(void)
 							minutes--;
 						}
 						LCD_enuWriteNumberAsync(minutes%10,DummyCB);
-						editModeCounter = 0;
+						SCHED_PT_INIT(&editModePt);
 						break;
 					case SECONDS_TENS_POSITION:
 						if((seconds >= 0) && (seconds <= 9))
@@ -620,7 +641,7 @@ void receiveRunnable(void)
 							seconds -= 10;
 						}
 						LCD_enuWriteNumberAsync(seconds,DummyCB);
-						editModeCounter = 0;
+						SCHED_PT_INIT(&editModePt);
 						break;
 					case SECONDS_UNITS_POSITION:
 						if((seconds % 10) == 0)
@@ -632,7 +653,7 @@ void receiveRunnable(void)
 							seconds--;
 						}
 						LCD_enuWriteNumberAsync(seconds%10,DummyCB);
-						editModeCounter = 0;
+						SCHED_PT_INIT(&editModePt);
 						break;
 					default:
 						/* You are in a position that you can not edit the data in it,
@@ -697,13 +718,9 @@ void receiveRunnable(void)
 				{
 					Mode = STOPWATCH_MODE;
 					previousMode = CLOCK_MODE;
-					printCounter = 0;
-					S_printCounter = 0;
+					SCHED_PT_INIT(&clockDisplayPt);
+					SCHED_PT_INIT(&stopwatchDisplayPt);
 					recivedMessage [0] = 0;
-					if(stopwatchNotStarted == FALSE && printEntireScreen == TRUE)
-					{
-						stopwatchNotStarted = TRUE;
-					}
 				}
 				break;
 			case EDIT_BUTTON :
@@ -714,14 +731,14 @@ void receiveRunnable(void)
 					CurrentCol = LCD_enuColumn_7;
 					CurrentRow = LCD_enuFirstRow;
 					CursorPos  = 0;
-					editModeCounter = 0;
+					SCHED_PT_INIT(&editModePt);
 				}
 				else if (EditMode == ACTIVATED)
 				{
 					EditMode = NOT_ACTIVATED ;
 					OKState = NOT_PRESSED;
 					LCD_enuSendCommandAsync(LCD_DisplayON_CursorOFF_BlinkOFF,DummyCB);
-					printCounter = 97 ;
+					SCHED_PT_INIT(&clockDisplayPt);
 				}
 				break;
 			}
@@ -756,10 +773,6 @@ void receiveRunnable(void)
 				{
 					Mode = CLOCK_MODE;
 					previousMode = STOPWATCH_MODE;
-					clearOnce = FALSE ;
-
-					S_printCounter = 0;
-					S_LCD_Counter = 0;
 					recivedMessage[0]= 0 ;
 				}
 				break;
@@ -768,19 +781,16 @@ void receiveRunnable(void)
 				break;
 			case DOWN_STOP_BUTTON :
 				startFlag = FALSE;
-				S_printCounter = 0;
 				break;
 			case LEFT_RESET_BUTTON :
-				LCD_enuClearScreenAsync(DummyCB);
 				resetFlag = TRUE ;
 				startFlag = FALSE;
-				printEntireScreen = TRUE ;
-				S_LCD_Counter  = 0;
-				S_printCounter = 0;
 				S_hours   = 0;
 				S_minutes = 0;
 				S_seconds = 0;
 				S_milliseconds = 0;
+				/* The stopwatch screen is drawn again with the zeros at once */
+				SCHED_PT_INIT(&stopwatchDisplayPt);
 				break;
 
 			}
@@ -21,6 +21,24 @@
 
 #include "MCAL/MUSART/MUSART_interface.h"
 #include "HAL/HLCD/HLCD_interface.h"
+#include "SERVICES/SCHED/SCHED_pt.h"
+
+
+
+
+/************************************************************************************/
+/*								Macros Declaration									*/
+/************************************************************************************/
+
+/* The LCD requests of the whole screen of the stopwatch, it is drawn in the shadow buffer of the
+ * LCD and sent by one flush */
+#define STOPWATCH_SCREEN_REQUESTS			1
+
+/* The places of the digits in the string of the second row, which starts at the first column */
+#define STOPWATCH_HOURS_COLUMN				2
+#define STOPWATCH_MINUTES_COLUMN			5
+#define STOPWATCH_SECONDS_COLUMN			8
+#define STOPWATCH_MILLISECONDS_COLUMN		11
 
 
 
@@ -47,24 +65,6 @@ typedef enum
 	STOPWATCH_MODE
 }MODES;
 
-/**
- *@brief : The edit button status types
- */
-typedef enum
-{ 
-	NOT_ACTIVATED,
-	ACTIVATED
-}EDITMODES;
-
-/**
- *@brief : The Ok button status types
- */
-typedef enum
-{ 
-	NOT_PRESSED,
-	FIRST_PRESSED
-}OKSTATE;
-
 
 /************************************************************************************/
 /*								Variables's Declaration								*/
@@ -77,24 +77,26 @@ u8  S_minutes = 0;
 u8  S_seconds = 0;
 u16 S_milliseconds = 0;
 
-/* Variable related to the updating of the clock during the displaying */
-u32  S_LCD_Counter          = 0;
-u32  S_printCounter         = 0;
-
 /* Used flags */
-u8 printEntireScreen = TRUE;
 u8 startFlag = FALSE ;
-u8 stopFlag = FALSE ;
-u8 clearOnce = FALSE ;
-u8  stopwatchNotStarted = FALSE ;
 
+/* Coroutine of the display of the stopwatch, the receive runnable starts it again by SCHED_PT_INIT
+ * when it changes the screen or resets the stopwatch */
+SCHED_pt_t stopwatchDisplayPt = {0};
 
 extern MODES Mode ;
-extern MODES previousMode ;
 
 /* Counter that is responsible of updating the stopwatch variables in the background */
 static u32  entryCounter    = 0;
 
+/* The time shown by the last screen */
+static u8  printedSeconds = 0;
+static u16 printedMilliseconds = 0;
+
+/* The rows of the screen, each one covers the whole row so nothing of the clock screen stays */
+static u8 titleString [] = "   STOPWATCH    ";
+static u8 timeString [] = "  00:00:00:000  ";
+
 
 
 /************************************************************************************/
@@ -112,13 +114,48 @@ static void DummyCB(void)
 
 }
 
+
+/**
+ *@brief : Function that returns the number of requests the LCD queue takes now.
+ *@param : void.
+ *@return: The free places in the queue of the LCD.
+ */
+static u8 stopwatchLcdFreeRequests(void)
+{
+	u8 freeRequests = 0;
+	LCD_enuGetFreeRequests(&freeRequests);
+	return freeRequests;
+}
+
+
+/**
+ *@brief : Function that writes a number as decimal digits with the leading zeros.
+ *@param : Where the digits are written, the number and the number of digits.
+ *@return: void.
+ */
+static void stopwatchFormatDigits(u8* string, u16 number, u8 digits)
+{
+	while (digits > 0)
+	{
+		digits--;
+		string[digits] = '0' + (number % 10);
+		number /= 10;
+	}
+}
+
+
+
 /************************************************************************************/
 /*								Functions' Implementation							*/
 /************************************************************************************/
 
 
 /**
- *@brief : A runnable that comes every 20 milliseconds to update the stopwatch.
+ *@brief : A runnable that comes every 20 milliseconds to update the stopwatch, and displays it in the
+ *		   STOPWATCH_MODE. The whole screen is drawn in the shadow buffer of the LCD when the time
+ *		   changes and one flush sends only the digits that changed. It is not subscribed to the LCD
+ *		   events as every call counts 20 milliseconds, a screen the LCD has no room for waits for the
+ *		   next call.
  *@param : void.
  *@return: void.
  */
@@ -166,655 +203,28 @@ void StopwatchRunnable(void)
 
 	/************************************************************************************/
 	/* 	The following part checks on the selected mode, if it is the STOPWATCH_MODE, it Will
-		display the updated values of the stopwatch. */
+		display the stopwatch each time it changes */
 	/************************************************************************************/
-	if((Mode == STOPWATCH_MODE) && ((printEntireScreen == FALSE) && (startFlag == TRUE) || (stopwatchNotStarted == FALSE)))
+	if(Mode == STOPWATCH_MODE)
 	{
-		switch(S_printCounter)
-		{
-		/* The empty cases are because the LCD driver is not buffering the coming requests,
-		* so We need to hold on the required time for each request from the LCD */
-		case 0:
-			if(clearOnce == FALSE)
-			{
-				LCD_enuClearScreenAsync(DummyCB);
-				clearOnce = TRUE ;
-			}
-			S_printCounter ++ ;
-			break ;
-		case 1 :
-			if (previousMode == CLOCK_MODE)
-			{
-				LCD_enuSetCursorAsync  (LCD_enuFirstRow,LCD_enuColumn_4 ,DummyCB);
-			}
-			else
-			{
-				LCD_enuSetCursorAsync(LCD_enuSecondRow,LCD_enuColumn_3,DummyCB);
-			}
-			S_printCounter ++;
-			break;
-		case 2 :
-			if (previousMode == CLOCK_MODE)
-			{
-				LCD_enuWriteStringAsync("STOPWATCH",DummyCB);
-			}
-			else
-			{
-				if (S_hours < 10)
-				{
-					LCD_enuWriteStringAsync("0",DummyCB);
-				}
-				else
-				{
-					LCD_enuWriteNumberAsync(S_hours,DummyCB);
-				}
-			}
-			S_printCounter ++;
-			break;
-		case 3:
-		case 4:
-		case 5:
-		case 6:
-			S_printCounter ++;
-			break;
-		case 7:
-			if (previousMode == CLOCK_MODE)
-			{
-				LCD_enuSetCursorAsync(LCD_enuSecondRow,LCD_enuColumn_3,DummyCB);
-			}
-			else
-			{
-				if(S_hours < 10)
-				{
-					LCD_enuWriteNumberAsync(S_hours,DummyCB);
-				}
-				else
-				{
-
-				}
-			}
-			S_printCounter ++;
-			break;
-		case 8:
-			S_printCounter ++;
-			break;
-		case 9:
-			if (previousMode == CLOCK_MODE)
-			{
-				if (S_hours < 10)
-				{
-					LCD_enuWriteStringAsync("0",DummyCB);
-				}
-				else
-				{
-					LCD_enuWriteNumberAsync(S_hours,DummyCB);
-				}
-			}
-			else
-			{
-				LCD_enuWriteStringAsync(":",DummyCB);
-			}
-			S_printCounter ++;
-			break;
-		case 10:
-			S_printCounter ++;
-			break;
-		case 11:
-			if (previousMode == CLOCK_MODE)
-			{
-				if(S_hours < 10)
-				{
-					LCD_enuWriteNumberAsync(S_hours,DummyCB);
-				}
-				else
-				{
-
-				}
-			}
-			else
-			{
-				if (S_minutes < 10)
-				{
-					LCD_enuWriteStringAsync("0",DummyCB);
-				}
-				else
-				{
-					LCD_enuWriteNumberAsync(S_minutes,DummyCB);
-				}
-			}
-			S_printCounter ++;
-			break;
-		case 12:
-			S_printCounter ++;
-			break;
-		case 13:
-			LCD_enuSetCursorAsync(LCD_enuSecondRow,LCD_enuColumn_12,DummyCB);
-			S_printCounter ++;
-			break;
-		case 14:
-			if(S_milliseconds == 0)
-			{
-				LCD_enuWriteStringAsync("000",DummyCB);
-			}
-			else
-			{
-				LCD_enuWriteNumberAsync(S_milliseconds,DummyCB);
-			}
-			S_printCounter ++;
-			break;
-		case 15:
-			S_printCounter ++;
-			break;
-		case 16:
-			if (previousMode == CLOCK_MODE)
-			{
-				LCD_enuSetCursorAsync(LCD_enuSecondRow,LCD_enuColumn_5,DummyCB);
-			}
-			else
-			{
-				if (S_minutes < 10)
-				{
-					LCD_enuSetCursorAsync(LCD_enuSecondRow,LCD_enuColumn_7,DummyCB);
-				}
-				else
-				{
-					LCD_enuSetCursorAsync(LCD_enuSecondRow,LCD_enuColumn_8,DummyCB);
-				}
-			}
-			S_printCounter ++;
-			break;
-		case 17:
-			S_printCounter ++;
-			break;
-		case 18:
-			if (previousMode == CLOCK_MODE)
-			{
-				LCD_enuWriteStringAsync(":",DummyCB);
-			}
-			else
-			{
-				if(S_minutes < 10)
-				{
-					LCD_enuWriteNumberAsync(S_minutes,DummyCB);
-				}
-				else
-				{
-
-				}
-			}
-			S_printCounter ++;
-			break;
-		case 19:
-			S_printCounter ++;
-			break;
-		case 20:
-			if (previousMode == CLOCK_MODE)
-			{
-				if (S_minutes < 10)
-				{
-					LCD_enuWriteStringAsync("0",DummyCB);
-				}
-				else
-				{
-					LCD_enuWriteNumberAsync(S_minutes,DummyCB);
-				}
-			}
-			else
-			{
-				LCD_enuWriteStringAsync(":",DummyCB);
-			}
-			S_printCounter ++;
-			break;
-		case 21:
-			S_printCounter ++;
-			break;
-		case 22:
-			LCD_enuSetCursorAsync(LCD_enuSecondRow,LCD_enuColumn_12,DummyCB);
-			S_printCounter ++;
-			break;
-		case 23:
-			if(S_milliseconds == 0)
-			{
-				LCD_enuWriteStringAsync("000",DummyCB);
-			}
-			else
-			{
-				LCD_enuWriteNumberAsync(S_milliseconds,DummyCB);
-			}
-			S_printCounter ++;
-			break;
-		case 24:
-			S_printCounter ++;
-			break;
-		case 25 :
-			if (previousMode == CLOCK_MODE)
-			{
-				if (S_minutes < 10)
-				{
-					LCD_enuSetCursorAsync(LCD_enuSecondRow,LCD_enuColumn_7,DummyCB);
-				}
-				else
-				{
-					LCD_enuSetCursorAsync(LCD_enuSecondRow,LCD_enuColumn_8,DummyCB);
-				}
-			}
-			else
-			{
-				LCD_enuSetCursorAsync(LCD_enuSecondRow,LCD_enuColumn_9,DummyCB);
-			}
-			S_printCounter ++;
-			break;
-		case 26:
-			if (previousMode == CLOCK_MODE)
-			{
-				if(S_minutes < 10)
-				{
-					LCD_enuWriteNumberAsync(S_minutes,DummyCB);
-				}
-				else
-				{
-
-				}
-			}
-			else
-			{
-				if (S_seconds < 10)
-				{
-					LCD_enuWriteStringAsync("0",DummyCB);
-				}
-				else
-				{
-					LCD_enuWriteNumberAsync(S_seconds,DummyCB);
-				}
-			}
-			S_printCounter ++;
-			break;
-		case 27:
-			S_printCounter ++;
-			break;
-		case 28:
-			LCD_enuSetCursorAsync(LCD_enuSecondRow,LCD_enuColumn_12,DummyCB);
-			S_printCounter ++;
-			break;
-		case 29:
-			if(S_milliseconds == 0)
-			{
-				LCD_enuWriteStringAsync("000",DummyCB);
-			}
-			else
-			{
-				LCD_enuWriteNumberAsync(S_milliseconds,DummyCB);
-			}
-			S_printCounter ++;
-			break;
-		case 30:
-			S_printCounter ++;
-			break;
-		case 31:
-			if (previousMode == CLOCK_MODE)
-			{
-				LCD_enuSetCursorAsync(LCD_enuSecondRow,LCD_enuColumn_8,DummyCB);
-			}
-			else
-			{
-				if (S_seconds < 10)
-				{
-					LCD_enuSetCursorAsync(LCD_enuSecondRow,LCD_enuColumn_9,DummyCB);
-				}
-				else
-				{
-					LCD_enuSetCursorAsync(LCD_enuSecondRow,LCD_enuColumn_11,DummyCB);
-				}
-			}
-			S_printCounter ++;
-			break;
-		case 32:
-			if (previousMode == CLOCK_MODE)
-			{
-				LCD_enuWriteStringAsync(":",DummyCB);
-			}
-			else
-			{
-				if(S_seconds < 10)
-				{
-					LCD_enuWriteNumberAsync(S_seconds,DummyCB);
-				}
-				else
-				{
-
-				}
-			}
-			S_printCounter ++;
-			break;
-		case 33:
-			S_printCounter ++;
-			break;
-		case 34:
-			if (previousMode == CLOCK_MODE)
-			{
-				if (S_seconds < 10)
-				{
-					LCD_enuWriteStringAsync("0",DummyCB);
-				}
-				else
-				{
-					LCD_enuWriteNumberAsync(S_seconds,DummyCB);
-				}
-			}
-			else
-			{
-				LCD_enuWriteStringAsync(":",DummyCB);
-			}
-			S_printCounter ++;
-			break;
-		case 35:
-			S_printCounter ++;
-			break;
-		case 36:
-			if (previousMode == CLOCK_MODE)
-			{
-				if(S_seconds < 10)
-				{
-					LCD_enuWriteNumberAsync(S_seconds,DummyCB);
-				}
-				else
-				{
-
-				}
-			}
-			else
-			{
-				if(S_milliseconds == 0)
-				{
-					LCD_enuWriteStringAsync("000",DummyCB);
-				}
-				else
-				{
-					LCD_enuWriteNumberAsync(S_milliseconds,DummyCB);
-				}
-			}
-			S_printCounter ++;
-			break;
-		case 37:
-			S_printCounter++;
-			break;
-		case 38:
-			LCD_enuSetCursorAsync(LCD_enuSecondRow,LCD_enuColumn_12,DummyCB);
-			S_printCounter ++;
-			break;
-		case 39:
-			if(S_milliseconds == 0)
-			{
-				LCD_enuWriteStringAsync("000",DummyCB);
-			}
-			else
-			{
-				LCD_enuWriteNumberAsync(S_milliseconds,DummyCB);
-			}
-			S_printCounter ++;
-			break;
-		case 40:
-			S_printCounter ++;
-			break;
-		case 41:
-			if (previousMode == CLOCK_MODE)
-			{
-				LCD_enuSetCursorAsync(LCD_enuSecondRow,LCD_enuColumn_11,DummyCB);
-			}
-			else
-			{
-
-			}
-			S_printCounter ++;
-
-			break;
-		case 42 :
-			if (previousMode == CLOCK_MODE)
-			{
-				LCD_enuWriteStringAsync(":",DummyCB);
-			}
-			else
-			{
-
-			}
-			S_printCounter ++;
-			break;
-		case 43:
-			if (previousMode == CLOCK_MODE)
-			{
-				if(S_milliseconds == 0)
-				{
-					LCD_enuWriteStringAsync("000",DummyCB);
-				}
-				else
-				{
-					LCD_enuWriteNumberAsync(S_milliseconds,DummyCB);
-				}
-				//previousMode = STOPWATCH_MODE;
-			}
-			else
-			{
-
-			}
-			S_printCounter ++;
-			break;
-		case 44 :
-			S_printCounter ++;
-			break;
-		case 45:
-			LCD_enuSetCursorAsync(LCD_enuSecondRow,LCD_enuColumn_12,DummyCB);
-			S_printCounter ++;
-			break;
-		case 46:
-			if(S_milliseconds == 0)
-			{
-				LCD_enuWriteStringAsync("000",DummyCB);
-			}
-			else
-			{
-				LCD_enuWriteNumberAsync(S_milliseconds,DummyCB);
-			}
-			S_printCounter ++;
-			break;
-		case 47:
-		case 48:
-			S_printCounter ++;
-			break;
-		case 49:
-			LCD_enuSetCursorAsync(LCD_enuSecondRow,LCD_enuColumn_12,DummyCB);
-			S_printCounter ++;
-			break;
-		case 50:
-			if(S_milliseconds == 0)
-			{
-				LCD_enuWriteStringAsync("000",DummyCB);
-			}
-			else
-			{
-				LCD_enuWriteNumberAsync(S_milliseconds,DummyCB);
-			}
-			S_printCounter ++;
-			break;
-		case 51:
-		case 52:
-			S_printCounter ++;
-			break;
-		case 53:
-			LCD_enuSetCursorAsync(LCD_enuSecondRow,LCD_enuColumn_12,DummyCB);
-			S_printCounter ++;
-			break;
-		case 54:
-			if(S_milliseconds == 0)
-			{
-				LCD_enuWriteStringAsync("000",DummyCB);
-			}
-			else
-			{
-				LCD_enuWriteNumberAsync(S_milliseconds,DummyCB);
-			}
-			S_printCounter ++;
-			break;
-		case 55:
-			S_printCounter ++;
-			break;
-		case 56:
-			LCD_enuSetCursorAsync(LCD_enuSecondRow,LCD_enuColumn_12,DummyCB);
-			S_printCounter ++;
-			break;
-		case 57:
-			if(S_milliseconds == 0)
-			{
-				LCD_enuWriteStringAsync("000",DummyCB);
-			}
-			else
-			{
-				LCD_enuWriteNumberAsync(S_milliseconds,DummyCB);
-			}
-			S_printCounter ++;
-			break;
-		case 58:
-			S_printCounter ++;
-			break;
-		case 59:
-			LCD_enuSetCursorAsync(LCD_enuSecondRow, LCD_enuColumn_9, DummyCB);
-			S_printCounter ++;
-			break;
-		case 60:
-			if (S_seconds < 10)
-			{
-				LCD_enuWriteStringAsync("0", DummyCB);
-			}
-			else
-			{
-				LCD_enuWriteNumberAsync(S_seconds, DummyCB);
-			}
-			S_printCounter ++;
-			break;
-		case 61:
-			S_printCounter ++;
-			break;
-		case 62:
-			if (S_seconds < 10)
-			{
-				LCD_enuWriteNumberAsync(S_seconds, DummyCB);
-			}
-			else
-			{
-
-			}
-			S_printCounter ++;
-			break;
-		case 63:
-			S_printCounter ++;
-			break;
-		case 64:
-			LCD_enuSetCursorAsync(LCD_enuSecondRow,LCD_enuColumn_12,DummyCB);
-			S_printCounter ++;
-			break;
-		case 65:
-			if(S_milliseconds == 0)
-			{
-				LCD_enuWriteStringAsync("000",DummyCB);
-			}
-			else
-			{
-				LCD_enuWriteNumberAsync(S_milliseconds,DummyCB);
-			}
-			S_printCounter ++;
-			break;
-		case 66:
-		case 67:
-			S_printCounter ++;
-			break;
-		case 68:
-			S_printCounter =0;
-			break;
-		}
+		SCHED_PT_BEGIN(&stopwatchDisplayPt);
+		SCHED_PT_WAIT_UNTIL(&stopwatchDisplayPt, stopwatchLcdFreeRequests() >= STOPWATCH_SCREEN_REQUESTS);
+		printedSeconds = S_seconds;
+		printedMilliseconds = S_milliseconds;
+		stopwatchFormatDigits(&timeString[STOPWATCH_HOURS_COLUMN], S_hours, 2);
+		stopwatchFormatDigits(&timeString[STOPWATCH_MINUTES_COLUMN], S_minutes, 2);
+		stopwatchFormatDigits(&timeString[STOPWATCH_SECONDS_COLUMN], S_seconds, 2);
+		stopwatchFormatDigits(&timeString[STOPWATCH_MILLISECONDS_COLUMN], S_milliseconds, 3);
+		LCD_enuDrawString(LCD_enuFirstRow,LCD_enuColumn_1,titleString);
+		LCD_enuDrawString(LCD_enuSecondRow,LCD_enuColumn_1,timeString);
+		LCD_enuFlushAsync(DummyCB);
+		/* The milliseconds change at every step of 100 ms, the seconds tell a whole second missed while
+		 * the LCD was busy */
+		SCHED_PT_WAIT_UNTIL(&stopwatchDisplayPt, (S_milliseconds != printedMilliseconds) || (S_seconds != printedSeconds));
+		SCHED_PT_END(&stopwatchDisplayPt);
 	}
-	/************************************************************************************/
-	/* 	The following part checks on the selected mode, if it is the STOPWATCH_MODE, it Will
-		display the initial state of the stopwatch */
-	/************************************************************************************/
-	if(Mode == STOPWATCH_MODE)
-	{  
-		if(printEntireScreen == TRUE || ((startFlag == FALSE) && (stopwatchNotStarted == TRUE)))
-		{
-			switch(S_LCD_Counter)
-			{
-			case 0:
-			case 1:
-			case 2:
-				S_LCD_Counter++;
-				break;
-			case 3:
-				LCD_enuClearScreenAsync(DummyCB);
-				S_LCD_Counter++;
-				break;
-			case 4:
-				LCD_enuSetCursorAsync  (LCD_enuFirstRow,LCD_enuColumn_4 ,DummyCB);
-				S_LCD_Counter ++ ;
-				break;
-			case 5:
-				LCD_enuWriteStringAsync("STOPWATCH",DummyCB);
-				S_LCD_Counter ++ ;
-				break;
-			case 6:
-			case 7:
-			case 8:
-			case 9:
-			case 10:
-			case 11:
-			case 12:
-			case 13:
-			case 14:
-				S_LCD_Counter ++ ;
-				break;
-			case 15 :
-				LCD_enuSetCursorAsync  (LCD_enuSecondRow,LCD_enuColumn_3 ,DummyCB);
-				S_LCD_Counter ++ ;
-				break;
-			case 16:
-				LCD_enuWriteStringAsync("00:",DummyCB);
-				S_LCD_Counter ++ ;
-				break;
-			case 17:
-			case 18:
-				S_LCD_Counter ++ ;
-				break;
-			case 19:
-				LCD_enuWriteStringAsync("00:",DummyCB);
-				S_LCD_Counter ++ ;
-				break;
-			case 20:
-			case 21:
-				S_LCD_Counter ++ ;
-				break;
-			case 22:
-				LCD_enuWriteStringAsync("00:",DummyCB);
-				S_LCD_Counter ++ ;
-				break;
-			case 23:
-			case 24:
-				S_LCD_Counter ++ ;
-				break;
-			case 25:
-				LCD_enuWriteStringAsync("000",DummyCB);
-				S_LCD_Counter ++ ;
-				break;
-			case 26:
-			case 27:
-				S_LCD_Counter ++ ;
-				break;
-			case 28:
-				S_LCD_Counter = 0 ;
-				printEntireScreen = FALSE ;
-				stopwatchNotStarted = FALSE;
-				break;
-			}
-		}
-		else
-		{
-			/* Do Nothing because the current mode is not stopwatch mode. */
-		}
+	else
+	{
+		/* Do Nothing because the current mode is not stopwatch mode. */
 	}
 }
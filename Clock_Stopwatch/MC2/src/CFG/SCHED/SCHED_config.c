@@ -15,6 +15,7 @@
 /************************************************************************************/
 
 #include "SERVICES/SCHED/SCHED_interface.h"
+#include "CFG/SCHED/SCHED_phase.h"
 
 /************************************************************************************/
 /*								extern Public Functions								*/
@@ -26,6 +27,7 @@
 extern void RUNNABLE_LCD(void);
 extern void SW_Runnable(void);
 extern void clockRunnable(void);
+extern void clockDisplayRunnable(void);
 extern void StopwatchRunnable(void);
 extern void switchesCheckRunnable (void); 
 extern void receiveRunnable(void) ;
@@ -53,6 +55,15 @@ extern void receiveRunnable(void) ;
 	},
 	and so on ...
 };
+ * 				Runnables that only poll or refresh (LCD, switches, receive) use SCHED_BACKLOG_COALESCE,
+ * 				runnables that count the time (clock, stopwatch) keep the default SCHED_BACKLOG_RUN_ALL.
+ * 				The LCD runnable is SCHED_CLASS_PREEMPTIVE so a long receive runnable never delays its
+ * 				1 ms bus state machine.
+ * 				The clock display runnable is a coroutine (SCHED_pt.h), the LCD completions and the
+ * 				seconds call it at once by their events and its period only retries a request the
+ * 				LCD ignored while it was busy with another runnable's request.
+ * 				The stopwatch runnable displays the stopwatch by a coroutine too, it keeps its period
+ * 				without events because each of its calls counts 20 ms.
  * Cautions: 	- Be careful when setting the periodicity of any runnable that it's not
  * 					smaller than 10 ms.
  * 				- Note that the order in which You will write the runnables in the array defines
@@ -64,32 +75,48 @@ const runnable_t arrayOfRunnables [_RunnablesNumber_] = {
 		[lcdRunnable] 			= { .name = "LCD module",
 									.periodicityMS = 1,
 									.firstDelay=0,
-									.callBackFn = RUNNABLE_LCD
+									.callBackFn = RUNNABLE_LCD,
+									.backlogPolicy = SCHED_BACKLOG_COALESCE,
+									.schedClass = SCHED_CLASS_PREEMPTIVE
 		},
 		[Switch_Debounce] 		= { .name = "Switch_Debounce",
 									.periodicityMS = 30,
-									.firstDelay=50,
-									.callBackFn = SW_Runnable
+									.firstDelay=50 + SCHED_PHASE_Switch_Debounce,
+									.callBackFn = SW_Runnable,
+									.backlogPolicy = SCHED_BACKLOG_COALESCE
 		},
 		[Switch_check]			= { .name = "Switch Check",
 									.periodicityMS =200,
-									.firstDelay=200,
-									.callBackFn = switchesCheckRunnable
+									/* Fixed slot of the button frames to MC1, Switch_Runner of MC1 handles
+									 * them 4 ms later when the schedulers are aligned (SCHED_SYNC) */
+									.firstDelay=300,
+									.callBackFn = switchesCheckRunnable,
+									.backlogPolicy = SCHED_BACKLOG_COALESCE
 		},
 		[Clock_Runnable]		= { .name = "Clock_Runnable",
 									.periodicityMS =10,
-									.firstDelay=50,
+									.firstDelay=50 + SCHED_PHASE_Clock_Runnable,
 									.callBackFn = clockRunnable
 		},
+		[Clock_Display]			= { .name = "Clock_Display",
+									.periodicityMS = 100,
+									.firstDelay=50 + SCHED_PHASE_Clock_Display,
+									.callBackFn = clockDisplayRunnable,
+									.backlogPolicy = SCHED_BACKLOG_COALESCE,
+									.events = SCHED_EVENT_MASK(clockLcdDoneEvent) | SCHED_EVENT_MASK(clockSecondEvent)
+		},
 
 		[Stopwatch_Runnable]	= { .name = "Stopwatch_Runnable",
 									.periodicityMS = 20,
-									.firstDelay=50,
+									.firstDelay=50 + SCHED_PHASE_Stopwatch_Runnable,
 									.callBackFn = StopwatchRunnable
 		},
 		[Recieve_Runnable]		= { .name = "Recieve_Runnable",
 									.periodicityMS = 200,
-									.firstDelay=200,
-									.callBackFn = receiveRunnable
+									/* 4 ms after the slot of Switch_Runner of MC1 that sends the buttons */
+									.firstDelay=308,
+									.callBackFn = receiveRunnable,
+									.backlogPolicy = SCHED_BACKLOG_COALESCE,
+									.events = SCHED_EVENT_MASK(buttonReceivedEvent)
 		}
 };
@@ -0,0 +1,87 @@
+/******************************************************************************
+ *
+ * File Name: SCHED_table.c
+ *
+ * Description: Release table of the runnables, generated by tools/sched_table.py
+ * 				from src/CFG/SCHED/SCHED_config.c, do not edit, run the tool again after changing
+ * 				the runnables.
+ *
+ *******************************************************************************/
+
+/************************************************************************************/
+/*									Includes										*/
+/************************************************************************************/
+
+#include "CFG/SCHED/SCHED_table.h"
+
+/************************************************************************************/
+/*								Variables' Definition								*/
+/************************************************************************************/
+
+/* Bits:
+ *  0 lcdRunnable (first at 0, every 1)
+ *  1 Switch_check (first at 300, every 200)
+ *  2 Switch_Debounce (first at 53, every 30)
+ *  3 Clock_Runnable (first at 52, every 10)
+ *  4 Clock_Display (first at 51, every 100)
+ *  5 Stopwatch_Runnable (first at 50, every 20)
+ *  6 Recieve_Runnable (first at 308, every 200) */
+const SCHED_tableEntry_t SCHED_releaseTable [SCHED_TABLE_LENGTH] = {
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,    /* 0 */
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,    /* 16 */
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,    /* 32 */
+		0x01, 0x01, 0x21, 0x11, 0x09, 0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x09, 0x01,    /* 48 */
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x21, 0x01, 0x09, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,    /* 64 */
+		0x01, 0x01, 0x09, 0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x21, 0x01, 0x09, 0x01, 0x01, 0x01,    /* 80 */
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x09, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x21, 0x01,    /* 96 */
+		0x09, 0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x09, 0x01, 0x01, 0x01, 0x01, 0x01,    /* 112 */
+		0x01, 0x01, 0x21, 0x01, 0x09, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x09, 0x05,    /* 128 */
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x21, 0x11, 0x09, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,    /* 144 */
+		0x01, 0x01, 0x09, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x21, 0x01, 0x09, 0x05, 0x01, 0x01,    /* 160 */
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x09, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x21, 0x01,    /* 176 */
+		0x09, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x09, 0x05, 0x01, 0x01, 0x01, 0x01,    /* 192 */
+		0x01, 0x01, 0x21, 0x01, 0x09, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x09, 0x01,    /* 208 */
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x21, 0x01, 0x09, 0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,    /* 224 */
+		0x01, 0x01, 0x09, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x21, 0x11, 0x09, 0x01, 0x01, 0x01,    /* 240 */
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x09, 0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x21, 0x01,    /* 256 */
+		0x09, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x09, 0x01, 0x01, 0x01, 0x01, 0x01,    /* 272 */
+		0x01, 0x01, 0x21, 0x01, 0x09, 0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x03, 0x01, 0x09, 0x01,    /* 288 */
+		0x01, 0x01, 0x01, 0x01, 0x41, 0x01, 0x21, 0x01, 0x09, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,    /* 304 */
+		0x01, 0x01, 0x09, 0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x21, 0x01, 0x09, 0x01, 0x01, 0x01,    /* 320 */
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x09, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x21, 0x11,    /* 336 */
+		0x09, 0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x09, 0x01, 0x01, 0x01, 0x01, 0x01,    /* 352 */
+		0x01, 0x01, 0x21, 0x01, 0x09, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x09, 0x05,    /* 368 */
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x21, 0x01, 0x09, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,    /* 384 */
+		0x01, 0x01, 0x09, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x21, 0x01, 0x09, 0x05, 0x01, 0x01,    /* 400 */
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x09, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x21, 0x01,    /* 416 */
+		0x09, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x09, 0x05, 0x01, 0x01, 0x01, 0x01,    /* 432 */
+		0x01, 0x01, 0x21, 0x11, 0x09, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x09, 0x01,    /* 448 */
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x21, 0x01, 0x09, 0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,    /* 464 */
+		0x01, 0x01, 0x09, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x21, 0x01, 0x09, 0x01, 0x01, 0x01,    /* 480 */
+		0x01, 0x01, 0x01, 0x01, 0x03, 0x01, 0x09, 0x05, 0x01, 0x01, 0x01, 0x01, 0x41, 0x01, 0x21, 0x01,    /* 496 */
+		0x09, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x09, 0x01, 0x01, 0x01, 0x01, 0x01,    /* 512 */
+		0x01, 0x01, 0x21, 0x01, 0x09, 0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x09, 0x01,    /* 528 */
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x21, 0x11, 0x09, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,    /* 544 */
+		0x01, 0x01, 0x09, 0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x21, 0x01, 0x09, 0x01, 0x01, 0x01,    /* 560 */
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x09, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x21, 0x01,    /* 576 */
+		0x09, 0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x09, 0x01, 0x01, 0x01, 0x01, 0x01,    /* 592 */
+		0x01, 0x01, 0x21, 0x01, 0x09, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x09, 0x05,    /* 608 */
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x21, 0x01, 0x09, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,    /* 624 */
+		0x01, 0x01, 0x09, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x21, 0x11, 0x09, 0x05, 0x01, 0x01,    /* 640 */
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x09, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x21, 0x01,    /* 656 */
+		0x09, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x09, 0x05, 0x01, 0x01, 0x01, 0x01,    /* 672 */
+		0x01, 0x01, 0x21, 0x01, 0x09, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x03, 0x01, 0x09, 0x01,    /* 688 */
+		0x01, 0x01, 0x01, 0x01, 0x41, 0x01, 0x21, 0x01, 0x09, 0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,    /* 704 */
+		0x01, 0x01, 0x09, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x21, 0x01, 0x09, 0x01, 0x01, 0x01,    /* 720 */
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x09, 0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x21, 0x11,    /* 736 */
+		0x09, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x09, 0x01, 0x01, 0x01, 0x01, 0x01,    /* 752 */
+		0x01, 0x01, 0x21, 0x01, 0x09, 0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x09, 0x01,    /* 768 */
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x21, 0x01, 0x09, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,    /* 784 */
+		0x01, 0x01, 0x09, 0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x21, 0x01, 0x09, 0x01, 0x01, 0x01,    /* 800 */
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x09, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x21, 0x01,    /* 816 */
+		0x09, 0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x09, 0x01, 0x01, 0x01, 0x01, 0x01,    /* 832 */
+		0x01, 0x01, 0x21, 0x11, 0x09, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x09, 0x05,    /* 848 */
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x21, 0x01, 0x09, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,    /* 864 */
+		0x01, 0x01, 0x09, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x21, 0x01, 0x09, 0x05, 0x01, 0x01,    /* 880 */
+		0x01, 0x01, 0x01, 0x01, 0x03, 0x01, 0x09, 0x01, 0x01, 0x01, 0x01, 0x01     /* 896 */
+};
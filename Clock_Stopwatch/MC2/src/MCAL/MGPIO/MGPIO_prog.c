@@ -29,6 +29,7 @@
 #define GPIO_PIN_MAX                  16 
 
 #define GPIO_BSBR_RESET_SHFTING_MASK  0x00000010
+#define GPIO_PORT_PINS_MASK           0x0000FFFF
 
 
 #define GPIOA_BASE_ADDRESS           (u32)0x40020000
@@ -164,6 +165,25 @@ MGPIO_enuErrorStatus_t MGPIO_enuSetPinValue(u32 Copy_u32Port, u32 Copy_u32Pin, u
 
 }
 
+MGPIO_enuErrorStatus_t MGPIO_enuSetPortBits(u32 Copy_u32Port, u32 Copy_u32SetMask, u32 Copy_u32ResetMask)
+{
+	MGPIO_enuErrorStatus_t Ret_enuGPIO_ErrorStatus = MGPIO_enuOK;
+	if(Copy_u32Port > GPIO_PORT_MAX )
+	{
+       Ret_enuGPIO_ErrorStatus = MGPIO_enuPortError;
+	}
+	else
+	{
+		volatile GPIOReg_t *GPIO_PORT = GPIO_PORTS[Copy_u32Port] ;
+
+		/* The reset bits are in the upper half of BSRR, the set ones win as in the register */
+		GPIO_PORT->BSRR = (Copy_u32SetMask & GPIO_PORT_PINS_MASK) |
+		                  ((Copy_u32ResetMask & GPIO_PORT_PINS_MASK) << GPIO_BSBR_RESET_SHFTING_MASK);
+	}
+
+	return Ret_enuGPIO_ErrorStatus;
+}
+
 MGPIO_enuErrorStatus_t MGPIO_getPinValue(u32 Copy_u32Port, u32 Copy_u32Pin, u32 *Copy_pu32Pin) 
 {    
 	MGPIO_enuErrorStatus_t Ret_enuGPIO_ErrorStatus = MGPIO_enuOK;
@@ -14,6 +14,8 @@
 #define CLK_SOURCE     2 // Bit position for selecting SysTick clock source
 #define COUNT_FLAG    16 // Bit position for reading the COUNTFLAG status bit
 
+#define SYSTICK_MAX_TICKS 0x01000000 // Reload register is 24 bits, it counts reload + 1 ticks
+
 /********************************************************************************************************/
 /************************************************Types***************************************************/
 /********************************************************************************************************/
@@ -68,6 +70,30 @@ MSYSTICK_enuErrorStatus MSYSTICK_enuSetTimeMS(u32 Copy_u32MS_TIME)
 }
 
 
+MSYSTICK_enuErrorStatus MSYSTICK_enuSetTimeUS(u32 Copy_u32US_TIME)
+{
+    MSYSTICK_enuErrorStatus Ret_enuSYSTICK_ErrorStatus = MSYSTICK_enuNOK;
+    u64 LOC_u64Ticks=0;
+    #if  SYSTICK_CLK_SRC == SYSTICK_CLK_SRC_AHB
+    LOC_u64Ticks = ((u64)Copy_u32US_TIME * (u64)CLK_SRC)/(u64)1000000; // Calculate the number of ticks for the given time
+    #elif SYSTICK_CLK_SRC ==SYSTICK_CLK_SRC_AHB_DIV_BY_8
+    LOC_u64Ticks = ((u64)Copy_u32US_TIME * (u64)CLK_SRC)/(u64)8000000; // Calculate the number of ticks for the given time
+    #endif
+
+    if ((LOC_u64Ticks == 0) || (LOC_u64Ticks > SYSTICK_MAX_TICKS))
+    {
+        Ret_enuSYSTICK_ErrorStatus = MSYSTICK_enuWRONG_TIME;      // The time does not fit the 24-bit reload register
+    }
+    else
+    {
+        SYSTICK->STK_LOAD = (u32)LOC_u64Ticks - 1;                 // The interrupt comes every reload + 1 ticks
+        Ret_enuSYSTICK_ErrorStatus = MSYSTICK_enuOK;
+    }
+
+    return Ret_enuSYSTICK_ErrorStatus;
+}
+
+
 MSYSTICK_enuErrorStatus MSYSTICK_enuStart(u8 Copy_u8TimerType)
 {
    MSYSTICK_enuErrorStatus Ret_enuSYSTICK_ErrorStatus = MSYSTICK_enuNOK; 
@@ -0,0 +1,117 @@
+/********************************************************************************************************/
+/************************************************Includes************************************************/
+/********************************************************************************************************/
+#include "LIB/STD_TYPES.h"
+#include "MCAL/MTIM2/MTIM2_interface.h"
+#include "MCAL/MRCC/MRCC_interface.h"
+#include "MCAL/MNVIC/MNVIC_interface.h"
+
+/********************************************************************************************************/
+/************************************************Defines*************************************************/
+/********************************************************************************************************/
+#define TIM2_BASE_ADDRESS    0x40000000 // Base address of the TIM2 registers
+
+#define TIM2_CEN       0 // Bit position of the counter enable in CR1
+#define TIM2_URS       2 // Bit position of the update request source in CR1, only the overflow interrupts
+#define TIM2_OPM       3 // Bit position of the one-pulse mode in CR1, the counter stops at the update
+#define TIM2_UIE       0 // Bit position of the update interrupt enable in DIER
+#define TIM2_UIF       0 // Bit position of the update interrupt flag in SR
+#define TIM2_UG        0 // Bit position of the update generation in EGR, loads the prescaler
+
+#define TIM2_TICKS_PER_US    (TIM2_CLK_SRC / 1000000) // The prescaler divides the clock down to 1 MHz
+
+/********************************************************************************************************/
+/************************************************Types***************************************************/
+/********************************************************************************************************/
+typedef struct
+{
+    volatile u32 CR1;     // TIM2 Control Register 1
+    volatile u32 CR2;     // TIM2 Control Register 2
+    volatile u32 SMCR;    // TIM2 Slave Mode Control Register
+    volatile u32 DIER;    // TIM2 DMA/Interrupt Enable Register
+    volatile u32 SR;      // TIM2 Status Register
+    volatile u32 EGR;     // TIM2 Event Generation Register
+    volatile u32 CCMR1;   // TIM2 Capture/Compare Mode Register 1
+    volatile u32 CCMR2;   // TIM2 Capture/Compare Mode Register 2
+    volatile u32 CCER;    // TIM2 Capture/Compare Enable Register
+    volatile u32 CNT;     // TIM2 Counter
+    volatile u32 PSC;     // TIM2 Prescaler
+    volatile u32 ARR;     // TIM2 Auto-Reload Register
+}TIM2_t;                  // Structure representing TIM2 registers
+
+#define TIM2 ((volatile TIM2_t*)(TIM2_BASE_ADDRESS)) // Pointer to TIM2 registers
+
+/********************************************************************************************************/
+/************************************************Variables***********************************************/
+/********************************************************************************************************/
+static TIM2_CBF_t TIM2_CALLBACKFUNCTION ; // Pointer to TIM2 callback function
+
+/********************************************************************************************************/
+/*****************************************Static Functions Prototype*************************************/
+/********************************************************************************************************/
+// No static functions prototypes defined
+
+/********************************************************************************************************/
+/*********************************************APIs Implementation****************************************/
+/********************************************************************************************************/
+
+
+MTIM2_enuErrorStatus MTIM2_enuInit(void (*Copy_pfvCBFunc)(void))
+{
+    MTIM2_enuErrorStatus Ret_enuTIM2_ErrorStatus = MTIM2_enuNOK;
+    if(Copy_pfvCBFunc == NULL)
+    {
+        Ret_enuTIM2_ErrorStatus = MTIM2_enuNULLPOINTER;
+    }
+    else
+    {
+        TIM2_CALLBACKFUNCTION = Copy_pfvCBFunc;                          // Set the callback function
+        RCC_enuEnableAPB1Peripheral(APB1_TIM2);                          // Enable the clock of TIM2
+        TIM2->CR1 = (1 << TIM2_URS) | (1 << TIM2_OPM);                   // One-shot, stopped
+        TIM2->PSC = TIM2_TICKS_PER_US - 1;                               // Count microseconds
+        TIM2->DIER = 1 << TIM2_UIE;                                      // Interrupt at the end of a time
+        TIM2->SR = 0;
+        NVIC_EnableIRQ(IRQ_TIM2);
+        Ret_enuTIM2_ErrorStatus = MTIM2_enuOK;
+    }
+    return Ret_enuTIM2_ErrorStatus;
+}
+
+
+MTIM2_enuErrorStatus MTIM2_enuStartOneShotUS(u32 Copy_u32US_TIME)
+{
+    MTIM2_enuErrorStatus Ret_enuTIM2_ErrorStatus = MTIM2_enuNOK;
+    if(Copy_u32US_TIME < TIM2_MIN_TIME_US)
+    {
+        Ret_enuTIM2_ErrorStatus = MTIM2_enuWRONG_TIME;                   // The counter doesn't count with a reload of 0
+    }
+    else
+    {
+        TIM2->CR1 &= ~(1 << TIM2_CEN);
+        TIM2->CNT = 0;
+        TIM2->ARR = Copy_u32US_TIME - 1;                                 // The update comes after reload + 1 ticks
+        TIM2->EGR = 1 << TIM2_UG;                                        // Load the prescaler, no interrupt with URS
+        TIM2->SR = 0;
+        TIM2->CR1 |= 1 << TIM2_CEN;                                      // Start, the one-pulse mode clears CEN at the end
+        Ret_enuTIM2_ErrorStatus = MTIM2_enuOK;
+    }
+    return Ret_enuTIM2_ErrorStatus;
+}
+
+
+void MTIM2_vidStop(void)
+{
+    TIM2->CR1 &= ~(1 << TIM2_CEN);                                       // Stop the counter
+    TIM2->SR = 0;
+    NVIC_ClearPendingIRQ(IRQ_TIM2);                                      // Drop an end that came before the stop
+}
+
+
+void TIM2_IRQHandler (void){
+
+    TIM2->SR = ~(1UL << TIM2_UIF);                                       // Clear the update flag, the other flags are kept
+    if(TIM2_CALLBACKFUNCTION != NULL)
+    {
+        TIM2_CALLBACKFUNCTION();                                         // Call the callback function, it may start the next time
+    }
+}
@@ -16,6 +16,9 @@
 /************************************************Includes************************************************/
 /********************************************************************************************************/
 #include "MCAL/MUSART/MUSART_interface.h"
+#if (USART_CALLBACK == USART_CALLBACK_DEFERRED)
+#include "SERVICES/SCHED/SCHED_interface.h"
+#endif
 /********************************************************************************************************/
 /************************************************Defines*************************************************/
 /********************************************************************************************************/
@@ -88,6 +91,31 @@ CallBack_t BreakCallBack[USART_PERI_NUM];
 /********************************************************************************************************/
 /*****************************************Static Functions Prototype*************************************/
 /********************************************************************************************************/
+#if (USART_CALLBACK == USART_CALLBACK_DEFERRED)
+/* The interrupt queues the callback itself, so a request started again before the scheduler runs it does not
+   change the call that was queued */
+static void USART_RunCallBack(u32 CallBack)
+{
+    ((CallBack_t)CallBack)();
+}
+
+/* If the queue is full the callback is called in the interrupt, late work is better than a lost request end */
+static void USART_DeferCallBack(CallBack_t CallBack)
+{
+    if (SCHED_enuDefer(USART_RunCallBack, (u32)CallBack) != SCHED_enuOk)
+    {
+        CallBack();
+    }
+}
+
+#define USART_CALL_TX(USART_Peri) USART_DeferCallBack(TX_Request[USART_Peri].CallBack)
+#define USART_CALL_RX(USART_Peri) USART_DeferCallBack(RX_Request[USART_Peri].CallBack)
+#define USART_CALL_BREAK(USART_Peri) USART_DeferCallBack(BreakCallBack[USART_Peri])
+#else
+#define USART_CALL_TX(USART_Peri) TX_Request[USART_Peri].CallBack()
+#define USART_CALL_RX(USART_Peri) RX_Request[USART_Peri].CallBack()
+#define USART_CALL_BREAK(USART_Peri) BreakCallBack[USART_Peri]()
+#endif
 
 /********************************************************************************************************/
 /*********************************************APIs Implementation****************************************/
@@ -362,7 +390,7 @@ void USART1_IRQHandler(void)
         if (BreakCallBack[USART_Peri_1])
         {
             (USART_ADD[USART_Peri_1])->SR &= ~USART_LBD_FLAG;
-            BreakCallBack[USART_Peri_1]();
+            USART_CALL_BREAK(USART_Peri_1);
         }
     }
 
@@ -380,7 +408,7 @@ void USART1_IRQHandler(void)
             RX_Request[USART_Peri_1].state = USART_REQ_STATE_READY;
             if (RX_Request[USART_Peri_1].CallBack)
             {
-                RX_Request[USART_Peri_1].CallBack();
+                USART_CALL_RX(USART_Peri_1);
             }
         }
     }
@@ -399,7 +427,7 @@ void USART1_IRQHandler(void)
 
             if (TX_Request[USART_Peri_1].CallBack)
             {
-                TX_Request[USART_Peri_1].CallBack();
+                USART_CALL_TX(USART_Peri_1);
             }
         }
     }
@@ -412,7 +440,7 @@ void USART2_IRQHandler(void)
         if (BreakCallBack[USART_Peri_2])
         {
             (USART_ADD[USART_Peri_2])->SR &= ~USART_LBD_FLAG;
-            BreakCallBack[USART_Peri_2]();
+            USART_CALL_BREAK(USART_Peri_2);
         }
     }
 
@@ -429,7 +457,7 @@ void USART2_IRQHandler(void)
             RX_Request[USART_Peri_2].state = USART_REQ_STATE_READY;
             if (RX_Request[USART_Peri_2].CallBack)
             {
-                RX_Request[USART_Peri_2].CallBack();
+                USART_CALL_RX(USART_Peri_2);
             }
         }
     }
@@ -447,7 +475,7 @@ void USART2_IRQHandler(void)
             TX_Request[USART_Peri_2].state = USART_REQ_STATE_READY;
             if (TX_Request[USART_Peri_2].CallBack)
             {
-                TX_Request[USART_Peri_2].CallBack();
+                USART_CALL_TX(USART_Peri_2);
             }
         }
     }
@@ -460,7 +488,7 @@ void USART6_IRQHandler(void)
         if (BreakCallBack[USART_Peri_6])
         {
             (USART_ADD[USART_Peri_6])->SR &= ~USART_LBD_FLAG;
-            BreakCallBack[USART_Peri_6]();
+            USART_CALL_BREAK(USART_Peri_6);
         }
     }
 
@@ -477,7 +505,7 @@ void USART6_IRQHandler(void)
             RX_Request[USART_Peri_6].state = USART_REQ_STATE_READY;
             if (RX_Request[USART_Peri_6].CallBack)
             {
-                RX_Request[USART_Peri_6].CallBack();
+                USART_CALL_RX(USART_Peri_6);
             }
         }
     }
@@ -495,7 +523,7 @@ void USART6_IRQHandler(void)
             TX_Request[USART_Peri_6].state = USART_REQ_STATE_READY;
             if (TX_Request[USART_Peri_6].CallBack)
             {
-                TX_Request[USART_Peri_6].CallBack();
+                USART_CALL_TX(USART_Peri_6);
             }
         }
     }
@@ -0,0 +1,14 @@
+/******************************************************************************
+*
+* Module: Scheduler Driver.
+*
+* File Name: SCHED_common.c
+*
+* Description: Build of the scheduler shared with MC1, the project builds only the sources
+* 				of its own folders so COMMON/src is built from here with the configuration
+* 				of CFG/SCHED_CORE_cfg.h.
+*
+*******************************************************************************/
+
+#include "../../../../COMMON/src/SCHED_CORE.c"
+#include "../../../../COMMON/src/SCHED_KERNEL.c"
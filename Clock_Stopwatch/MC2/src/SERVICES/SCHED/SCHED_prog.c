@@ -18,45 +18,133 @@
 /****************************************************************************************/
 
 
-#include "MCAL/MSYSTICK/MSYSTICK_interface.h"
 #include "SERVICES/SCHED/SCHED_interface.h"
+/* The dispatcher is shared with MC1 in COMMON/SCHED_KERNEL, built by SCHED_common.c, CFG/SCHED_CORE_cfg.h
+ * maps the options of SCHED_config.h on it */
+#include "../../../../COMMON/include/SCHED_KERNEL.h"
 
 /****************************************************************************************/
-/*									Macros Declaration									*/
+/*								User-defined types Declaration							*/
 /****************************************************************************************/
 
 
-/* Periodicity of our Scheduler */
-#define SCHED_PERIODICITY_MS		1
+/* The runnables of the configuration, more runnables can be added in the runtime by SCHED_enuRegister */
+extern const runnable_t arrayOfRunnables [_RunnablesNumber_];
 
+/* The table must have room for all the runnables of arrayOfRunnables */
+typedef char SCHED_tableSizeCheck_t [(SCHED_MAX_RUNNABLES >= _RunnablesNumber_) ? 1 : -1];
 
+/* The backlog policies and the classes are given to the kernel as they are */
+typedef char SCHED_backlogCheck_t [(((u32)SCHED_BACKLOG_RUN_ALL == (u32)SCHED_CORE_BACKLOG_RUN_ALL) &&
+		((u32)SCHED_BACKLOG_COALESCE == (u32)SCHED_CORE_BACKLOG_COALESCE) &&
+		((u32)SCHED_BACKLOG_SKIP == (u32)SCHED_CORE_BACKLOG_SKIP)) ? 1 : -1];
 
-/****************************************************************************************/
-/*								User-defined types Declaration							*/
-/****************************************************************************************/
+typedef char SCHED_classCheck_t [(((u32)SCHED_CLASS_COOPERATIVE == SCHED_KERNEL_CLASS_COOPERATIVE) &&
+		((u32)SCHED_CLASS_PREEMPTIVE == SCHED_KERNEL_CLASS_PREEMPTIVE)) ? 1 : -1];
 
+#if (SCHED_BUDGET == SCHED_BUDGET_ENABLED)
+typedef char SCHED_budgetCheck_t [(((u32)SCHED_BUDGET_KEEP == (u32)SCHED_KERNEL_BUDGET_KEEP) &&
+		((u32)SCHED_BUDGET_SLOW_DOWN == (u32)SCHED_KERNEL_BUDGET_SLOW_DOWN) &&
+		((u32)SCHED_BUDGET_SUSPEND == (u32)SCHED_KERNEL_BUDGET_SUSPEND)) ? 1 : -1];
 
-/* The reason of "const" is that the scheduler can not add tasks in the runtime */
-extern const runnable_t arrayOfRunnables [_RunnablesNumber_];
+/* The budget policy set by SCHED_setBudgetHook, the kernel calls it through SCHED_budgetPolicy */
+static budgetHook_t SCHED_budgetHook = NULL_PTR;
+#endif
 
-typedef struct {
-	u8 delayFlag;
-}privateDelayFlag;
+#if (SCHED_DISPATCH == SCHED_DISPATCH_TABLE)
+/* A release table generated before a runnable was added or removed must be generated again */
+typedef char SCHED_releaseTableCheck_t [((SCHED_TABLE_RUNNABLES == _RunnablesNumber_) && (SCHED_TABLE_TICK_US == SCHED_TICK_US)) ? 1 : -1];
+#endif
 
 
 
 /****************************************************************************************/
-/*									Variables's Declaration								*/
+/*								Static Functions' Declaration							*/
 /****************************************************************************************/
 
 
-/* The reason of "volatile" is that */
-static volatile u32 pendingTasks = 0;
+/**
+ *@brief : Function that converts the status of the kernel to the error status of the APIs.
+ *@param : The status of the kernel, the error status of a full table or queue.
+ *@return: The error status.
+ */
+static SCHED_enuErrorStatus_t SCHED_status(SCHED_KernelStatus_t status, SCHED_enuErrorStatus_t full)
+{
+	SCHED_enuErrorStatus_t LOC_enuErrorStatus = SCHED_enuNotOk;
+	switch (status)
+	{
+	case SCHED_KERNEL_OK:
+		LOC_enuErrorStatus = SCHED_enuOk;
+		break;
+	case SCHED_KERNEL_NULL_POINTER:
+		LOC_enuErrorStatus = SCHED_enuNullPointer;
+		break;
+	case SCHED_KERNEL_INVALID_ID:
+		LOC_enuErrorStatus = SCHED_enuInvalidID;
+		break;
+	case SCHED_KERNEL_INVALID_PERIOD:
+		LOC_enuErrorStatus = SCHED_enuInvalidPeriod;
+		break;
+	case SCHED_KERNEL_INVALID_CLASS:
+		LOC_enuErrorStatus = SCHED_enuInvalidClass;
+		break;
+	case SCHED_KERNEL_INVALID_NAME:
+		LOC_enuErrorStatus = SCHED_enuInvalidName;
+		break;
+	case SCHED_KERNEL_INVALID_WINDOW:
+		LOC_enuErrorStatus = SCHED_enuInvalidWindow;
+		break;
+	case SCHED_KERNEL_FULL:
+		LOC_enuErrorStatus = full;
+		break;
+	default:
+		LOC_enuErrorStatus = SCHED_enuNotOk;
+		break;
+	}
+	return LOC_enuErrorStatus;
+}
+
+
+/**
+ *@brief : Function that gives a runnable to the kernel.
+ *@param : Pointer to the runnable, pointer to its ID.
+ *@return: The status of the kernel.
+ */
+static SCHED_KernelStatus_t SCHED_registerRunnable(const runnable_t* runnable, u32* runnableID)
+{
+	SCHED_KernelRunnable_t kernel;
+	uint32_t ID = 0;
+	SCHED_KernelStatus_t status;
+	kernel.Name = runnable->name;
+	kernel.CB = runnable->callBackFn;
+	kernel.Class = runnable->schedClass;
+	kernel.DelayMs = runnable->firstDelay;
+	kernel.PeriodicityMs = runnable->periodicityMS;
+	kernel.PeriodicityUs = runnable->periodicityUS;
+	kernel.BacklogPolicy = runnable->backlogPolicy;
+	kernel.Events = runnable->events;
+	kernel.BudgetUs = runnable->budgetUS;
+	status = SCHED_KernelRegister(&kernel, &ID);
+	*runnableID = ID;
+	return status;
+}
+
+#if (SCHED_BUDGET == SCHED_BUDGET_ENABLED)
+/**
+ *@brief : Function that gives the policy of SCHED_setBudgetHook to the kernel.
+ *@param : The runnable's ID, its budget overruns since the start.
+ *@return: The action of the policy.
+ */
+static uint32_t SCHED_budgetPolicy(uint32_t runnableID, uint32_t overruns)
+{
+	return (uint32_t)SCHED_budgetHook(runnableID, overruns);
+}
+#endif
+
 
-privateDelayFlag arrayOfRunnablesDelayFlag [_RunnablesNumber_] = {0};
 
 /****************************************************************************************/
-/*								Static Functions' Declaration							*/
+/*								Functions' Implementation								*/
 /****************************************************************************************/
 
 
@@ -65,76 +153,320 @@ privateDelayFlag arrayOfRunnablesDelayFlag [_RunnablesNumber_] = {0};
  *@param : void.
  *@return: void.
  */
-static void SCHED_sched(void)
+void SCHED_init(void)
 {
-	u32 index;
-	static u32 timeStamp = 0;
-	for(index = 0; index < _RunnablesNumber_; index++)
+	u8 index;
+	u32 runnableID;
+	SCHED_KernelInit();
+	/* The runnables of arrayOfRunnables take the first IDs in their order, the ones without a CallBack
+	 * are never released */
+	for (index = 0; index < _RunnablesNumber_; index++)
 	{
-		if (timeStamp >= arrayOfRunnables[index].firstDelay && arrayOfRunnablesDelayFlag[index].delayFlag == 0)
-		{
-			timeStamp = 0;
-			arrayOfRunnablesDelayFlag[index].delayFlag = 1;
-		}
-		/* Check on the CallBack pointer that it isn't a NULL pointer and check
-		 * if the time of this runnable comes */
-		if((arrayOfRunnables[index].callBackFn)\
-				&& ((timeStamp % (arrayOfRunnables[index].periodicityMS)) == 0) && (arrayOfRunnablesDelayFlag[index].delayFlag == 1))
-		{
-			/* If everything is OK, call the CallBackFn of this runnable */
-			arrayOfRunnables[index].callBackFn();
-		}
+		(void)SCHED_registerRunnable(&arrayOfRunnables[index], &runnableID);
 	}
-	/* Plus the periodicity of our scheduler to the timeStamp variable because when this function
-	 * be called next time, the time passed will be equal to the scheduler's periodicity  */
-	timeStamp += SCHED_PERIODICITY_MS;
 }
 
 
-
-/****************************************************************************************/
-/*								Functions' Implementation								*/
-/****************************************************************************************/
+/**
+ *@brief : Function that starts the scheduler.
+ *@param : void.
+ *@return: void.
+ */
+void SCHED_start(void)
+{
+	SCHED_KernelStart();
+}
 
 
 /**
- *@brief : Function that .
- *@param : void.
+ *@brief : Function that posts events from an ISR (or anywhere), every active runnable subscribed to one
+ *		   of them by its events mask is called in the next dispatch without waiting for its period.
+ *@param : Mask of the posted events, SCHED_EVENT_MASK(event) | ...
  *@return: void.
  */
-void tickCallBack(void)
+void SCHED_postEvent(u32 events)
 {
-	pendingTasks++;
+	SCHED_KernelPostEvent(events);
 }
 
 
 /**
- *@brief : Function that initializes the scheduler.
+ *@brief : Function that marks the entry of an ISR, its time till SCHED_exitISR is taken off the execution
+ *		   time of the runnable it interrupted, for the budget and the statistics. The systick and PendSV
+ *		   are marked by the scheduler.
  *@param : void.
+ *@return: The mark to give to SCHED_exitISR.
+ */
+u32 SCHED_u32EnterISR(void)
+{
+	return SCHED_KernelEnterIsr();
+}
+
+
+/**
+ *@brief : Function that marks the exit of the ISR, call it last in the ISR.
+ *@param : The value returned by SCHED_u32EnterISR.
  *@return: void.
  */
-void SCHED_init(void)
+void SCHED_exitISR(u32 mark)
 {
-	MSYSTICK_vidInit();
-	MSYSTICK_enuSetTimeMS(SCHED_PERIODICITY_MS);
-	MSYSTICK_enuSetCallback(tickCallBack);
+	SCHED_KernelExitIsr(mark);
 }
 
 
 /**
- *@brief : Function that starts the scheduler.
+ *@brief : Function that queues a function from an ISR (or anywhere) instead of calling it there, the scheduler
+ *		   calls it with the priority of SCHED_DEFER in the order of the calls. It never masks the interrupts.
+ *@param : The function, the value given to it.
+ *@return: SCHED_enuOk, SCHED_enuNullPointer or SCHED_enuQueueFull (the work is dropped and counted).
+ */
+SCHED_enuErrorStatus_t SCHED_enuDefer(deferredWork_t work, u32 arg)
+{
+	/* u32 and uint32_t are both unsigned long on the Cortex-M4, so the work is called as it is */
+	return SCHED_status(SCHED_KernelDefer((SCHED_KernelWork_t)work, arg), SCHED_enuQueueFull);
+}
+
+
+/**
+ *@brief : Function that gets the number of works dropped by SCHED_enuDefer because the queue was full,
+ *		   SCHED_DEFER_QUEUE_SIZE must grow if it is not 0.
+ *@param : Pointer to the count.
+ *@return: SCHED_enuOk or SCHED_enuNullPointer.
+ */
+SCHED_enuErrorStatus_t SCHED_enuGetDeferDrops(u32* drops)
+{
+	SCHED_enuErrorStatus_t LOC_enuErrorStatus = SCHED_enuOk;
+	if (drops == NULL_PTR)
+	{
+		LOC_enuErrorStatus = SCHED_enuNullPointer;
+	}
+	else
+	{
+		*drops = SCHED_KernelGetDeferDrops();
+	}
+	return LOC_enuErrorStatus;
+}
+
+#if (SCHED_SYNC == SCHED_SYNC_SLAVE)
+/**
+ *@brief : Function that aligns the scheduler time on the master, call it when a sync frame is received.
+ *		   The systick gives 2 ticks (or 0) to the dispatchers instead of 1 till the phase error is made up,
+ *		   so the runnables are released faster (or wait) for as many ticks as the error, never skipped.
  *@param : void.
+ *@return: SCHED_enuOk.
+ */
+SCHED_enuErrorStatus_t SCHED_enuSync(void)
+{
+	SCHED_KernelSync();
+	return SCHED_enuOk;
+}
+#endif
+
+
+
+/**
+ *@brief : Function that adds a runnable in the runtime, it is released first after its firstDelay from now.
+ *@param : Pointer to the runnable (it is copied), pointer to the ID that the other APIs use.
+ *@return: SCHED_enuOk, SCHED_enuNullPointer, SCHED_enuInvalidClass or SCHED_enuTableFull
+ *		   (always SCHED_enuNotOk with SCHED_DISPATCH_TABLE).
+ */
+SCHED_enuErrorStatus_t SCHED_enuRegister(const runnable_t* runnable, u32* runnableID)
+{
+	SCHED_enuErrorStatus_t LOC_enuErrorStatus = SCHED_enuOk;
+	if ((runnable == NULL_PTR) || (runnable->callBackFn == NULL_PTR) || (runnableID == NULL_PTR))
+	{
+		LOC_enuErrorStatus = SCHED_enuNullPointer;
+	}
+	else
+	{
+		LOC_enuErrorStatus = SCHED_status(SCHED_registerRunnable(runnable, runnableID), SCHED_enuTableFull);
+	}
+	return LOC_enuErrorStatus;
+}
+
+
+/**
+ *@brief : Function that stops calling a runnable till SCHED_enuResume, it costs nothing while suspended.
+ *@param : The runnable's index in RunnablesList_t or the ID returned by SCHED_enuRegister.
+ *@return: SCHED_enuOk or SCHED_enuInvalidID.
+ */
+SCHED_enuErrorStatus_t SCHED_enuSuspend(u32 runnableID)
+{
+	return SCHED_status(SCHED_KernelSuspend(runnableID), SCHED_enuNotOk);
+}
+
+
+/**
+ *@brief : Function that calls a suspended runnable again, it keeps its phase so it is released at the
+ *		   first (firstDelay + n * periodicityMS) that is not in the past.
+ *@param : The runnable's index in RunnablesList_t or the ID returned by SCHED_enuRegister.
+ *@return: SCHED_enuOk or SCHED_enuInvalidID.
+ */
+SCHED_enuErrorStatus_t SCHED_enuResume(u32 runnableID)
+{
+	return SCHED_status(SCHED_KernelResume(runnableID), SCHED_enuNotOk);
+}
+
+
+/**
+ *@brief : Function that holds a runnable for a delay, it is not called by its period or by the events till
+ *		   the delay passes then its periodic releases continue from the wake time. A runnable that sleeps
+ *		   while it runs is released again at the wake time even if it has no periodicity.
+ *@param : The runnable's index in RunnablesList_t or the ID returned by SCHED_enuRegister, the delay in ms
+ *		   (0 is not allowed).
+ *@return: SCHED_enuOk, SCHED_enuInvalidID, SCHED_enuInvalidPeriod or SCHED_enuNotOk with SCHED_DISPATCH_TABLE.
+ */
+SCHED_enuErrorStatus_t SCHED_enuSleep(u32 runnableID, u32 delayMS)
+{
+	return SCHED_status(SCHED_KernelSleep(runnableID, delayMS), SCHED_enuNotOk);
+}
+
+
+/**
+ *@brief : Function that changes the periodicity of a runnable, the new value applies after its next release.
+ *@param : The runnable's index in RunnablesList_t or the ID returned by SCHED_enuRegister, the new
+ *		   periodicity in ms (0 is not allowed).
+ *@return: SCHED_enuOk, SCHED_enuInvalidID, SCHED_enuInvalidPeriod or SCHED_enuNotOk with SCHED_DISPATCH_TABLE.
+ */
+SCHED_enuErrorStatus_t SCHED_enuSetPeriod(u32 runnableID, u32 periodicityMS)
+{
+	return SCHED_status(SCHED_KernelSetPeriod(runnableID, periodicityMS), SCHED_enuNotOk);
+}
+
+
+/**
+ *@brief : Function that gets the number of releases of a runnable that were coalesced or skipped
+ *		   by its backlogPolicy.
+ *@param : The name of the runnable as written in arrayOfRunnables, pointer to the count.
+ *@return: SCHED_enuOk, SCHED_enuNullPointer or SCHED_enuInvalidName.
+ */
+SCHED_enuErrorStatus_t SCHED_enuGetMissedReleases(const char* name, u32* missedReleases)
+{
+	SCHED_enuErrorStatus_t LOC_enuErrorStatus = SCHED_enuNullPointer;
+	uint32_t missed = 0;
+	if (missedReleases != NULL_PTR)
+	{
+		LOC_enuErrorStatus = SCHED_status(SCHED_KernelGetMissedReleases(name, &missed), SCHED_enuNotOk);
+	}
+	if (LOC_enuErrorStatus == SCHED_enuOk)
+	{
+		*missedReleases = missed;
+	}
+	return LOC_enuErrorStatus;
+}
+
+
+#if (SCHED_BUDGET == SCHED_BUDGET_ENABLED)
+/**
+ *@brief : Function that replaces the default budget policy (SCHED_BUDGET_SLOW_DOWN), the hook is called
+ *		   right after the call that made SCHED_BUDGET_STRIKES overruns in a row, NULL_PTR goes back to the
+ *		   default one. A slowed down runnable comes back by halves after SCHED_BUDGET_RECOVERY_RUNS calls
+ *		   in a row within its budget.
+ *@param : The budget policy.
  *@return: void.
  */
-void SCHED_start(void)
+void SCHED_setBudgetHook(budgetHook_t hook)
 {
-	MSYSTICK_enuStart(SYSTICK_PERIODIC);
-	while (1)
+	SCHED_budgetHook = hook;
+	SCHED_KernelSetBudgetHook((hook != NULL_PTR) ? SCHED_budgetPolicy : NULL_PTR);
+}
+
+
+/**
+ *@brief : Function that gets the number of calls of a runnable that took longer than its budgetUS.
+ *@param : The name of the runnable as written in arrayOfRunnables, pointer to the count.
+ *@return: SCHED_enuOk, SCHED_enuNullPointer or SCHED_enuInvalidName.
+ */
+SCHED_enuErrorStatus_t SCHED_enuGetBudgetOverruns(const char* name, u32* overruns)
+{
+	SCHED_enuErrorStatus_t LOC_enuErrorStatus = SCHED_enuNullPointer;
+	uint32_t count = 0;
+	if (overruns != NULL_PTR)
+	{
+		LOC_enuErrorStatus = SCHED_status(SCHED_KernelGetBudgetOverruns(name, &count), SCHED_enuNotOk);
+	}
+	if (LOC_enuErrorStatus == SCHED_enuOk)
+	{
+		*overruns = count;
+	}
+	return LOC_enuErrorStatus;
+}
+#endif
+
+
+#if (SCHED_STATS == SCHED_STATS_ENABLED)
+/**
+ *@brief : Function that gets the execution time and start jitter statistics of a runnable.
+ *@param : The name of the runnable as written in arrayOfRunnables, pointer to the statistics struct.
+ *@return: SCHED_enuOk, SCHED_enuNullPointer or SCHED_enuInvalidName.
+ */
+SCHED_enuErrorStatus_t SCHED_enuGetRunnableStats(const char* name, SCHED_runnableStats_t* stats)
+{
+	SCHED_enuErrorStatus_t LOC_enuErrorStatus = SCHED_enuNullPointer;
+	SCHED_KernelStats_t kernel;
+	if (stats != NULL_PTR)
+	{
+		LOC_enuErrorStatus = SCHED_status(SCHED_KernelGetRunnableStats(name, &kernel), SCHED_enuNotOk);
+	}
+	if (LOC_enuErrorStatus == SCHED_enuOk)
+	{
+		stats->runs = kernel.Runs;
+		stats->minExecCycles = kernel.MinExecCycles;
+		stats->maxExecCycles = kernel.MaxExecCycles;
+		stats->meanExecCycles = kernel.MeanExecCycles;
+		stats->minStartJitter = kernel.MinStartJitter;
+		stats->maxStartJitter = kernel.MaxStartJitter;
+		stats->overruns = kernel.Overruns;
+	}
+	return LOC_enuErrorStatus;
+}
+
+
+/**
+ *@brief : Function that gets the worst release latency of a class, the longest delay in core clock cycles
+ *		   between the release time of any runnable of the class and its call.
+ *@param : The class (SCHED_CLASS_COOPERATIVE or SCHED_CLASS_PREEMPTIVE), pointer to the latency.
+ *@return: SCHED_enuOk, SCHED_enuNullPointer or SCHED_enuInvalidClass.
+ */
+SCHED_enuErrorStatus_t SCHED_enuGetClassLatency(schedClass_t schedClass, u32* maxLatency)
+{
+	SCHED_enuErrorStatus_t LOC_enuErrorStatus = SCHED_enuNullPointer;
+	uint32_t latency = 0;
+	if (maxLatency != NULL_PTR)
+	{
+		LOC_enuErrorStatus = SCHED_status(SCHED_KernelGetClassLatency(schedClass, &latency), SCHED_enuNotOk);
+	}
+	if (LOC_enuErrorStatus == SCHED_enuOk)
+	{
+		*maxLatency = latency;
+	}
+	return LOC_enuErrorStatus;
+}
+#endif
+
+
+#if (SCHED_LOAD == SCHED_LOAD_ENABLED)
+/**
+ *@brief : Function that gets the CPU load measured over the last complete window, to be shown on the
+ *		   LCD or sent over USART.
+ *@param : The window (SCHED_LOAD_WINDOW_SHORT or SCHED_LOAD_WINDOW_LONG), pointer to the load struct.
+ *@return: SCHED_enuOk, SCHED_enuNullPointer, SCHED_enuInvalidWindow or SCHED_enuNotOk if no window is complete yet.
+ */
+SCHED_enuErrorStatus_t SCHED_enuGetLoad(schedLoadWindow_t window, SCHED_load_t* load)
+{
+	SCHED_enuErrorStatus_t LOC_enuErrorStatus = SCHED_enuNullPointer;
+	SCHED_KernelLoad_t kernel;
+	if (load != NULL_PTR)
+	{
+		LOC_enuErrorStatus = SCHED_status(SCHED_KernelGetLoad(window, &kernel), SCHED_enuNotOk);
+	}
+	if (LOC_enuErrorStatus == SCHED_enuOk)
 	{
-		if(pendingTasks)
-		{
-			pendingTasks--;
-			SCHED_sched();
-		}
+		load->busyCycles = kernel.BusyCycles;
+		load->idleCycles = kernel.IdleCycles;
+		load->utilisation = kernel.Utilisation;
+		load->peakTickUtilisation = kernel.PeakTickUtilisation;
 	}
+	return LOC_enuErrorStatus;
 }
+#endif
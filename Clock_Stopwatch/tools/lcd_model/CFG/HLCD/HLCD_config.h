@@ -0,0 +1,9 @@
+#ifndef _LCD_MODEL_CFG_H
+#define _LCD_MODEL_CFG_H
+
+/*configuration of the LCD driver of MC2 for tools/lcd_model on the host: the one of the board with the changes of
+  lcd_model_cfg.h*/
+#include_next "CFG/HLCD/HLCD_config.h"
+#include "../../lcd_model_cfg.h"
+
+#endif
@@ -0,0 +1,9 @@
+#ifndef _LCD_MODEL_CNF_H
+#define _LCD_MODEL_CNF_H
+
+/*configuration of the LCD driver of MC1 for tools/lcd_model on the host (-DLCD_MODEL_MC1): the one of the board with
+  the changes of lcd_model_cfg.h*/
+#include_next "CFG/LCD_CNF.h"
+#include "../lcd_model_cfg.h"
+
+#endif
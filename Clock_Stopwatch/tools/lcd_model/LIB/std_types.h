@@ -0,0 +1,2 @@
+/*MRCC_interface.h includes LIB/std_types.h, the name only works on a file system with no case*/
+#include "LIB/STD_TYPES.h"
@@ -0,0 +1,2 @@
+/*LCD.c of MC1 includes Service/SCHED.h, the name only works on a file system with no case*/
+#include "../../../MC1/include/SERVICE/SCHED.h"
@@ -0,0 +1,850 @@
+/*run the LCD driver of MC2 (MC2/src/HAL/HLCD/HLCD_prog.c) or the one of MC1 (MC1/src/HAL/LCD.c) on the host against
+  a model of the HD44780, so a change of either driver can be checked against the timing of the datasheet without the
+  board. Both drivers have the same requests and the same wiring of the pins, only their GPIO, RCC and scheduler calls
+  differ, the model gives the ones of the driver it is built with.
+
+  The model follows the pins the driver sets and latches a nibble on every falling edge of E, as the controller does
+  in the four bits mode (the board's wiring). It reports a violation when:
+    - an instruction or a character comes before the power on wait or while the last one is executing
+      (37 us, 41 us for a character, 1.52 ms for a clear or a return home at 270 kHz, 4.1 ms and 100 us after the
+      first two function sets of the initialization)
+    - E is high for less than 450 ns or rises again less than 1000 ns after the last rise
+    - RS or RW change while E is high, or the data pins change while E is high in a write
+    - the MCU drives the data pins while RW and E are high (the LCD drives them)
+    - D7 is read less than 360 ns after E rose, with E low or RW low, or before the function set of the four bits
+      interface (the busy flag isn't valid before it)
+    - a read starts in the middle of a write or a write in the middle of a read (the nibbles lose their order)
+  The model time moves by LCD_MODEL_GPIO_NS at every GPIO call of the driver and by MODEL_CYCLES_READ_NS at every read
+  of its cycle counter, and the runnable is called every LCD_RUNNABLE_PERIOD_US while the driver keeps it resumed (or
+  the callback of the timer at the end of each time the driver starts it with LCD_ENGINE_TIMER), the pins of a write of a port (MGPIO_enuSetPortBits)
+  change at the same time. The requests of the app (initialization, clear, cursor, strings, numbers, commands,
+  shadow buffer flushes, big digits made of glyphs of the CGRAM) are sent in steps and the screen is checked after
+  each step, a column of two characters of the CGRAM is checked as the big digit their glyphs show. The big digits
+  of every minute of a day are flushed one after the other as the clock shows them.
+
+  Build and run from Clock_Stopwatch, with the driver of MC2:
+      gcc -O2 -Itools/lcd_model -IMC2/include -ICOMMON/include tools/lcd_model/lcd_model.c \
+          MC2/src/HAL/HLCD/HLCD_prog.c MC2/src/CFG/HLCD/HLCD_config.c -o lcd_model
+      ./lcd_model
+  and with the driver of MC1:
+      gcc -O2 -DLCD_MODEL_MC1 -Itools/lcd_model -IMC1/include -ICOMMON/include tools/lcd_model/lcd_model.c \
+          MC1/src/HAL/LCD.c MC1/src/CFG/LCD_CNF.c -o lcd_model_mc1
+      ./lcd_model_mc1
+  Options of the build (for both drivers):
+      -DLCD_MODEL_BUSY_FLAG_MODE=LCD_BUSY_FLAG_POLLING    the mode of the driver, the board's one otherwise
+      -DLCD_MODEL_ENGINE=LCD_ENGINE_TIMER                 the engine of the driver, the board's one otherwise
+      -DLCD_MODEL_PERIOD_US=50                            the period of RUNNABLE_LCD, the board's one otherwise
+                                                          (give a budget under it with LCD_MODEL_BUDGET_US)
+      -DLCD_MODEL_FOSC_KHZ=190                            the oscillator of the LCD, the instructions take longer on
+                                                          a slow one (270 kHz by default)
+      -DLCD_MODEL_GPIO_NS=1000                            the time of one GPIO call of the driver (500 ns by default,
+                                                          the calls take longer on the STM32F401)
+      -DLCD_MODEL_BUDGET_US=0                             the step budget of a call of RUNNABLE_LCD, the board's one
+                                                          otherwise (0 runs one step per call)
+      -DLCD_MODEL_SPREAD_PINS                             D7 moved to the port B, so the data pins can't be written
+                                                          with one write of their port
+  It returns 1 if a violation was found or a screen is not the expected one.*/
+
+/*---------------------------------------------------------------------------------------------------*/
+/*                                           Includes:                                               */
+/*---------------------------------------------------------------------------------------------------*/
+#ifdef LCD_MODEL_MC1
+#include "MCAL/RCC.h"
+#include "MCAL/GPIO.h"
+#include "HAL/LCD.h"
+#include "Service/SCHED.h"
+#else
+#include "LIB/STD_TYPES.h"
+#include "MCAL/MRCC/MRCC_interface.h"
+#include "MCAL/MGPIO/MGPIO_interface.h"
+#include "HAL/HLCD/HLCD_interface.h"
+#include "SERVICES/SCHED/SCHED_interface.h"
+#endif
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#if (LCD_DATA_BITS_MODE != LCD_FOUR_BITS_MODE)
+#error "lcd_model: only the four bits mode of the board is modeled"
+#endif
+
+void RUNNABLE_LCD(void);
+
+/*---------------------------------------------------------------------------------------------------*/
+/*                                           Defines:                                                */
+/*---------------------------------------------------------------------------------------------------*/
+#ifndef LCD_MODEL_FOSC_KHZ
+#define LCD_MODEL_FOSC_KHZ          270
+#endif
+
+#ifndef LCD_MODEL_GPIO_NS
+#define LCD_MODEL_GPIO_NS           500
+#endif
+
+/*the execution times of the datasheet at 270 kHz, they scale with the oscillator*/
+#define MODEL_EXEC_NS(NS)           (((uint64_t)(NS) * 270) / LCD_MODEL_FOSC_KHZ)
+#define MODEL_INSTRUCTION_NS        MODEL_EXEC_NS(37000)
+#define MODEL_CHARACTER_NS          MODEL_EXEC_NS(41000)
+#define MODEL_CLEAR_NS              MODEL_EXEC_NS(1520000)
+
+/*the waits of the initialization by instructions, they don't depend on the oscillator*/
+#define MODEL_POWER_ON_NS           15000000ULL
+#define MODEL_FIRST_INIT_NS         4100000ULL
+#define MODEL_SECOND_INIT_NS        100000ULL
+
+/*the bus timing*/
+#define MODEL_PWEH_NS               450
+#define MODEL_TCYCE_NS              1000
+#define MODEL_TDDR_NS               360
+#define MODEL_TDSW_NS               195
+#define MODEL_TAS_NS                60
+
+/*the time of a read of the cycle counter by the driver, with the loop around it*/
+#define MODEL_CYCLES_READ_NS        100
+
+#define MODEL_PERIOD_NS             ((uint64_t)LCD_RUNNABLE_PERIOD_US * 1000)
+#define MODEL_STEP_LIMIT_NS         10000000000ULL
+#define MODEL_REPORTED_VIOLATIONS   10
+
+#define MODEL_PINS                  (E_4BITMODE + 1)
+#define MODEL_DDRAM_SIZE            0x68
+#define MODEL_CGRAM_SIZE            0x40
+#define MODEL_CGRAM_CHARACTERS      8
+#define MODEL_BIG_SEPARATOR         0xA5
+#define MODEL_MINUTES_PER_DAY       1440
+
+/*the driver and the port of D7 with LCD_MODEL_SPREAD_PINS*/
+#ifdef LCD_MODEL_MC1
+#define MODEL_DRIVER                "MC1"
+#define MODEL_PORT_B                GPIO_PORT_B
+#else
+#define MODEL_DRIVER                "MC2"
+#define MODEL_PORT_B                GPIO_PORTB
+#endif
+
+/*---------------------------------------------------------------------------------------------------*/
+/*                                           Typedefs:                                               */
+/*---------------------------------------------------------------------------------------------------*/
+typedef struct
+{
+    /*the MCU side of the pins, by their index in arrayofLCDPinConfig*/
+    uint8_t Level [MODEL_PINS];
+    uint8_t Input [MODEL_PINS];
+    uint64_t ERise;
+    uint64_t LastERise;
+    uint64_t ControlChange;
+    uint64_t DataChange;
+
+    /*the controller*/
+    uint8_t Interface8;                         //1 till the function set of the four bits interface
+    uint8_t InitFunctionSets;                   //function sets received in the 8 bits interface
+    uint8_t WriteNibble;                        //1 after the upper nibble of a write
+    uint8_t UpperNibble;
+    uint8_t ReadNibble;                         //1 after the upper nibble of a read
+    uint8_t Cgram;                              //1 while the characters go to the CGRAM
+    uint8_t Ddram [MODEL_DDRAM_SIZE];
+    uint8_t Address;
+    uint8_t CgramData [MODEL_CGRAM_SIZE];
+    uint8_t CgramAddress;
+    uint64_t BusyUntil;
+
+    uint32_t Writes;
+    uint32_t Reads;
+    uint32_t Violations;
+}MODEL_Lcd_t;
+
+/*---------------------------------------------------------------------------------------------------*/
+/*                                           Variables:                                              */
+/*---------------------------------------------------------------------------------------------------*/
+extern LCD_strLCDPinConfig_t arrayofLCDPinConfig [7];
+
+static MODEL_Lcd_t MODEL_Lcd;
+static uint64_t MODEL_Now = 0;
+static uint8_t MODEL_Resumed = 0;
+static uint32_t MODEL_Calls = 0;
+static uint32_t MODEL_Done = 0;
+static uint32_t MODEL_PortWrites = 0;
+static uint32_t MODEL_PinWrites = 0;
+
+/*the one-shot timer of LCD_ENGINE_TIMER*/
+static void (*MODEL_TimerCallBack) (void) = NULL;
+static uint64_t MODEL_TimerEnd = 0;
+static uint8_t MODEL_TimerStarted = 0;
+
+/*1 while the steps of a loop run without printing*/
+static uint8_t MODEL_Quiet = 0;
+
+/*the segments of the big digits from 0 to 9 (a b c d e f g from bit 0), made into glyphs by the model itself*/
+static const uint8_t MODEL_Segments [10] = {0x3F, 0x06, 0x5B, 0x4F, 0x66, 0x6D, 0x7D, 0x07, 0x7F, 0x6F};
+
+
+/*---------------------------------------------------------------------------------------------------*/
+/*                                           Static Function:                                        */
+/*---------------------------------------------------------------------------------------------------*/
+static void MODEL_Violation (const char* Text, uint32_t Value)
+{
+    MODEL_Lcd.Violations++;
+    if(MODEL_Lcd.Violations <= MODEL_REPORTED_VIOLATIONS)
+    {
+        printf("  violation at %10.3f ms: %s (%u)\n", (double)MODEL_Now / 1000000.0, Text, Value);
+    }
+}
+
+static int MODEL_Pin (uint32_t Port, uint32_t Pin)
+{
+    int Result = -1;
+    for(int itr = 0 ; itr < MODEL_PINS ; itr++)
+    {
+        if((arrayofLCDPinConfig[itr].LCD_port_number == Port) && (arrayofLCDPinConfig[itr].LCD_pin_number == Pin))
+        {
+            Result = itr;
+        }
+    }
+    return Result;
+}
+
+static uint8_t MODEL_DataNibble (void)
+{
+    return (uint8_t)((MODEL_Lcd.Level[D7_4BITMODE] << 3) | (MODEL_Lcd.Level[D6_4BITMODE] << 2) |
+                     (MODEL_Lcd.Level[D5_4BITMODE] << 1) | MODEL_Lcd.Level[D4_4BITMODE]);
+}
+
+static void MODEL_NextAddress (void)
+{
+    if((MODEL_Lcd.Address & 0x3F) == 0x27)
+    {
+        MODEL_Lcd.Address = (MODEL_Lcd.Address < 0x40) ? 0x40 : 0x00;
+    }
+    else
+    {
+        MODEL_Lcd.Address++;
+    }
+}
+
+/*an instruction (RS low) or a character (RS high) taken by the controller*/
+static void MODEL_Execute (uint8_t Rs, uint8_t Byte)
+{
+    uint64_t Exec = MODEL_INSTRUCTION_NS;
+
+    MODEL_Lcd.Writes++;
+    if(MODEL_Now < MODEL_POWER_ON_NS)
+    {
+        MODEL_Violation("write before the power on wait, byte", Byte);
+    }
+    else if(MODEL_Now < MODEL_Lcd.BusyUntil)
+    {
+        MODEL_Violation("write while the LCD is busy, ns early", (uint32_t)(MODEL_Lcd.BusyUntil - MODEL_Now));
+    }
+
+    if(Rs == 1)
+    {
+        if(MODEL_Lcd.Cgram == 0)
+        {
+            MODEL_Lcd.Ddram[MODEL_Lcd.Address] = Byte;
+            MODEL_NextAddress();
+        }
+        else
+        {
+            MODEL_Lcd.CgramData[MODEL_Lcd.CgramAddress] = Byte & 0x1F;
+            MODEL_Lcd.CgramAddress = (MODEL_Lcd.CgramAddress + 1) & 0x3F;
+        }
+        Exec = MODEL_CHARACTER_NS;
+    }
+    else if(Byte & 0x80)
+    {
+        MODEL_Lcd.Address = Byte & 0x7F;
+        MODEL_Lcd.Cgram = 0;
+        if(((MODEL_Lcd.Address & 0x3F) > 0x27) || (MODEL_Lcd.Address >= MODEL_DDRAM_SIZE))
+        {
+            MODEL_Violation("DDRAM address out of the rows", MODEL_Lcd.Address);
+            MODEL_Lcd.Address = 0;
+        }
+    }
+    else if(Byte & 0x40)
+    {
+        MODEL_Lcd.Cgram = 1;
+        MODEL_Lcd.CgramAddress = Byte & 0x3F;
+    }
+    else if(Byte & 0x20)
+    {
+        if(MODEL_Lcd.Interface8 == 1)
+        {
+            MODEL_Lcd.InitFunctionSets++;
+            Exec = (MODEL_Lcd.InitFunctionSets == 1) ? MODEL_FIRST_INIT_NS :
+                   (MODEL_Lcd.InitFunctionSets == 2) ? MODEL_SECOND_INIT_NS : MODEL_INSTRUCTION_NS;
+            if((Byte & 0x10) == 0)
+            {
+                MODEL_Lcd.Interface8 = 0;
+            }
+        }
+    }
+    else if(Byte & 0x10)
+    {
+        if((Byte & 0x08) == 0)
+        {
+            MODEL_Lcd.Address = (Byte & 0x04) ? (MODEL_Lcd.Address + 1) : (MODEL_Lcd.Address - 1);
+        }
+    }
+    else if(Byte & 0x08)
+    {
+        /*display control*/
+    }
+    else if(Byte & 0x04)
+    {
+        if((Byte & 0x02) == 0)
+        {
+            MODEL_Violation("entry mode with decrement, the driver follows the address with increment", Byte);
+        }
+    }
+    else if(Byte & 0x02)
+    {
+        MODEL_Lcd.Address = 0;
+        Exec = MODEL_CLEAR_NS;
+    }
+    else if(Byte & 0x01)
+    {
+        memset(MODEL_Lcd.Ddram, ' ', sizeof(MODEL_Lcd.Ddram));
+        MODEL_Lcd.Address = 0;
+        MODEL_Lcd.Cgram = 0;
+        Exec = MODEL_CLEAR_NS;
+    }
+    MODEL_Lcd.BusyUntil = MODEL_Now + Exec;
+}
+
+static void MODEL_ERises (void)
+{
+    if((MODEL_Now - MODEL_Lcd.LastERise) < MODEL_TCYCE_NS)
+    {
+        MODEL_Violation("E cycle shorter than 1000 ns", (uint32_t)(MODEL_Now - MODEL_Lcd.LastERise));
+    }
+    if((MODEL_Now - MODEL_Lcd.ControlChange) < MODEL_TAS_NS)
+    {
+        MODEL_Violation("E rose less than 60 ns after RS or RW", (uint32_t)(MODEL_Now - MODEL_Lcd.ControlChange));
+    }
+    MODEL_Lcd.LastERise = MODEL_Now;
+    MODEL_Lcd.ERise = MODEL_Now;
+
+    if(MODEL_Lcd.Level[RW_4BITMODE] == 1)
+    {
+        for(int itr = D4_4BITMODE ; itr <= D7_4BITMODE ; itr++)
+        {
+            if(MODEL_Lcd.Input[itr] == 0)
+            {
+                MODEL_Violation("the MCU drives a data pin while the LCD does, pin D", (uint32_t)(itr + 4));
+            }
+        }
+        if(MODEL_Lcd.WriteNibble == 1)
+        {
+            MODEL_Violation("read in the middle of a write", 0);
+            MODEL_Lcd.WriteNibble = 0;
+        }
+    }
+}
+
+static void MODEL_EFalls (void)
+{
+    uint8_t Nibble = MODEL_DataNibble();
+
+    if((MODEL_Now - MODEL_Lcd.ERise) < MODEL_PWEH_NS)
+    {
+        MODEL_Violation("E high for less than 450 ns", (uint32_t)(MODEL_Now - MODEL_Lcd.ERise));
+    }
+
+    if(MODEL_Lcd.Level[RW_4BITMODE] == 1)
+    {
+        MODEL_Lcd.ReadNibble ^= 1;
+    }
+    else
+    {
+        if((MODEL_Now - MODEL_Lcd.DataChange) < MODEL_TDSW_NS)
+        {
+            MODEL_Violation("data set less than 195 ns before E fell", (uint32_t)(MODEL_Now - MODEL_Lcd.DataChange));
+        }
+        if(MODEL_Lcd.ReadNibble == 1)
+        {
+            MODEL_Violation("write in the middle of a read", 0);
+            MODEL_Lcd.ReadNibble = 0;
+        }
+
+        if(MODEL_Lcd.Interface8 == 1)
+        {
+            /*D3 to D0 aren't wired, the LCD reads them low*/
+            MODEL_Execute(MODEL_Lcd.Level[RS_4BITMODE], (uint8_t)(Nibble << 4));
+        }
+        else if(MODEL_Lcd.WriteNibble == 0)
+        {
+            MODEL_Lcd.UpperNibble = Nibble;
+            MODEL_Lcd.WriteNibble = 1;
+        }
+        else
+        {
+            MODEL_Lcd.WriteNibble = 0;
+            MODEL_Execute(MODEL_Lcd.Level[RS_4BITMODE], (uint8_t)((MODEL_Lcd.UpperNibble << 4) | Nibble));
+        }
+    }
+}
+
+/*a pin of the LCD takes a level, the edges of E latch and read the bus*/
+static void MODEL_SetPin (int Pin, uint8_t Level)
+{
+    if((Pin >= 0) && (MODEL_Lcd.Level[Pin] != Level))
+    {
+        if((Pin == RS_4BITMODE) || (Pin == RW_4BITMODE))
+        {
+            if(MODEL_Lcd.Level[E_4BITMODE] == 1)
+            {
+                MODEL_Violation("RS or RW changed while E is high, pin index", (uint32_t)Pin);
+            }
+            MODEL_Lcd.ControlChange = MODEL_Now;
+        }
+        else if(Pin != E_4BITMODE)
+        {
+            if((MODEL_Lcd.Level[E_4BITMODE] == 1) && (MODEL_Lcd.Level[RW_4BITMODE] == 0))
+            {
+                MODEL_Violation("data changed while E is high, pin index", (uint32_t)Pin);
+            }
+            MODEL_Lcd.DataChange = MODEL_Now;
+        }
+        MODEL_Lcd.Level[Pin] = Level;
+        if(Pin == E_4BITMODE)
+        {
+            if(Level == 1)
+            {
+                MODEL_ERises();
+            }
+            else
+            {
+                MODEL_EFalls();
+            }
+        }
+    }
+}
+
+static void MODEL_LcdDone (void)
+{
+    MODEL_Done++;
+}
+
+/*call the runnable every period while the driver keeps it resumed, till the callbacks of the step come*/
+static int MODEL_Run (const char* Step, uint32_t Callbacks)
+{
+    uint64_t Start = MODEL_Now;
+    uint32_t StartCalls = MODEL_Calls;
+    uint32_t StartWrites = MODEL_Lcd.Writes;
+    uint32_t StartReads = MODEL_Lcd.Reads;
+    uint32_t StartGpio = MODEL_PinWrites + MODEL_PortWrites;
+    uint64_t Call = (MODEL_Now + MODEL_PERIOD_NS - 1) / MODEL_PERIOD_NS;
+    int Result = 0;
+
+    MODEL_Done = 0;
+#if (LCD_ENGINE == LCD_ENGINE_TIMER)
+    (void)Call;
+    /*the interrupt of the timer at the end of each time, the driver stops it when it has nothing to do*/
+    while((MODEL_Done < Callbacks) && (MODEL_TimerStarted == 1) && ((MODEL_Now - Start) < MODEL_STEP_LIMIT_NS))
+    {
+        if(MODEL_Now < MODEL_TimerEnd)
+        {
+            MODEL_Now = MODEL_TimerEnd;
+        }
+        MODEL_TimerStarted = 0;
+        MODEL_Calls++;
+        MODEL_TimerCallBack();
+    }
+#else
+    while((MODEL_Done < Callbacks) && ((MODEL_Now - Start) < MODEL_STEP_LIMIT_NS))
+    {
+        if(MODEL_Now < (Call * MODEL_PERIOD_NS))
+        {
+            MODEL_Now = Call * MODEL_PERIOD_NS;
+        }
+        if(MODEL_Resumed == 1)
+        {
+            MODEL_Calls++;
+            RUNNABLE_LCD();
+        }
+        Call++;
+    }
+#endif
+    if(MODEL_Done < Callbacks)
+    {
+        printf("  %s: %u of %u callbacks\n", Step, MODEL_Done, Callbacks);
+        Result = 1;
+    }
+    if(MODEL_Quiet == 0)
+    {
+        printf("  %-22s %10.3f ms %8u calls %6u writes %6u busy reads %7u GPIO writes\n", Step,
+           (double)(MODEL_Now - Start) / 1000000.0, MODEL_Calls - StartCalls, MODEL_Lcd.Writes - StartWrites,
+           MODEL_Lcd.Reads - StartReads, MODEL_PinWrites + MODEL_PortWrites - StartGpio);
+    }
+    return Result;
+}
+
+/*the glyph of a half of a big digit: its sides on every row, a bar on the first row (a) or the last row (g, d)*/
+static void MODEL_BigDigitGlyph (uint8_t Digit, int Half, uint8_t* Glyph)
+{
+    uint8_t Segments = MODEL_Segments[Digit];
+    uint8_t Left = (Half == 0) ? (Segments & 0x20) : (Segments & 0x10);
+    uint8_t Right = (Half == 0) ? (Segments & 0x02) : (Segments & 0x04);
+    uint8_t Top = (Half == 0) ? (Segments & 0x01) : 0;
+    uint8_t Bottom = (Half == 0) ? (Segments & 0x40) : (Segments & 0x08);
+
+    for(int Row = 0 ; Row < 8 ; Row++)
+    {
+        Glyph[Row] = (uint8_t)((Left ? 0x10 : 0) | (Right ? 0x01 : 0));
+    }
+    if(Top)
+    {
+        Glyph[0] = 0x1F;
+    }
+    if(Bottom)
+    {
+        Glyph[7] = 0x1F;
+    }
+}
+
+/*the big digit the CGRAM characters of a column show, '?' if their glyphs aren't the halves of one digit*/
+static char MODEL_BigDigit (uint8_t Upper, uint8_t Lower)
+{
+    uint8_t Glyph [8];
+    char Result = '?';
+
+    for(uint8_t Digit = 0 ; (Digit < 10) && (Result == '?') ; Digit++)
+    {
+        MODEL_BigDigitGlyph(Digit, 0, Glyph);
+        if(memcmp(Glyph, &MODEL_Lcd.CgramData[Upper * 8], 8) == 0)
+        {
+            MODEL_BigDigitGlyph(Digit, 1, Glyph);
+            if(memcmp(Glyph, &MODEL_Lcd.CgramData[Lower * 8], 8) == 0)
+            {
+                Result = (char)('0' + Digit);
+            }
+        }
+    }
+    return Result;
+}
+
+static int MODEL_Check (const char* Row0, const char* Row1)
+{
+    char Screen [2][17];
+    int Result = 0;
+
+    for(int Column = 0 ; Column < 16 ; Column++)
+    {
+        Screen[0][Column] = (char)MODEL_Lcd.Ddram[Column];
+        Screen[1][Column] = (char)MODEL_Lcd.Ddram[0x40 + Column];
+        if((MODEL_Lcd.Ddram[Column] < MODEL_CGRAM_CHARACTERS) && (MODEL_Lcd.Ddram[0x40 + Column] < MODEL_CGRAM_CHARACTERS))
+        {
+            Screen[0][Column] = MODEL_BigDigit(MODEL_Lcd.Ddram[Column], MODEL_Lcd.Ddram[0x40 + Column]);
+            Screen[1][Column] = Screen[0][Column];
+        }
+    }
+    Screen[0][16] = '\0';
+    Screen[1][16] = '\0';
+    if(MODEL_Quiet == 0)
+    {
+        printf("  |%s|\n  |%s|\n", Screen[0], Screen[1]);
+    }
+    if((strncmp(Screen[0], Row0, 16) != 0) || (strncmp(Screen[1], Row1, 16) != 0))
+    {
+        printf("  |%s|\n  |%s|\n  expected\n  |%s|\n  |%s|\n", Screen[0], Screen[1], Row0, Row1);
+        Result = 1;
+    }
+    return Result;
+}
+
+/*---------------------------------------------------------------------------------------------------*/
+/*                                           Stubs of the board:                                     */
+/*---------------------------------------------------------------------------------------------------*/
+void LCD_modelTimerInit (void (*CallBack) (void))
+{
+    MODEL_TimerCallBack = CallBack;
+}
+
+/*TIM2 counts microseconds, a started time is restarted*/
+void LCD_modelTimerStart (uint32_t Us)
+{
+    MODEL_TimerEnd = MODEL_Now + ((uint64_t)Us * 1000);
+    MODEL_TimerStarted = 1;
+}
+
+/*the cycle counter of the driver (LCD_GET_CYCLES), at the clock of the board*/
+uint32_t LCD_modelCycles (void)
+{
+    MODEL_Now += MODEL_CYCLES_READ_NS;
+    return (uint32_t)((MODEL_Now * LCD_CYCLES_PER_US) / 1000);
+}
+
+/*the GPIO calls of both drivers, every call takes LCD_MODEL_GPIO_NS*/
+static void MODEL_GpioSetPin (uint32_t Port, uint32_t Pin, uint8_t Level)
+{
+    MODEL_Now += LCD_MODEL_GPIO_NS;
+    MODEL_PinWrites++;
+    MODEL_SetPin(MODEL_Pin(Port, Pin), Level);
+}
+
+/*one write of BSRR, the pins change at the same time (E isn't expected in it)*/
+static void MODEL_GpioSetPort (uint32_t Port, uint32_t SetMask, uint32_t ResetMask)
+{
+    MODEL_Now += LCD_MODEL_GPIO_NS;
+    MODEL_PortWrites++;
+    for(uint32_t Pin = 0 ; Pin < 16 ; Pin++)
+    {
+        if((SetMask | ResetMask) & (1UL << Pin))
+        {
+            MODEL_SetPin(MODEL_Pin(Port, Pin), (uint8_t)((SetMask >> Pin) & 1));
+        }
+    }
+}
+
+static uint8_t MODEL_GpioGetPin (uint32_t Port, uint32_t PinNumber)
+{
+    int Pin = MODEL_Pin(Port, PinNumber);
+    uint8_t Level = 0;
+
+    MODEL_Now += LCD_MODEL_GPIO_NS;
+    if(Pin != D7_4BITMODE)
+    {
+        MODEL_Violation("read of a pin that isn't D7, pin index", (uint32_t)Pin);
+    }
+    else if((MODEL_Lcd.Level[E_4BITMODE] == 0) || (MODEL_Lcd.Level[RW_4BITMODE] == 0) || (MODEL_Lcd.Input[Pin] == 0))
+    {
+        MODEL_Violation("D7 read while the LCD doesn't drive it", 0);
+    }
+    else
+    {
+        if((MODEL_Now - MODEL_Lcd.ERise) < MODEL_TDDR_NS)
+        {
+            MODEL_Violation("D7 read less than 360 ns after E rose", (uint32_t)(MODEL_Now - MODEL_Lcd.ERise));
+        }
+        if(MODEL_Lcd.Interface8 == 1)
+        {
+            MODEL_Violation("busy flag read before the function set of the four bits interface", 0);
+        }
+        if(MODEL_Lcd.ReadNibble == 0)
+        {
+            MODEL_Lcd.Reads++;
+            Level = (MODEL_Now < MODEL_Lcd.BusyUntil);
+        }
+    }
+    return Level;
+}
+
+static void MODEL_GpioConfigPin (uint32_t Port, uint32_t PinNumber, uint8_t Input)
+{
+    int Pin = MODEL_Pin(Port, PinNumber);
+
+    MODEL_Now += LCD_MODEL_GPIO_NS;
+    if(Pin >= 0)
+    {
+        MODEL_Lcd.Input[Pin] = Input;
+        if((MODEL_Lcd.Input[Pin] == 0) && (Pin <= D7_4BITMODE) && (MODEL_Lcd.Level[E_4BITMODE] == 1) &&
+           (MODEL_Lcd.Level[RW_4BITMODE] == 1))
+        {
+            MODEL_Violation("a data pin set as output while the LCD drives it, pin index", (uint32_t)Pin);
+        }
+    }
+}
+
+#ifdef LCD_MODEL_MC1
+GPIO_ERROR_STATE GPIO_SetPinValue (uint32_t GPIO_PORT, uint32_t GPIO_PIN, uint32_t PIN_STATE)
+{
+    MODEL_GpioSetPin(GPIO_PORT, GPIO_PIN, (uint8_t)(PIN_STATE == PIN_STATE_HIGH));
+    return GPIO_ENUM_OK;
+}
+
+GPIO_ERROR_STATE GPIO_SetPortBits (uint32_t GPIO_PORT, uint32_t SET_MASK, uint32_t RESET_MASK)
+{
+    MODEL_GpioSetPort(GPIO_PORT, SET_MASK, RESET_MASK);
+    return GPIO_ENUM_OK;
+}
+
+GPIO_ERROR_STATE GPIO_GetPinValue (uint32_t GPIO_PORT, uint32_t GPIO_PIN, uint8_t* PinValue)
+{
+    *PinValue = MODEL_GpioGetPin(GPIO_PORT, GPIO_PIN);
+    return GPIO_ENUM_OK;
+}
+
+/*the input modes of MCAL/GPIO have 00 in the bits of MODER (the two low bits)*/
+GPIO_ERROR_STATE GPIO_InitPin (GPIO_CONFIG_T* Config)
+{
+    MODEL_GpioConfigPin(Config->Port, Config->Pin, (uint8_t)((Config->Mode & 0x3) == 0));
+    return GPIO_ENUM_OK;
+}
+
+ErrorStatus_t RCC_Control_AHB1Peripherals (uint32_t RCC_PERI_AHB1, RCC_enumStatus_t Status)
+{
+    (void)RCC_PERI_AHB1;
+    (void)Status;
+    return Ok;
+}
+
+ErrorStatus_t SCHED_Suspend (uint32_t RunnableID)
+{
+    (void)RunnableID;
+    MODEL_Resumed = 0;
+    return Ok;
+}
+
+ErrorStatus_t SCHED_Resume (uint32_t RunnableID)
+{
+    (void)RunnableID;
+    MODEL_Resumed = 1;
+    return Ok;
+}
+#else
+MGPIO_enuErrorStatus_t MGPIO_enuSetPinValue (u32 Copy_u32Port, u32 Copy_u32Pin, u32 Copy_u32Value)
+{
+    MODEL_GpioSetPin(Copy_u32Port, Copy_u32Pin, (uint8_t)(Copy_u32Value == GPIO_HIGH));
+    return MGPIO_enuOK;
+}
+
+MGPIO_enuErrorStatus_t MGPIO_enuSetPortBits (u32 Copy_u32Port, u32 Copy_u32SetMask, u32 Copy_u32ResetMask)
+{
+    MODEL_GpioSetPort(Copy_u32Port, Copy_u32SetMask, Copy_u32ResetMask);
+    return MGPIO_enuOK;
+}
+
+MGPIO_enuErrorStatus_t MGPIO_getPinValue (u32 Copy_u32Port, u32 Copy_u32Pin, u32* Copy_pu32Pin)
+{
+    *Copy_pu32Pin = MODEL_GpioGetPin(Copy_u32Port, Copy_u32Pin);
+    return MGPIO_enuOK;
+}
+
+MGPIO_enuErrorStatus_t MGPIO_enuSetPinConfig (MGPIO_PIN_config_t* Add_strPinConfg)
+{
+    MODEL_GpioConfigPin(Add_strPinConfg->GPIOPort, Add_strPinConfg->GPIOPin, (uint8_t)(Add_strPinConfg->GPIOMode == GPIO_INPUT));
+    return MGPIO_enuOK;
+}
+
+RCC_enuErrorStatus_t RCC_enuEnableAHB1Peripheral (u32 Copy_u32AHB1Peripheral)
+{
+    (void)Copy_u32AHB1Peripheral;
+    return RCC_enuOk;
+}
+
+SCHED_enuErrorStatus_t SCHED_enuSuspend (u32 runnableID)
+{
+    (void)runnableID;
+    MODEL_Resumed = 0;
+    return SCHED_enuOk;
+}
+
+SCHED_enuErrorStatus_t SCHED_enuResume (u32 runnableID)
+{
+    (void)runnableID;
+    MODEL_Resumed = 1;
+    return SCHED_enuOk;
+}
+#endif
+
+/*the screen of big digits of the clock (MC2/src/APP/ClockRunnable.c), drawn in the shadow buffer and flushed*/
+static int MODEL_BigClock (const char* Step, uint32_t Minute)
+{
+    static uint8_t Separator [] = {MODEL_BIG_SEPARATOR, '\0'};
+    char Row0 [17];
+    char Row1 [17];
+    int Result = 0;
+
+    Result |= (LCD_enuDrawBigDigit(LCD_enuColumn_1, (uint8_t)(Minute / 600)) != LCD_enuOk);
+    Result |= (LCD_enuDrawBigDigit(LCD_enuColumn_2, (uint8_t)((Minute / 60) % 10)) != LCD_enuOk);
+    LCD_enuDrawString(LCD_enuFirstRow, LCD_enuColumn_3, Separator);
+    LCD_enuDrawString(LCD_enuSecondRow, LCD_enuColumn_3, Separator);
+    Result |= (LCD_enuDrawBigDigit(LCD_enuColumn_4, (uint8_t)((Minute % 60) / 10)) != LCD_enuOk);
+    Result |= (LCD_enuDrawBigDigit(LCD_enuColumn_5, (uint8_t)(Minute % 10)) != LCD_enuOk);
+    LCD_enuDrawString(LCD_enuFirstRow, LCD_enuColumn_6, (uint8_t*)" 17/04/2024");
+    LCD_enuDrawString(LCD_enuSecondRow, LCD_enuColumn_6, (uint8_t*)":00        ");
+    if(Result != 0)
+    {
+        printf("  %s: a big digit isn't drawn\n", Step);
+    }
+    LCD_enuFlushAsync(MODEL_LcdDone);
+    Result |= MODEL_Run(Step, 1);
+
+    snprintf(Row0, sizeof(Row0), "%02u%c%02u 17/04/2024", Minute / 60, MODEL_BIG_SEPARATOR, Minute % 60);
+    snprintf(Row1, sizeof(Row1), "%02u%c%02u:00        ", Minute / 60, MODEL_BIG_SEPARATOR, Minute % 60);
+    Result |= MODEL_Check(Row0, Row1);
+    return Result;
+}
+
+/*---------------------------------------------------------------------------------------------------*/
+/*                                           APIs:                                                   */
+/*---------------------------------------------------------------------------------------------------*/
+int main (void)
+{
+    int Failed = 0;
+
+    /*the pins are inputs after the reset and the LCD starts in the 8 bits interface*/
+    memset(&MODEL_Lcd, 0, sizeof(MODEL_Lcd));
+    memset(MODEL_Lcd.Input, 1, sizeof(MODEL_Lcd.Input));
+    memset(MODEL_Lcd.Ddram, ' ', sizeof(MODEL_Lcd.Ddram));
+    MODEL_Lcd.Interface8 = 1;
+
+#ifdef LCD_MODEL_SPREAD_PINS
+    /*D7 on another port, the driver writes the data pins one by one*/
+    arrayofLCDPinConfig[D7_4BITMODE].LCD_port_number = MODEL_PORT_B;
+#endif
+
+#if (LCD_ENGINE == LCD_ENGINE_TIMER)
+    printf("HD44780 model, driver of %s: %s mode, TIM2 engine, oscillator %u kHz, GPIO call %u ns\n", MODEL_DRIVER,
+           (LCD_BUSY_FLAG_MODE == LCD_BUSY_FLAG_POLLING) ? "busy flag" : "timed", LCD_MODEL_FOSC_KHZ, LCD_MODEL_GPIO_NS);
+#else
+    printf("HD44780 model, driver of %s: %s mode, runnable every %u us with a budget of %u us, oscillator %u kHz, GPIO call %u ns\n",
+           MODEL_DRIVER, (LCD_BUSY_FLAG_MODE == LCD_BUSY_FLAG_POLLING) ? "busy flag" : "timed", LCD_RUNNABLE_PERIOD_US,
+           LCD_STEP_BUDGET_US, LCD_MODEL_FOSC_KHZ, LCD_MODEL_GPIO_NS);
+#endif
+
+    LCD_enuInitAsync(MODEL_LcdDone);
+    Failed |= MODEL_Run("initialization", 1);
+
+    LCD_enuClearScreenAsync(MODEL_LcdDone);
+    LCD_enuSetCursorAsync(LCD_enuFirstRow, LCD_enuColumn_3, MODEL_LcdDone);
+    LCD_enuWriteStringAsync((uint8_t*)"HD44780", MODEL_LcdDone);
+    LCD_enuSetCursorAsync(LCD_enuSecondRow, LCD_enuColumn_1, MODEL_LcdDone);
+    LCD_enuWriteNumberAsync(2024, MODEL_LcdDone);
+    LCD_enuSendCommandAsync(LCD_ReturnHome, MODEL_LcdDone);
+    LCD_enuWriteStringAsync((uint8_t*)"#", MODEL_LcdDone);
+    Failed |= MODEL_Run("requests", 7);
+    Failed |= MODEL_Check("# HD44780       ", "2024            ");
+
+    /*a zero and the zeros of the lowest digits are printed apart from the other digits*/
+    LCD_enuSetCursorAsync(LCD_enuSecondRow, LCD_enuColumn_6, MODEL_LcdDone);
+    LCD_enuWriteNumberAsync(0, MODEL_LcdDone);
+    LCD_enuWriteStringAsync((uint8_t*)" ", MODEL_LcdDone);
+    LCD_enuWriteNumberAsync(100, MODEL_LcdDone);
+    Failed |= MODEL_Run("numbers with zeros", 4);
+    Failed |= MODEL_Check("# HD44780       ", "2024 0 100      ");
+
+    LCD_enuDrawString(LCD_enuFirstRow, LCD_enuColumn_1, (uint8_t*)"Date: 17/04/2024");
+    LCD_enuDrawString(LCD_enuSecondRow, LCD_enuColumn_1, (uint8_t*)"Time:   06:00:00");
+    LCD_enuFlushAsync(MODEL_LcdDone);
+    Failed |= MODEL_Run("flush of the screen", 1);
+    Failed |= MODEL_Check("Date: 17/04/2024", "Time:   06:00:00");
+
+    LCD_enuDrawString(LCD_enuSecondRow, LCD_enuColumn_16, (uint8_t*)"1");
+    LCD_enuFlushAsync(MODEL_LcdDone);
+    Failed |= MODEL_Run("flush of a second", 1);
+    Failed |= MODEL_Check("Date: 17/04/2024", "Time:   06:00:01");
+
+    LCD_enuClearScreenAsync(MODEL_LcdDone);
+    LCD_enuFlushAsync(MODEL_LcdDone);
+    Failed |= MODEL_Run("clear and flush", 2);
+    Failed |= MODEL_Check("Date: 17/04/2024", "Time:   06:00:01");
+
+    Failed |= MODEL_BigClock("flush of big digits", 6 * 60);
+    Failed |= MODEL_BigClock("flush of a big minute", (6 * 60) + 1);
+
+    /*every minute of a day, the glyphs of the digits that changed replace the least recently used ones*/
+    uint32_t StartWrites = MODEL_Lcd.Writes;
+    uint64_t StartNow = MODEL_Now;
+    MODEL_Quiet = 1;
+    for(uint32_t Minute = 0 ; Minute < MODEL_MINUTES_PER_DAY ; Minute++)
+    {
+        Failed |= MODEL_BigClock("a minute of the day", Minute);
+    }
+    MODEL_Quiet = 0;
+    printf("  %-22s %10.3f ms %6.1f writes per minute\n", "a day of big minutes",
+           (double)(MODEL_Now - StartNow) / 1000000.0, (double)(MODEL_Lcd.Writes - StartWrites) / MODEL_MINUTES_PER_DAY);
+
+    printf("%u violations\n", MODEL_Lcd.Violations);
+    return (Failed || (MODEL_Lcd.Violations > 0)) ? 1 : 0;
+}
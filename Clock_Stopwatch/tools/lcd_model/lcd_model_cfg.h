@@ -0,0 +1,51 @@
+#ifndef _LCD_MODEL_CFG_SHARED_H
+#define _LCD_MODEL_CFG_SHARED_H
+
+/*the part of the configuration of the LCD driver that tools/lcd_model replaces, the same for the driver of MC2
+  (CFG/HLCD/HLCD_config.h) and the one of MC1 (CFG/LCD_CNF.h): no interrupts to mask, the time of the model in place of
+  the cycle counter and of TIM2 and the busy flag mode, the engine, the runnable period and the step budget given to
+  the build*/
+#include <stdint.h>
+
+#undef LCD_ENTER_CRITICAL
+#undef LCD_EXIT_CRITICAL
+#define LCD_ENTER_CRITICAL()                0
+#define LCD_EXIT_CRITICAL(State)            ((void)(State))
+
+#undef LCD_START_CYCLES
+#undef LCD_GET_CYCLES
+#define LCD_START_CYCLES()                  ((void)0)
+#define LCD_GET_CYCLES()                    LCD_modelCycles()
+uint32_t LCD_modelCycles (void);
+
+#undef LCD_TIMER_INIT
+#undef LCD_TIMER_START
+#define LCD_TIMER_INIT(CallBack)            LCD_modelTimerInit(CallBack)
+#define LCD_TIMER_START(US)                 LCD_modelTimerStart(US)
+void LCD_modelTimerInit (void (*CallBack) (void));
+void LCD_modelTimerStart (uint32_t Us);
+
+#undef LCD_SCHED_RUNNABLE_ID
+#define LCD_SCHED_RUNNABLE_ID               0
+
+#ifdef LCD_MODEL_BUSY_FLAG_MODE
+#undef LCD_BUSY_FLAG_MODE
+#define LCD_BUSY_FLAG_MODE                  LCD_MODEL_BUSY_FLAG_MODE
+#endif
+
+#ifdef LCD_MODEL_ENGINE
+#undef LCD_ENGINE
+#define LCD_ENGINE                          LCD_MODEL_ENGINE
+#endif
+
+#ifdef LCD_MODEL_PERIOD_US
+#undef LCD_RUNNABLE_PERIOD_US
+#define LCD_RUNNABLE_PERIOD_US              LCD_MODEL_PERIOD_US
+#endif
+
+#ifdef LCD_MODEL_BUDGET_US
+#undef LCD_STEP_BUDGET_US
+#define LCD_STEP_BUDGET_US                  LCD_MODEL_BUDGET_US
+#endif
+
+#endif
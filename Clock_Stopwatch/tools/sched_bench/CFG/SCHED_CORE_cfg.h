@@ -0,0 +1,18 @@
+#ifndef _SCHED_CORE_CFG_H
+#define _SCHED_CORE_CFG_H
+
+/*configuration of COMMON/SCHED_CORE for tools/sched_bench on the host, one class and no interrupts to mask, the
+  queue is given to the build (the heap by default)*/
+#include <stdint.h>
+
+#define SCHED_CORE_MAX_RUNNABLES            200
+#define SCHED_CORE_CLASSES                  1
+
+#ifndef SCHED_CORE_QUEUE
+#define SCHED_CORE_QUEUE                    SCHED_CORE_QUEUE_HEAP
+#endif
+
+#define SCHED_CORE_ENTER_CRITICAL()         0
+#define SCHED_CORE_EXIT_CRITICAL(State)     ((void)(State))
+
+#endif
@@ -0,0 +1,300 @@
+/*measure the dispatch cost of COMMON/SCHED_CORE per scheduler tick for 5, 20 and 100 runnables (or the counts given on
+  the command line), so the number of runnables can grow with a known cost.
+
+  The runnables get the periods of the boards at a 1 ms tick: the first one runs every tick like the LCD driver and the
+  others get a period of 10 ms to 1 s and a random phase, their call is empty so only the scheduler is measured: the
+  tick takes every due release from the core as the dispatchers of both boards do. Every count is run twice, with the
+  LCD runnable and with it suspended as on the board while the LCD has nothing to write, only the second one has
+  ticks that release nothing (the idle column). The same runnables are dispatched by
+  a bare linear scan of all the runnables every tick (how MC1 found its releases before the core, with no order and no
+  critical section) for comparison. The core is built with its heap or with its scan (SCHED_CORE_QUEUE).
+  The cycles are the time stamp counter of the host (the clock on other hosts), the cost of reading it is taken off and
+  every tick keeps its least cost over BENCH_TRIALS runs of the same ticks so the interrupts of the host do not count.
+  They show how the cost scales with the runnables not the cycles of the STM32F401, on the board SCHED_LOAD gives the
+  busy cycles of the busiest tick (PeakTickUtilisation).
+
+  Build and run from Clock_Stopwatch:
+      gcc -O2 -Itools/sched_bench -ICOMMON/include tools/sched_bench/sched_bench.c COMMON/src/SCHED_CORE.c -o sched_bench
+      ./sched_bench                   # 5, 20 and 100 runnables
+      ./sched_bench 10 50 200         # other counts, SCHED_CORE_MAX_RUNNABLES at most
+  Add -DSCHED_CORE_QUEUE=SCHED_CORE_QUEUE_SCAN to the build to measure the scan of the core (the boards' default).*/
+
+/*---------------------------------------------------------------------------------------------------*/
+/*                                           Includes:                                               */
+/*---------------------------------------------------------------------------------------------------*/
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "SCHED_CORE.h"
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+/*---------------------------------------------------------------------------------------------------*/
+/*                                           Defines:                                                */
+/*---------------------------------------------------------------------------------------------------*/
+/*ticks of the warm up and of the measure, the measure covers 20 periods of the slowest runnable*/
+#define BENCH_WARMUP_TICKS          2000
+#define BENCH_TICKS                 20000
+#define BENCH_TRIALS                5
+
+#define BENCH_PERIODS_NUMBER        (sizeof(BENCH_Periods) / sizeof(BENCH_Periods[0]))
+
+/*---------------------------------------------------------------------------------------------------*/
+/*                                           Typedefs:                                               */
+/*---------------------------------------------------------------------------------------------------*/
+typedef struct
+{
+    uint32_t Mean;
+    uint32_t P99;
+    uint32_t Max;
+    uint32_t IdleMean;                          //mean of the ticks that release nothing
+    uint32_t IdleTicks;
+    uint32_t PerRelease;                        //mean of the busy ticks over their releases
+    uint32_t Releases;                          //releases of the measure, the same for both dispatchers
+}BENCH_Result_t;
+
+/*---------------------------------------------------------------------------------------------------*/
+/*                                           Variables:                                              */
+/*---------------------------------------------------------------------------------------------------*/
+/*periods in ticks of 1 ms of the runnables after the first one, the mix of the runnables of both boards*/
+static const uint32_t BENCH_Periods [] = {10, 20, 30, 50, 100, 200, 500, 1000};
+
+/*the runnables for the linear scan*/
+static uint32_t BENCH_NextRelease [SCHED_CORE_MAX_RUNNABLES];
+static uint32_t BENCH_Period [SCHED_CORE_MAX_RUNNABLES];
+static uint32_t BENCH_Active [SCHED_CORE_MAX_RUNNABLES];
+
+static uint32_t BENCH_TickCycles [BENCH_TICKS];
+static uint32_t BENCH_TickReleases [BENCH_TICKS];
+
+/*the calls, volatile so the empty runnable is not taken out of the loop*/
+static volatile uint32_t BENCH_Calls = 0;
+
+static uint32_t BENCH_Seed = 1;
+
+/*---------------------------------------------------------------------------------------------------*/
+/*                                           Static Function:                                        */
+/*---------------------------------------------------------------------------------------------------*/
+static inline uint64_t BENCH_Cycles (void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    struct timespec Now;
+    clock_gettime(CLOCK_MONOTONIC, &Now);
+    return ((uint64_t)Now.tv_sec * 1000000000ULL) + (uint64_t)Now.tv_nsec;
+#endif
+}
+
+static uint32_t BENCH_Random (void)
+{
+    BENCH_Seed = (BENCH_Seed * 1103515245UL) + 12345UL;
+    return (BENCH_Seed >> 16) & 0x7FFF;
+}
+
+static void BENCH_Runnable (void)
+{
+    BENCH_Calls++;
+}
+
+/*cost of reading the counter, the least of many reads*/
+static uint32_t BENCH_Overhead (void)
+{
+    uint64_t Least = ~0ULL;
+    uint64_t Start = 0;
+    for(uint32_t itr = 0 ; itr < 10000 ; itr++)
+    {
+        Start = BENCH_Cycles();
+        Start = BENCH_Cycles() - Start;
+        if(Start < Least)
+        {
+            Least = Start;
+        }
+    }
+    return (uint32_t)Least;
+}
+
+static int BENCH_Compare (const void* First, const void* Second)
+{
+    uint32_t A = *(const uint32_t*)First;
+    uint32_t B = *(const uint32_t*)Second;
+    return (A > B) - (A < B);
+}
+
+/*give the same runnables to the core and to the scan, the LCD runnable (the first one) is suspended if Lcd is 0*/
+static void BENCH_Setup (uint32_t Runnables, uint32_t Lcd)
+{
+    BENCH_Seed = 1;
+    SCHED_CoreInit();
+    for(uint32_t itr = 0 ; itr < Runnables ; itr++)
+    {
+        BENCH_Period[itr] = (itr == 0) ? 1 : BENCH_Periods[BENCH_Random() % BENCH_PERIODS_NUMBER];
+        BENCH_NextRelease[itr] = BENCH_Random() % BENCH_Period[itr];
+        BENCH_Active[itr] = 1;
+        SCHED_CoreAdd(itr, 0, BENCH_NextRelease[itr], BENCH_Period[itr], SCHED_CORE_BACKLOG_RUN_ALL);
+    }
+    if(Lcd == 0)
+    {
+        BENCH_Active[0] = 0;
+        SCHED_CoreSuspend(0);
+    }
+}
+
+/*one tick of the dispatchers of the boards, every due release is taken from the core*/
+static uint32_t BENCH_CoreTick (uint32_t Now, uint32_t Runnables)
+{
+    SCHED_CoreRelease_t Release;
+    uint32_t Released = 0;
+    (void)Runnables;
+    while(SCHED_CoreTakeDue(0, Now, 0, &Release))
+    {
+        if(Release.Call)
+        {
+            BENCH_Runnable();
+        }
+        Released++;
+    }
+    return Released;
+}
+
+/*one tick of a scan of all the runnables, as MC1 did with its masks*/
+static uint32_t BENCH_ScanTick (uint32_t Now, uint32_t Runnables)
+{
+    uint32_t Released = 0;
+    for(uint32_t itr = 0 ; itr < Runnables ; itr++)
+    {
+        if((BENCH_Active[itr]) && ((int32_t)(Now - BENCH_NextRelease[itr]) >= 0))
+        {
+            BENCH_Runnable();
+            BENCH_NextRelease[itr] += BENCH_Period[itr];
+            Released++;
+        }
+    }
+    return Released;
+}
+
+static BENCH_Result_t BENCH_Run (uint32_t (*Tick) (uint32_t Now, uint32_t Runnables), uint32_t Runnables, uint32_t Lcd,
+                                 uint32_t Overhead)
+{
+    BENCH_Result_t Result = {0};
+    uint64_t Start = 0;
+    uint64_t Total = 0;
+    uint64_t Idle = 0;
+    uint64_t Busy = 0;
+    uint32_t IdleTicks = 0;
+    uint32_t Releases = 0;
+    uint32_t Now = 0;
+
+    for(uint32_t Trial = 0 ; Trial < BENCH_TRIALS ; Trial++)
+    {
+        /*the runnables start again from the same phases, so the ticks of every trial are the same*/
+        BENCH_Setup(Runnables, Lcd);
+        for(Now = 0 ; Now < BENCH_WARMUP_TICKS ; Now++)
+        {
+            (void)Tick(Now, Runnables);
+        }
+        for(uint32_t itr = 0 ; itr < BENCH_TICKS ; itr++, Now++)
+        {
+            Start = BENCH_Cycles();
+            BENCH_TickReleases[itr] = Tick(Now, Runnables);
+            Start = BENCH_Cycles() - Start;
+            Start = (Start > Overhead) ? (Start - Overhead) : 0;
+            if((Trial == 0) || (Start < BENCH_TickCycles[itr]))
+            {
+                BENCH_TickCycles[itr] = (uint32_t)Start;
+            }
+        }
+    }
+
+    for(uint32_t itr = 0 ; itr < BENCH_TICKS ; itr++)
+    {
+        Total += BENCH_TickCycles[itr];
+        if(BENCH_TickReleases[itr] == 0)
+        {
+            Idle += BENCH_TickCycles[itr];
+            IdleTicks++;
+        }
+        else
+        {
+            Busy += BENCH_TickCycles[itr];
+            Releases += BENCH_TickReleases[itr];
+        }
+    }
+    Result.Mean = (uint32_t)(Total / BENCH_TICKS);
+    Result.IdleMean = (IdleTicks) ? (uint32_t)(Idle / IdleTicks) : 0;
+    Result.IdleTicks = IdleTicks;
+    Result.PerRelease = (Releases) ? (uint32_t)(Busy / Releases) : 0;
+    Result.Releases = Releases;
+    qsort(BENCH_TickCycles, BENCH_TICKS, sizeof(BENCH_TickCycles[0]), BENCH_Compare);
+    Result.P99 = BENCH_TickCycles[(BENCH_TICKS * 99) / 100];
+    Result.Max = BENCH_TickCycles[BENCH_TICKS - 1];
+    return Result;
+}
+
+/*---------------------------------------------------------------------------------------------------*/
+/*                                           APIs:                                                   */
+/*---------------------------------------------------------------------------------------------------*/
+int main (int argc, char** argv)
+{
+    static const uint32_t Default [] = {5, 20, 100};
+    uint32_t Counts [16];
+    uint32_t CountsNumber = 0;
+    uint32_t Overhead = BENCH_Overhead();
+    BENCH_Result_t Core;
+    BENCH_Result_t Scan;
+    char Idle [24];
+    uint32_t Lcd = 0;
+
+    for(int itr = 1 ; (itr < argc) && (CountsNumber < 16) ; itr++)
+    {
+        Counts[CountsNumber] = (uint32_t)strtoul(argv[itr], NULL, 10);
+        if((Counts[CountsNumber] == 0) || (Counts[CountsNumber] > SCHED_CORE_MAX_RUNNABLES))
+        {
+            fprintf(stderr, "sched_bench: the runnables must be 1 to %d\n", SCHED_CORE_MAX_RUNNABLES);
+            return 1;
+        }
+        CountsNumber++;
+    }
+    if(CountsNumber == 0)
+    {
+        for(CountsNumber = 0 ; CountsNumber < 3 ; CountsNumber++)
+        {
+            Counts[CountsNumber] = Default[CountsNumber];
+        }
+    }
+
+    printf("host cycles per tick, least of %d trials of %d ticks, counter read of %u cycles taken off\n", BENCH_TRIALS,
+           BENCH_TICKS, Overhead);
+    printf("  %-9s %-4s | %-52s | %s\n", "", "", (SCHED_CORE_QUEUE == SCHED_CORE_QUEUE_HEAP) ? "core (heap)" : "core (scan)",
+           "bare linear scan");
+    printf("  %-9s %-4s | %6s %6s %6s %13s %8s %8s | %6s %6s %6s\n", "runnables", "lcd", "mean", "p99", "max", "idle (ticks)",
+           "/release", "releases", "mean", "p99", "max");
+    for(uint32_t itr = 0 ; itr < CountsNumber ; itr++)
+    {
+        for(uint32_t Off = 0 ; Off < 2 ; Off++)
+        {
+            Lcd = (Off == 0);
+            Core = BENCH_Run(BENCH_CoreTick, Counts[itr], Lcd, Overhead);
+            Scan = BENCH_Run(BENCH_ScanTick, Counts[itr], Lcd, Overhead);
+            if(Core.Releases != Scan.Releases)
+            {
+                fprintf(stderr, "sched_bench: the core released %u runnables and the scan %u\n", Core.Releases, Scan.Releases);
+                return 1;
+            }
+            /*with the LCD runnable every tick releases it, there is no idle tick to measure*/
+            if(Core.IdleTicks)
+            {
+                snprintf(Idle, sizeof(Idle), "%u (%u)", Core.IdleMean, Core.IdleTicks);
+            }
+            else
+            {
+                snprintf(Idle, sizeof(Idle), "-");
+            }
+            printf("  %-9u %-4s | %6u %6u %6u %13s %8u %8u | %6u %6u %6u\n", Counts[itr], (Lcd) ? "on" : "off", Core.Mean,
+                   Core.P99, Core.Max, Idle, Core.PerRelease, Core.Releases, Scan.Mean, Scan.P99, Scan.Max);
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,249 @@
+#!/usr/bin/env python3
+"""Choose the first delays of the runnables that flatten the load of the scheduler ticks.
+
+The runnables of a board are released at firstDelay + n * period, so with
+hand-picked delays several runnables may be released at the same tick while
+the ticks around it stay idle.  This tool takes the worst case execution time
+(WCET) of every runnable and picks for each runnable a phase, an extra delay
+between 0 and its period - 1, that minimises the worst tick load of the
+hyperperiod (the sum of the WCETs of the runnables released at a tick).
+
+Only the runnables whose delay in the configuration is written as
+<minimum delay> + SCHED_PHASE_<RunnableID> are moved, so a runnable that must
+start at an exact time keeps a plain number.  The phases are written to the
+generated header of the board (SCHED_PHASE.h on MC1, SCHED_phase.h on MC2).
+
+The WCETs are read from tools/<board>_wcet.txt, one "<RunnableID> <us>" per
+line.  The values in the tree are estimates, replace them with the measured
+MaxExecCycles of SCHED_GetRunnableStats / SCHED_enuGetRunnableStats divided by
+the core clock in MHz.
+
+Usage:
+    tools/sched_offsets.py mc1            # write MC1's SCHED_PHASE.h
+    tools/sched_offsets.py mc2 --check    # fail if MC2's phases are out of date
+
+Run tools/sched_table.py again afterwards when the table dispatch is used.
+"""
+
+import argparse
+import math
+import os
+import re
+import sys
+
+from sched_table import BOARDS, ROOT, ConfigError, build_table, parse_fields, parse_runnables, tick_us, to_crlf
+
+PHASE_PREFIX = "SCHED_PHASE_"
+
+
+class ZeroPhases(dict):
+    """Defines seen by the config parser when every phase is 0, which gives the minimum delays."""
+
+    def __contains__(self, name):
+        return name.startswith(PHASE_PREFIX)
+
+    def __getitem__(self, name):
+        return 0
+
+
+def read_wcet(path, names):
+    wcet = {}
+    with open(path) as f:
+        for number, line in enumerate(f, 1):
+            line = line.split("#", 1)[0].split()
+            if not line:
+                continue
+            if len(line) != 2 or line[0] not in names:
+                raise ConfigError("%s:%d: expected <RunnableID> <us> with one of %s" % (path, number, ", ".join(names)))
+            wcet[line[0]] = float(line[1])
+    missing = [n for n in names if n not in wcet]
+    if missing:
+        raise ConfigError("%s: no WCET for %s" % (path, ", ".join(missing)))
+    return wcet
+
+
+def hyperperiod(runnables):
+    cycle = 1
+    for _, _, period, cb in runnables:
+        if cb and period:
+            cycle = cycle * period // math.gcd(cycle, period)
+    return cycle
+
+
+def steady_load(runnables, wcet, cycle):
+    """Load of every tick of one hyperperiod once all the periodic runnables are released."""
+    load = [0.0] * cycle
+    for name, delay, period, cb in runnables:
+        if cb and period:
+            for t in range(delay % period, cycle, period):
+                load[t] += wcet[name]
+    return load
+
+
+def cost(load):
+    """Worst tick first, then the number of ticks at the worst load, then how flat the rest is."""
+    peak = max(load)
+    return (round(peak, 6), sum(1 for v in load if abs(v - peak) < 1e-9), round(sum(v * v for v in load), 6))
+
+
+def optimise(minimum, movable, wcet, cycle, step):
+    """Return {name: phase in ticks} of the movable runnables, the phases are multiples of step (1 ms)."""
+    delays = dict((name, delay) for name, delay, _, _ in minimum)
+    periods = dict((name, period) for name, _, period, _ in minimum)
+    phases = dict((name, 0) for name in movable)
+    load = steady_load([r for r in minimum if r[0] not in movable], wcet, cycle)
+
+    def add(name, sign):
+        period = periods[name]
+        for t in range((delays[name] + phases[name]) % period, cycle, period):
+            load[t] += sign * wcet[name]
+
+    def place(name):
+        best = None
+        for phase in range(0, periods[name], step):
+            phases[name] = phase
+            add(name, 1)
+            candidate = cost(load)
+            add(name, -1)
+            if best is None or candidate < best[0]:
+                best = (candidate, phase)
+        phases[name] = best[1]
+        add(name, 1)
+        return best[1]
+
+    # the heaviest runnables are placed first, then every runnable is moved again
+    # to its best phase while the others stay, till no move makes the load flatter
+    order = sorted(movable, key=lambda name: (-wcet[name], periods[name], name))
+    for name in order:
+        place(name)
+    for _ in range(20):
+        changed = False
+        for name in order:
+            previous = phases[name]
+            add(name, -1)
+            if place(name) != previous:
+                changed = True
+        if not changed:
+            break
+    return phases
+
+
+def worst_tick(runnables, wcet):
+    """Return (worst load, first tick with it) over the prologue and one hyperperiod."""
+    _, table = build_table(runnables)
+    names = [name for name, _, _, _ in runnables]
+    loads = [sum(wcet[names[i]] for i in range(len(names)) if mask & (1 << i)) for mask in table]
+    peak = max(loads)
+    return peak, loads.index(peak)
+
+
+def render_mc1(board, phases, per_ms, before, after, wcet_file):
+    source = board["config_file"].split("/", 1)[1]
+    lines = "\n".join("#define %-36s%d" % (PHASE_PREFIX + name, phase // per_ms) for name, phase in phases.items())
+    return """/*generated by tools/sched_offsets.py from the WCETs in {wcet}, do not edit, run the tool again after changing
+  the runnables or their WCETs*/
+#ifndef _SCHED_PHASE_H
+#define _SCHED_PHASE_H
+
+
+/********************************************************Defines:*************************************************/
+/*extra first delay in ms of the runnables of {source}, worst tick load {before:g} us with all the phases 0,
+  {after:g} us with these ones*/
+{lines}
+
+#endif
+""".format(wcet=wcet_file, source=source, before=before, after=after, lines=lines)
+
+
+def render_mc2(board, phases, per_ms, before, after, wcet_file):
+    source = board["config_file"].split("/", 1)[1]
+    # the values are aligned with tabs like the other headers of MC2
+    lines = "\n".join("#define %s%s%d" % (PHASE_PREFIX + name, "\t" * ((44 - len("#define " + PHASE_PREFIX + name)) // 4 + 1), phase // per_ms)
+                      for name, phase in phases.items())
+    return """/******************************************************************************
+ *
+ * File Name: SCHED_phase.h
+ *
+ * Description: Phases of the runnables, generated by tools/sched_offsets.py from the
+ * 				WCETs in {wcet}, do not edit, run the tool again after changing the
+ * 				runnables or their WCETs.
+ *
+ *******************************************************************************/
+
+#ifndef SCHED_PHASE_H_
+#define SCHED_PHASE_H_
+
+/************************************************************************************/
+/*								Macros Declaration									*/
+/************************************************************************************/
+
+/* Extra first delay in ms of the runnables of {source}, worst tick load
+ * {before:g} us with all the phases 0, {after:g} us with these ones */
+{lines}
+
+#endif /* SCHED_PHASE_H_ */
+""".format(wcet=wcet_file, source=source, before=before, after=after, lines=lines)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n\n")[0])
+    parser.add_argument("board", choices=sorted(BOARDS))
+    parser.add_argument("--wcet", help="WCET file (default tools/<board>_wcet.txt)")
+    parser.add_argument("--check", action="store_true",
+                        help="only compare with the header in the tree, exit 1 if it is out of date")
+    args = parser.parse_args()
+
+    board = BOARDS[args.board]
+    wcet_file = args.wcet or os.path.join("tools", "%s_wcet.txt" % args.board)
+    try:
+        ids, entries = parse_fields(board)
+        per_ms = 1000 // tick_us(board)
+        minimum = parse_runnables(board, ZeroPhases())
+        # the first run has no phase header yet
+        exists = os.path.exists(os.path.join(ROOT, board["phase_header"]))
+        current = parse_runnables(board) if exists else minimum
+        wcet = read_wcet(os.path.join(ROOT, wcet_file), ids)
+    except (ConfigError, OSError) as error:
+        sys.exit("sched_offsets: %s" % error)
+
+    movable = [name for name in ids
+               if re.search(r"\b%s%s\b" % (PHASE_PREFIX, name), entries.get(name, {}).get(board["delay"], ""))]
+    periods = dict((name, period) for name, _, period, cb in minimum if cb)
+    for name in movable:
+        if not periods.get(name):
+            sys.exit("sched_offsets: %s has a phase but it is not a periodic runnable" % name)
+
+    cycle = hyperperiod(minimum)
+    phases = optimise(minimum, movable, wcet, cycle, per_ms)
+    optimised = [(name, delay + phases.get(name, 0), period, cb) for name, delay, period, cb in minimum]
+
+    before, before_tick = worst_tick(minimum, wcet)
+    now, now_tick = worst_tick(current, wcet)
+    after, after_tick = worst_tick(optimised, wcet)
+
+    render = render_mc1 if args.board == "mc1" else render_mc2
+    text = to_crlf(render(board, phases, per_ms, before, after, wcet_file))
+    path = os.path.join(ROOT, board["phase_header"])
+    stale = False
+    if args.check:
+        existing = open(path, newline="").read() if os.path.exists(path) else None
+        if existing != text:
+            print("%s is out of date" % board["phase_header"])
+            stale = True
+    else:
+        with open(path, "w", newline="") as f:
+            f.write(text)
+
+    print("%s: hyperperiod %d ticks, %d of %d runnables moved" % (args.board, cycle, len(movable), len(ids)))
+    for name in movable:
+        print("  %-24s period %4d  delay %4d -> %4d" % (name, periods[name], dict((n, d) for n, d, _, _ in current)[name],
+                                                        dict((n, d) for n, d, _, _ in optimised)[name]))
+    print("worst tick load: %g us at tick %d with the phases 0, %g us at tick %d in the tree, %g us at tick %d optimised"
+          % (before, before_tick, now, now_tick, after, after_tick))
+    if not args.check and (now != after or current != optimised):
+        print("run tools/sched_table.py %s again if the table dispatch is used" % args.board)
+    sys.exit(1 if stale else 0)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,187 @@
+#!/usr/bin/env python3
+"""Check that every runnable of a board meets its deadline with response-time analysis.
+
+The runnables run to completion, so a runnable released while another one is
+running waits for it: it is blocked by the longest runnable of its class with a
+lower priority, then it waits for the higher priority runnables of its class
+released before it starts.  The runnables of the preemptive class (PendSV)
+also interrupt the cooperative ones at any point, and the systick interrupt
+interrupts both classes every tick.  The priority inside a class is the
+runnable ID, the order both schedulers dispatch the releases of a tick in.
+
+For every periodic runnable the tool computes the worst case response time,
+the longest time from a release to the end of its call, over all the jobs of
+the level-i busy period (non-preemptive response-time analysis), and flags the
+runnables whose response can exceed their period, the deadline of a release
+being the next release.  The first releases are assumed to coincide (the
+critical instant), so the result does not depend on the phases.  A runnable
+subscribed to events is assumed to be released at most once per period.
+
+The WCETs are read from tools/<board>_wcet.txt like tools/sched_offsets.py.
+On MC1 the execution times measured in a trace dump (TRACE_Dump) can be given
+with --trace, they replace the figures of the file for the runnables seen in
+the dump.
+
+Usage:
+    tools/sched_rta.py mc1                         # report, exit 1 if a deadline is missed
+    tools/sched_rta.py mc1 --trace trace.bin       # WCETs measured by the trace
+    tools/sched_rta.py mc2 --tick-cost 5           # systick handler costs 5 us every tick
+    tools/sched_rta.py mc1 --all-cooperative       # as if every runnable ran in the super loop
+
+Run it after changing the runnables or their WCETs, before flashing.
+"""
+
+import argparse
+import math
+import os
+import sys
+
+from sched_offsets import hyperperiod, read_wcet
+from sched_table import BOARDS, ROOT, ConfigError, parse_fields, parse_runnables, tick_us
+
+PREEMPTIVE = "SCHED_CLASS_PREEMPTIVE"
+
+
+class Task(object):
+    def __init__(self, name, wcet, period, preemptive, events):
+        self.name = name
+        self.wcet = wcet                        # us
+        self.period = period                    # us, None for a one-shot runnable
+        self.preemptive = preemptive
+        self.events = events
+
+
+def releases(task, t, closed):
+    """Number of releases of the task in [0, t] when closed, in [0, t) otherwise, a one-shot runnable once."""
+    if task.period is None:
+        return 1
+    if closed:
+        return int(math.floor(t / task.period)) + 1
+    return int(math.ceil(t / task.period))
+
+
+def fixed_point(function, start, limit):
+    """Iterate value = function(value) from start, None when it passes limit (the load is too high)."""
+    value = start
+    while True:
+        following = function(value)
+        if following > limit:
+            return None
+        if abs(following - value) < 1e-9:
+            return following
+        value = following
+
+
+def analyse(task, tasks, tick, limit):
+    """Return (worst response in us or None, blocking in us, the blocking runnable) of a periodic runnable."""
+    index = tasks.index(task)
+    own_class = [t for t in tasks if t.preemptive == task.preemptive]
+    higher = [t for t in own_class if tasks.index(t) < index]
+    lower = [t for t in own_class if tasks.index(t) > index]
+    # they interrupt the runnable even after it started, the systick is a task of its own
+    interrupts = [t for t in tasks if t.preemptive and not task.preemptive] + ([tick] if tick.wcet else [])
+
+    blocker = max(lower, key=lambda t: t.wcet) if lower else None
+    blocking = blocker.wcet if blocker else 0.0
+
+    # level-i busy period, the jobs of the runnable released in it are checked one by one
+    busy = fixed_point(lambda t: blocking + sum(releases(j, t, False) * j.wcet for j in higher + [task] + interrupts),
+                       blocking + task.wcet, limit)
+    if busy is None:
+        return None, blocking, blocker
+
+    worst = 0.0
+    for job in range(int(math.ceil(busy / task.period))):
+        start = fixed_point(lambda s: blocking + job * task.wcet
+                            + sum(releases(j, s, True) * j.wcet for j in higher + interrupts), blocking, limit)
+        if start is None:
+            return None, blocking, blocker
+        finish = fixed_point(lambda f: start + task.wcet
+                             + sum(max(0, releases(j, f, False) - releases(j, start, True)) * j.wcet for j in interrupts),
+                             start + task.wcet, limit)
+        if finish is None:
+            return None, blocking, blocker
+        worst = max(worst, finish - job * task.period)
+    return worst, blocking, blocker
+
+
+def measured_wcet(path, ids):
+    """Longest call of every runnable in a trace dump of MC1, in us."""
+    from trace_to_perfetto import DumpError, convert, read_dump
+
+    try:
+        with open(path, "rb") as f:
+            clock, _, events = read_dump(f.read())
+        _, durations = convert(clock, events, ids)
+    except DumpError as error:
+        raise ConfigError("%s: %s" % (path, error))
+    return dict((name, max(durations[name])) for name in ids if durations.get(name))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n\n")[0])
+    parser.add_argument("board", choices=sorted(BOARDS))
+    parser.add_argument("--wcet", help="WCET file (default tools/<board>_wcet.txt)")
+    parser.add_argument("--trace", help="trace dump of MC1 whose longest runnable calls replace the WCET file")
+    parser.add_argument("--tick-cost", type=float, default=0.0, metavar="US",
+                        help="time of the systick interrupt and the dispatch of a tick without runnables (default 0)")
+    parser.add_argument("--all-cooperative", action="store_true",
+                        help="analyse every runnable as a cooperative one, to see why a runnable needs the preemptive class")
+    args = parser.parse_args()
+
+    board = BOARDS[args.board]
+    wcet_file = args.wcet or os.path.join("tools", "%s_wcet.txt" % args.board)
+    if args.trace and args.board != "mc1":
+        sys.exit("sched_rta: only MC1 records a trace")
+    try:
+        ids, entries = parse_fields(board)
+        tick = tick_us(board)
+        runnables = parse_runnables(board)
+        wcet = read_wcet(os.path.join(ROOT, wcet_file), ids)
+        measured = measured_wcet(args.trace, ids) if args.trace else {}
+    except (ConfigError, OSError) as error:
+        sys.exit("sched_rta: %s" % error)
+
+    tasks = []
+    for name, _, period, cb in runnables:
+        if not cb:
+            continue
+        fields = entries.get(name, {})
+        preemptive = not args.all_cooperative and fields.get(board["class"], "").strip() == PREEMPTIVE
+        events = bool(fields.get(board["events"], "").strip())
+        tasks.append(Task(name, measured.get(name, wcet[name]), period * tick if period else None, preemptive, events))
+    systick = Task("systick", args.tick_cost, tick, True, False)
+
+    utilisation = sum(t.wcet / t.period for t in tasks if t.period) + systick.wcet / systick.period
+    # a busy period of a schedulable set is shorter than the hyperperiod plus the one-shot runnables
+    limit = 2 * hyperperiod(runnables) * tick + sum(t.wcet for t in tasks)
+
+    print("%s: tick %d us, utilisation %.1f %%, WCETs from %s%s" % (args.board, tick, 100 * utilisation, wcet_file,
+                                                                   " and %s" % args.trace if measured else ""))
+    print("  %-20s %-5s %9s %8s %9s %9s %9s  %s" % ("runnable", "class", "period us", "wcet us", "block us",
+                                                    "resp. us", "slack us", "blocked by"))
+    missed = []
+    for task in tasks:
+        if task.period is None:
+            print("  %-20s %-5s %9s %8g %9s %9s %9s" % (task.name, "pre" if task.preemptive else "coop", "once",
+                                                         task.wcet, "-", "-", "-"))
+            continue
+        response, blocking, blocker = analyse(task, tasks, systick, limit)
+        if response is None or response > task.period + 1e-9:
+            missed.append(task.name)
+        print("  %-20s %-5s %9d %8g %9g %9s %9s  %s%s%s" % (
+            task.name, "pre" if task.preemptive else "coop", task.period, task.wcet, blocking,
+            "%g" % round(response, 3) if response is not None else "inf",
+            "%g" % round(task.period - response, 3) if response is not None else "-",
+            blocker.name if blocker else "-",
+            "  (events assumed once per period)" if task.events else "",
+            "  MISSED" if task.name in missed else ""))
+
+    if missed:
+        print("deadline missed by %s" % ", ".join(missed))
+        sys.exit(1)
+    print("every runnable meets its deadline")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,390 @@
+#!/usr/bin/env python3
+"""Generate the cyclic-executive release table of a board's scheduler.
+
+The runnables configuration of both boards is a static array, so the ticks at
+which every runnable is released (firstDelay + n * period) are known at build
+time.  This tool reads the configuration and writes a table with one entry per
+tick: bit n of an entry is set when the runnable with ID n is released at that
+tick.  With the table dispatch mode the scheduler only walks the table.
+
+The table is made of a prologue, the ticks before every runnable reaches its
+steady pattern (the first delays and the one-shot runnables), followed by one
+hyperperiod that the scheduler repeats forever.
+
+Usage:
+    tools/sched_table.py mc1            # write MC1's SCHED_TABLE.h/.c
+    tools/sched_table.py mc2 --check    # fail if MC2's table is out of date
+
+Run it again after changing the runnables configuration.
+"""
+
+import argparse
+import math
+import os
+import re
+import sys
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+
+BOARDS = {
+    "mc1": {
+        "enum_file": "MC1/include/SERVICE/RUNNABLE.h",
+        "enum_last": "_RunnableNumber",
+        "config_file": "MC1/src/SERVICE/Runnables.c",
+        "array": "Runnables_Arr",
+        "period": "Periodicity",
+        "period_us": "PeriodicityUs",
+        "delay": "DelayMs",
+        "callback": "CB",
+        "class": "Class",
+        "events": "Events",
+        "tick_header": "MC1/include/SERVICE/SCHED.h",
+        "phase_header": "MC1/include/SERVICE/SCHED_PHASE.h",
+        "header": "MC1/include/SERVICE/SCHED_TABLE.h",
+        "source": "MC1/src/SERVICE/SCHED_TABLE.c",
+    },
+    "mc2": {
+        "enum_file": "MC2/include/CFG/SCHED/SCHED_config.h",
+        "enum_last": "_RunnablesNumber_",
+        "config_file": "MC2/src/CFG/SCHED/SCHED_config.c",
+        "array": "arrayOfRunnables",
+        "period": "periodicityMS",
+        "period_us": "periodicityUS",
+        "delay": "firstDelay",
+        "callback": "callBackFn",
+        "class": "schedClass",
+        "events": "events",
+        "tick_header": "MC2/include/CFG/SCHED/SCHED_config.h",
+        "phase_header": "MC2/include/CFG/SCHED/SCHED_phase.h",
+        "header": "MC2/include/CFG/SCHED/SCHED_table.h",
+        "source": "MC2/src/CFG/SCHED/SCHED_table.c",
+    },
+}
+
+
+class ConfigError(Exception):
+    pass
+
+
+def strip_comments(text):
+    text = re.sub(r"/\*.*?\*/", " ", text, flags=re.S)
+    return re.sub(r"//[^\n]*", " ", text)
+
+
+def read(path):
+    with open(os.path.join(ROOT, path), encoding="utf-8", errors="replace") as f:
+        return f.read()
+
+
+def parse_ids(path, last):
+    """Return the runnable names in ID order from the enum ending with `last`."""
+    text = strip_comments(read(path))
+    for body in re.findall(r"enum\s*\w*\s*\{(.*?)\}", text, flags=re.S):
+        names = [n.split("=")[0].strip() for n in body.split(",")]
+        names = [n for n in names if n]
+        if last in names:
+            return names[:names.index(last)]
+    raise ConfigError("%s: no enum ends with %s" % (path, last))
+
+
+def parse_defines(path):
+    """Return the numeric #defines of a header, {} if it does not exist."""
+    if not os.path.exists(os.path.join(ROOT, path)):
+        return {}
+    text = strip_comments(read(path))
+    return dict((name, int(value, 0)) for name, value in
+                re.findall(r"#define\s+(\w+)\s+(\d+|0[xX][0-9a-fA-F]+)[uUlL]*\s*$", text, flags=re.M))
+
+
+def parse_value(text, field, name, defines):
+    """Evaluate a field written as a number or a sum of numbers and #defines (200 + SCHED_PHASE_x)."""
+    terms = []
+    for term in re.split(r"\s*\+\s*", text.strip()):
+        term = term.strip("() \t\n").rstrip("uUlL")
+        if term in defines:
+            terms.append(defines[term])
+            continue
+        try:
+            terms.append(int(term, 0))
+        except ValueError:
+            raise ConfigError("%s.%s = %s is not a number or a sum of known #defines" % (name, field, text.strip()))
+    return sum(terms)
+
+
+def parse_fields(board):
+    """Return (ids, {id: {field: text}}) of the runnables array, the field values are not evaluated."""
+    ids = parse_ids(board["enum_file"], board["enum_last"])
+    text = strip_comments(read(board["config_file"]))
+    match = re.search(re.escape(board["array"]) + r"\s*\[[^\]]*\]\s*=\s*\{(.*)\}\s*;", text, flags=re.S)
+    if not match:
+        raise ConfigError("%s: %s not found" % (board["config_file"], board["array"]))
+
+    entries = {}
+    for name, body in re.findall(r"\[\s*(\w+)\s*\]\s*=\s*\{([^{}]*)\}", match.group(1)):
+        fields = dict((f, v) for f, v in re.findall(r"\.(\w+)\s*=\s*([^,]+)", body))
+        entries[name] = fields
+    return ids, entries
+
+
+def tick_us(board):
+    """Return SCHED_TICK_US of the board, the delays and periods in ms are converted to ticks of this length."""
+    tick = parse_defines(board["tick_header"]).get("SCHED_TICK_US", 1000)
+    if tick <= 0 or 1000 % tick:
+        raise ConfigError("%s: SCHED_TICK_US = %d does not divide 1000" % (board["tick_header"], tick))
+    return tick
+
+
+def parse_runnables(board, phases=None):
+    """Return [(name, delay_ticks, period_ticks or 0, has_callback)] in ID order.
+
+    The phase #defines are read from the board's phase header unless `phases`
+    gives their values (the offset optimizer passes zeros to get the minimum delays).
+    The periods in us are rounded to ticks like the scheduler does.
+    """
+    ids, entries = parse_fields(board)
+    defines = phases if phases is not None else parse_defines(board["phase_header"])
+    per_ms = 1000 // tick_us(board)
+    runnables = []
+    for name in ids:
+        fields = entries.get(name, {})
+        delay = parse_value(fields.get(board["delay"], "0"), board["delay"], name, defines)
+        period = parse_value(fields.get(board["period"], "0"), board["period"], name, defines) * per_ms
+        period_us = parse_value(fields.get(board["period_us"], "0"), board["period_us"], name, defines)
+        if period_us:
+            period = max(1, period_us // tick_us(board))
+        runnables.append((name, delay * per_ms, period, board["callback"] in fields))
+    return runnables
+
+
+def build_table(runnables):
+    """Return (prologue, table) where table[t] is the release mask of tick t."""
+    periods = [p for _, _, p, cb in runnables if cb and p]
+    cycle = 1
+    for p in periods:
+        cycle = cycle * p // math.gcd(cycle, p)
+
+    # every periodic runnable is in its steady pattern from its first release,
+    # a one-shot runnable must be released inside the prologue
+    prologue = 0
+    for _, delay, period, cb in runnables:
+        if cb:
+            prologue = max(prologue, delay if period else delay + 1)
+
+    table = [0] * (prologue + cycle)
+    for index, (_, delay, period, cb) in enumerate(runnables):
+        if not cb:
+            continue
+        if period == 0:
+            table[delay] |= 1 << index
+            continue
+        for t in range(delay, prologue + cycle, period):
+            table[t] |= 1 << index
+    return prologue, table
+
+
+def entry_type(count, board_name):
+    bits = 8 if count <= 8 else 16 if count <= 16 else 32
+    if board_name == "mc1":
+        return "uint%d_t" % bits
+    return "u%d" % bits
+
+
+def format_rows(table, digits, indent):
+    rows = []
+    for start in range(0, len(table), 16):
+        values = ", ".join("0x%0*X" % (digits, v) for v in table[start:start + 16])
+        rows.append("%s%s,%s/* %d */" % (indent, values, " " * 4, start))
+    rows[-1] = rows[-1].replace(",    /*", "     /*", 1)
+    return "\n".join(rows)
+
+
+def render_mc1(board, runnables, prologue, table, peak):
+    ctype = entry_type(len(runnables), "mc1")
+    digits = int(ctype[4:-2]) // 4
+    source = board["config_file"].split("/", 1)[1]
+    header = """/*generated by tools/sched_table.py from {source}, do not edit, run the tool again after changing the runnables*/
+#ifndef _SCHED_TABLE_H
+#define _SCHED_TABLE_H
+
+
+/********************************************************Includes:************************************************/
+#include <stdint.h>
+
+
+/********************************************************Defines:*************************************************/
+#define SCHED_TABLE_RUNNABLES       {count:<12d}//number of runnables the table was generated for
+#define SCHED_TABLE_TICK_US         {tick:<12d}//SCHED_TICK_US the table was generated for
+#define SCHED_TABLE_PROLOGUE        {prologue:<12d}//ticks before the repeated part (first delays and one-shot runnables)
+#define SCHED_TABLE_LENGTH          {length:<12d}//the prologue then one hyperperiod of {cycle} ticks
+#define SCHED_TABLE_PEAK_RELEASES   {peak:<12d}//most runnables released at a single tick
+
+
+/********************************************************Types:***************************************************/
+typedef {ctype} SCHED_TableEntry_t;
+
+
+/********************************************************Variables:***********************************************/
+/*bit n of entry t is set if the runnable with ID n is released at tick t*/
+extern const SCHED_TableEntry_t SCHED_Table [SCHED_TABLE_LENGTH];
+
+#endif
+""".format(source=source, count=len(runnables), prologue=prologue, length=len(table),
+           cycle=len(table) - prologue, peak=peak, ctype=ctype, tick=tick_us(board))
+    body = """/*generated by tools/sched_table.py from {source}, do not edit, run the tool again after changing the runnables*/
+/*---------------------------------------------------------------------------------------------------*/
+/*                                           Includes:                                               */
+/*---------------------------------------------------------------------------------------------------*/
+#include <Service/SCHED_TABLE.h>
+
+/*---------------------------------------------------------------------------------------------------*/
+/*                                           Release Table                                           */
+/*---------------------------------------------------------------------------------------------------*/
+{legend}
+const SCHED_TableEntry_t SCHED_Table [SCHED_TABLE_LENGTH] =
+{{
+{rows}
+}};
+""".format(source=source, legend=legend(runnables, "/*", "*/", ""), rows=format_rows(table, digits, "    "))
+    return header, body
+
+
+def render_mc2(board, runnables, prologue, table, peak):
+    ctype = entry_type(len(runnables), "mc2")
+    digits = int(ctype[1:]) // 4
+    source = board["config_file"].split("/", 1)[1]
+    header = """/******************************************************************************
+ *
+ * File Name: SCHED_table.h
+ *
+ * Description: Release table of the runnables, generated by tools/sched_table.py
+ * 				from {source}, do not edit, run the tool again after changing
+ * 				the runnables.
+ *
+ *******************************************************************************/
+
+#ifndef SCHED_TABLE_H_
+#define SCHED_TABLE_H_
+
+/************************************************************************************/
+/*									Includes										*/
+/************************************************************************************/
+
+#include "LIB/STD_TYPES.h"
+
+/************************************************************************************/
+/*								Macros Declaration									*/
+/************************************************************************************/
+
+/* Number of runnables the table was generated for */
+#define SCHED_TABLE_RUNNABLES		{count}
+/* SCHED_TICK_US the table was generated for */
+#define SCHED_TABLE_TICK_US			{tick}
+/* Ticks before the repeated part (first delays and one-shot runnables) */
+#define SCHED_TABLE_PROLOGUE		{prologue}
+/* The prologue then one hyperperiod of {cycle} ticks */
+#define SCHED_TABLE_LENGTH			{length}
+/* Most runnables released at a single tick */
+#define SCHED_TABLE_PEAK_RELEASES	{peak}
+
+/************************************************************************************/
+/*							User-defined Types Declaration							*/
+/************************************************************************************/
+
+typedef {ctype} SCHED_tableEntry_t;
+
+/* Bit n of entry t is set if the runnable with ID n is released at tick t */
+extern const SCHED_tableEntry_t SCHED_releaseTable [SCHED_TABLE_LENGTH];
+
+#endif /* SCHED_TABLE_H_ */
+""".format(source=source, count=len(runnables), prologue=prologue, length=len(table),
+           cycle=len(table) - prologue, peak=peak, ctype=ctype, tick=tick_us(board))
+    body = """/******************************************************************************
+ *
+ * File Name: SCHED_table.c
+ *
+ * Description: Release table of the runnables, generated by tools/sched_table.py
+ * 				from {source}, do not edit, run the tool again after changing
+ * 				the runnables.
+ *
+ *******************************************************************************/
+
+/************************************************************************************/
+/*									Includes										*/
+/************************************************************************************/
+
+#include "CFG/SCHED/SCHED_table.h"
+
+/************************************************************************************/
+/*								Variables' Definition								*/
+/************************************************************************************/
+
+{legend}
+const SCHED_tableEntry_t SCHED_releaseTable [SCHED_TABLE_LENGTH] = {{
+{rows}
+}};
+""".format(source=source, legend=legend(runnables, "/*", " */", " "), rows=format_rows(table, digits, "\t\t"))
+    return header, body
+
+
+def legend(runnables, opening, closing, pad):
+    lines = ["%s%sBits:" % (opening, pad)]
+    for index, (name, delay, period, cb) in enumerate(runnables):
+        if not cb:
+            what = "no callback, never released"
+        elif period:
+            what = "first at %d, every %d" % (delay, period)
+        else:
+            what = "once at %d" % delay
+        lines.append(" *%s%2d %s (%s)" % (pad, index, name, what))
+    lines[-1] += closing
+    return "\n".join(lines)
+
+
+def to_crlf(text):
+    return text.replace("\r\n", "\n").replace("\n", "\r\n")
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n\n")[0])
+    parser.add_argument("board", choices=sorted(BOARDS))
+    parser.add_argument("--check", action="store_true",
+                        help="only compare with the files in the tree, exit 1 if they are out of date")
+    args = parser.parse_args()
+
+    board = BOARDS[args.board]
+    try:
+        runnables = parse_runnables(board)
+    except ConfigError as error:
+        sys.exit("sched_table: %s" % error)
+    if len(runnables) > 32:
+        sys.exit("sched_table: %d runnables do not fit a 32-bit entry" % len(runnables))
+
+    prologue, table = build_table(runnables)
+    counts = [bin(mask).count("1") for mask in table]
+    peak = max(counts) if counts else 0
+    render = render_mc1 if args.board == "mc1" else render_mc2
+    outputs = zip((board["header"], board["source"]), render(board, runnables, prologue, table, peak))
+
+    stale = False
+    for path, text in outputs:
+        full = os.path.join(ROOT, path)
+        text = to_crlf(text)
+        if args.check:
+            current = open(full, newline="").read() if os.path.exists(full) else None
+            if current != text:
+                print("%s is out of date" % path)
+                stale = True
+        else:
+            with open(full, "w", newline="") as f:
+                f.write(text)
+
+    peak_ticks = [t for t, c in enumerate(counts) if c == peak]
+    print("%s: %d runnables, prologue %d ticks, hyperperiod %d ticks, table %d entries (%d bytes)"
+          % (args.board, len(runnables), prologue, len(table) - prologue, len(table),
+             len(table) * (8 if len(runnables) <= 8 else 16 if len(runnables) <= 16 else 32) // 8))
+    print("peak: %d runnables at %d tick(s), first at tick %d" % (peak, len(peak_ticks), peak_ticks[0] if peak_ticks else 0))
+    sys.exit(1 if stale else 0)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,67 @@
+#ifndef _SCHED_CORE_CFG_H
+#define _SCHED_CORE_CFG_H
+
+/*configuration of COMMON/SCHED_CORE and COMMON/SCHED_KERNEL for tools/sched_tickless on the host: the options of
+  MC1 (SERVICE/SCHED.h) with the mode given by the build of sched_tickless_kernel.c, no interrupts to mask and the
+  systick, PendSV and the sleep of the model of sched_tickless_kernel.c*/
+#include <stdint.h>
+#include <Service/SCHED.h>
+
+/*--------------------------------------------SCHED_CORE---------------------------------------------*/
+#define SCHED_CORE_MAX_RUNNABLES            SCHED_MAX_RUNNABLES
+#define SCHED_CORE_CLASSES                  _SCHED_ClassNumber
+#define SCHED_CORE_QUEUE                    ((SCHED_QUEUE == SCHED_QUEUE_HEAP) ? SCHED_CORE_QUEUE_HEAP : SCHED_CORE_QUEUE_SCAN)
+
+#define SCHED_CORE_ENTER_CRITICAL()         0
+#define SCHED_CORE_EXIT_CRITICAL(State)     ((void)(State))
+
+/*--------------------------------------------SCHED_KERNEL-------------------------------------------*/
+#define SCHED_KERNEL_TICK_US                SCHED_TICK_US
+#define SCHED_KERNEL_CYCLES_PER_US          16
+#define SCHED_KERNEL_MAX_SLEEP_MS           SCHED_MAX_SLEEP_MS
+
+#ifdef TICKLESS_MODE
+#define SCHED_KERNEL_MODE                   TICKLESS_MODE
+#else
+#define SCHED_KERNEL_MODE                   SCHED_KERNEL_MODE_PERIODIC
+#endif
+
+/*only the releases are compared, the options that time the calls are left out*/
+#define SCHED_KERNEL_STATS                  SCHED_KERNEL_DISABLED
+#define SCHED_KERNEL_LOAD                   SCHED_KERNEL_DISABLED
+#define SCHED_KERNEL_BUDGET                 SCHED_KERNEL_DISABLED
+#define SCHED_KERNEL_SLEEP                  SCHED_KERNEL_DISABLED
+#define SCHED_KERNEL_DEFER                  ((SCHED_DEFER == SCHED_DEFER_PREEMPTIVE) ? SCHED_KERNEL_DEFER_PREEMPTIVE : SCHED_KERNEL_DEFER_COOPERATIVE)
+#define SCHED_KERNEL_DEFER_QUEUE_SIZE       SCHED_DEFER_QUEUE_SIZE
+#define SCHED_KERNEL_SYNC                   SCHED_KERNEL_SYNC_DISABLED
+
+#ifdef TICKLESS_MODE
+/*the model of the board in sched_tickless_kernel.c*/
+static void TICKLESS_TimerInit (void (*CallBack) (void));
+static void TICKLESS_TimerSetUs (uint32_t Us);
+static void TICKLESS_TimerStart (void);
+static void TICKLESS_PendPreemptive (void);
+static void TICKLESS_WaitForInterrupt (void);
+static void TICKLESS_Started (uint32_t ID, uint32_t Timed);
+
+#define SCHED_KERNEL_TIMER_INIT(CallBack)   TICKLESS_TimerInit(CallBack)
+#define SCHED_KERNEL_TIMER_SET_US(Us)       TICKLESS_TimerSetUs(Us)
+#define SCHED_KERNEL_TIMER_START()          TICKLESS_TimerStart()
+#define SCHED_KERNEL_PREEMPTIVE_INIT()      ((void)0)
+#define SCHED_KERNEL_PEND_PREEMPTIVE()      TICKLESS_PendPreemptive()
+#define SCHED_KERNEL_CYCLES_INIT()          ((void)0)
+#define SCHED_KERNEL_CYCLES()               0
+#define SCHED_KERNEL_IDLE_LOCK()            ((void)0)
+#define SCHED_KERNEL_IDLE_WAIT()            TICKLESS_WaitForInterrupt()
+#define SCHED_KERNEL_IDLE_UNLOCK()          ((void)0)
+
+/*the start of every call is recorded with the scheduler time of its class*/
+#define SCHED_KERNEL_TRACE(Type, ID, Arg)   TICKLESS_TRACE_##Type(ID, Arg)
+#define SCHED_KERNEL_TRACE_PENDSV(Type)
+#define TICKLESS_TRACE_RUNNABLE_START(ID, Arg)  TICKLESS_Started((ID), (Arg))
+#define TICKLESS_TRACE_RUNNABLE_END(ID, Arg)
+#define TICKLESS_TRACE_DISPATCH_START(ID, Arg)
+#define TICKLESS_TRACE_DISPATCH_END(ID, Arg)
+#endif
+
+#endif
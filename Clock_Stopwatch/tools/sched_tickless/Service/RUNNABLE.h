@@ -0,0 +1,2 @@
+/*Runnables.c of MC1 includes Service/RUNNABLE.h, the name only works on a file system with no case*/
+#include "../../../MC1/include/SERVICE/RUNNABLE.h"
@@ -0,0 +1,309 @@
+/*check that the tickless mode of COMMON/SCHED_KERNEL releases the runnables of MC1 at the same scheduler times as the
+  periodic mode (the 1 ms super loop), the runnable table is MC1/src/SERVICE/Runnables.c as it is on the board.
+
+  Both kernels run the same scenario on the model of the board of sched_tickless_kernel.c, with the calls of the
+  runnables taking time so the releases pile up:
+  - Clock_RunnerTask takes 35 ms every 3rd call and Stopwatch_RunnerTask 250 ms every 5th call, so the cooperative
+    class runs its missed releases late (RUN_ALL) and sw_runner coalesces the ones it missed (COALESCE)
+  - RUNNABLE_LCD takes 3 ms every 50th call, so the preemptive class coalesces its own ticks as well
+  - the button event is posted from an interrupt every 777 ms
+  - RUNNABLE_LCD sets its own period to 2 s when it is 1 s into a cycle of 4 s and back to 1 ms at its next call (a new
+    period applies after the next release), so it pauses for 2 s and the tickless intervals grow to the 10 ms of sw_runner
+  - sw_runner suspends Clock_RunnerTask from 2 s to 2.6 s into the cycle, it is resumed in its phase
+  The scheduler time starts near its wrap (or at the time given on the command line) so it wraps in the middle.
+  A runnable is suspended and resumed by one of its class only: the resume starts its releases from the current time of
+  its class, the other class may be at another time in each mode (the tickless mode knows its time at the systick).
+
+  For each class the timed releases of both kernels must be the same runnables at the same scheduler times, the event
+  releases (their time is the one they come at) and the releases coalesced by the backlog policies must be as many, and
+  no release may be called before its time.
+
+  The worst release latency of each runnable (the ticks from its release time to the tick its call starts in) is
+  printed for both kernels. Built with -DTICKLESS_LCD_COOPERATIVE the LCD is in the cooperative class, so its latency
+  under the same load shows what the preemptive class (PendSV) saves it: the ticks of the cooperative calls it waits
+  for. The model counts whole ticks, the cycles from the systick to the call are SCHED_GetClassLatency on the board.
+
+  Build and run from Clock_Stopwatch:
+      gcc -c -O2 -Wall -Itools/sched_tickless -IMC1/include -ICOMMON/include tools/sched_tickless/sched_tickless_kernel.c -o periodic.o
+      gcc -c -O2 -Wall -DTICKLESS_BUILD_TICKLESS -Itools/sched_tickless -IMC1/include -ICOMMON/include tools/sched_tickless/sched_tickless_kernel.c -o tickless.o
+      gcc -O2 -Wall -Itools/sched_tickless -IMC1/include -ICOMMON/include tools/sched_tickless/sched_tickless.c periodic.o tickless.o -o sched_tickless
+      ./sched_tickless                # the scheduler time wraps
+      ./sched_tickless 0              # the scheduler time starts at 0
+  Add -DTICKLESS_LCD_COOPERATIVE to the three builds to run the LCD in the cooperative class.
+  It returns 1 and prints the first difference if the releases are not the same.*/
+
+/*---------------------------------------------------------------------------------------------------*/
+/*                                           Includes:                                               */
+/*---------------------------------------------------------------------------------------------------*/
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "sched_tickless.h"
+#include "../../MC1/src/SERVICE/Runnables.c"
+
+/*---------------------------------------------------------------------------------------------------*/
+/*                                           Defines:                                                */
+/*---------------------------------------------------------------------------------------------------*/
+/*ticks of the scenario, 15 cycles*/
+#define TICKLESS_TICKS              60000
+#define TICKLESS_START_TIME         (0xFFFFFFFFUL - 5000)
+#define TICKLESS_MAX_RELEASES       (2 * TICKLESS_TICKS)
+
+#define TICKLESS_EVENT_PERIOD       777
+#define TICKLESS_EVENT_PHASE        5
+#define TICKLESS_CYCLE              4000
+#define TICKLESS_LCD_SLOW           1000
+#define TICKLESS_LCD_SLOW_WINDOW    10
+#define TICKLESS_LCD_SLOW_PERIOD    2000
+#define TICKLESS_CLOCK_SUSPEND      2000
+#define TICKLESS_CLOCK_RESUME       2600
+
+/*---------------------------------------------------------------------------------------------------*/
+/*                                           Types:                                                  */
+/*---------------------------------------------------------------------------------------------------*/
+typedef struct
+{
+    uint32_t ID;
+    uint32_t Time;
+}TICKLESS_Release_t;
+
+typedef struct
+{
+    TICKLESS_Release_t Timed[_SCHED_ClassNumber][TICKLESS_MAX_RELEASES];
+    uint32_t TimedNumber[_SCHED_ClassNumber];
+    uint32_t EventsNumber[_SCHED_ClassNumber];
+    uint32_t Missed[_RunnableNumber];
+    uint32_t MaxLatency[_RunnableNumber];
+    uint32_t Early;
+    uint32_t Interrupts;
+}TICKLESS_Log_t;
+
+/*---------------------------------------------------------------------------------------------------*/
+/*                                           Variables:                                              */
+/*---------------------------------------------------------------------------------------------------*/
+static const TICKLESS_Kernel_t* TICKLESS_Kernel = NULL;
+static TICKLESS_Log_t* TICKLESS_Log = NULL;
+static uint32_t TICKLESS_StartTime = 0;
+
+/*scheduler time of the last call of each class, the time of the running runnable*/
+static uint32_t TICKLESS_Now[_SCHED_ClassNumber];
+/*class of each runnable in the run, the one of Runnables_Arr except the LCD with TICKLESS_LCD_COOPERATIVE*/
+static uint32_t TICKLESS_Class[_RunnableNumber];
+static uint32_t TICKLESS_Calls[_RunnableNumber];
+static uint32_t TICKLESS_LcdPeriod = 1;
+
+static TICKLESS_Log_t TICKLESS_Logs[2];
+
+/*---------------------------------------------------------------------------------------------------*/
+/*                                           Runnables of MC1:                                       */
+/*---------------------------------------------------------------------------------------------------*/
+/*time of the running call of the runnable in the cycle of the scenario*/
+static uint32_t TICKLESS_Phase (uint32_t ID)
+{
+    return (TICKLESS_Now[TICKLESS_Class[ID]] - TICKLESS_StartTime) % TICKLESS_CYCLE;
+}
+
+void RUNNABLE_LCD (void)
+{
+    /*the window is wider than the coalesced releases of the LCD so it never misses it*/
+    uint32_t Period = ((TICKLESS_LcdPeriod == 1) && (TICKLESS_Phase(LCD_RUNNABLE) >= TICKLESS_LCD_SLOW) &&
+                       (TICKLESS_Phase(LCD_RUNNABLE) < (TICKLESS_LCD_SLOW + TICKLESS_LCD_SLOW_WINDOW))) ? TICKLESS_LCD_SLOW_PERIOD : 1;
+    TICKLESS_Calls[LCD_RUNNABLE]++;
+    if((TICKLESS_Calls[LCD_RUNNABLE] % 50) == 0)
+    {
+        TICKLESS_Kernel->Elapse(3);
+    }
+    if(Period != TICKLESS_LcdPeriod)
+    {
+        TICKLESS_LcdPeriod = Period;
+        (void)TICKLESS_Kernel->SetPeriod(LCD_RUNNABLE, Period);
+    }
+}
+
+void Clock_RunnerTask (void)
+{
+    TICKLESS_Calls[Clock_Runner]++;
+    if((TICKLESS_Calls[Clock_Runner] % 3) == 0)
+    {
+        TICKLESS_Kernel->Elapse(35);
+    }
+}
+
+void Stopwatch_RunnerTask (void)
+{
+    TICKLESS_Calls[Stopwatch_Runner]++;
+    if((TICKLESS_Calls[Stopwatch_Runner] % 5) == 0)
+    {
+        TICKLESS_Kernel->Elapse(250);
+    }
+}
+
+void Switch_runnable (void)
+{
+    TICKLESS_Calls[Switch_Runner]++;
+}
+
+void SW_Runnable (void)
+{
+    TICKLESS_Calls[sw_runner]++;
+    if((TICKLESS_Phase(sw_runner) >= TICKLESS_CLOCK_SUSPEND) && (TICKLESS_Phase(sw_runner) < TICKLESS_CLOCK_RESUME))
+    {
+        (void)TICKLESS_Kernel->Suspend(Clock_Runner);
+    }
+    else
+    {
+        (void)TICKLESS_Kernel->Resume(Clock_Runner);
+    }
+}
+
+/*---------------------------------------------------------------------------------------------------*/
+/*                                           Model of the board:                                     */
+/*---------------------------------------------------------------------------------------------------*/
+void TICKLESS_Interrupt (uint32_t Wall)
+{
+    if((Wall % TICKLESS_EVENT_PERIOD) == TICKLESS_EVENT_PHASE)
+    {
+        TICKLESS_Kernel->PostEvent(SCHED_EVENT_MASK(Button_Received_Event));
+    }
+}
+
+void TICKLESS_Record (uint32_t ID, uint32_t Timed, uint32_t Time, uint32_t Wall)
+{
+    uint32_t Class = TICKLESS_Class[ID];
+    uint32_t Latency = Wall - (Time - TICKLESS_StartTime);
+    TICKLESS_Now[Class] = Time;
+    if(Timed)
+    {
+        if(TICKLESS_Log->TimedNumber[Class] < TICKLESS_MAX_RELEASES)
+        {
+            TICKLESS_Log->Timed[Class][TICKLESS_Log->TimedNumber[Class]].ID = ID;
+            TICKLESS_Log->Timed[Class][TICKLESS_Log->TimedNumber[Class]].Time = Time;
+        }
+        TICKLESS_Log->TimedNumber[Class]++;
+        /*the call of the time T may come in the tick T+1 at the soonest, the one that starts at the systick of T*/
+        if((uint32_t)(Time - TICKLESS_StartTime) > Wall)
+        {
+            TICKLESS_Log->Early++;
+        }
+        else if(Latency > TICKLESS_Log->MaxLatency[ID])
+        {
+            TICKLESS_Log->MaxLatency[ID] = Latency;
+        }
+    }
+    else
+    {
+        TICKLESS_Log->EventsNumber[Class]++;
+    }
+}
+
+/*---------------------------------------------------------------------------------------------------*/
+/*                                           Static Function:                                        */
+/*---------------------------------------------------------------------------------------------------*/
+static void TICKLESS_RunKernel (const TICKLESS_Kernel_t* Kernel, TICKLESS_Log_t* Log)
+{
+    SCHED_KernelRunnable_t Runnables[_RunnableNumber];
+    for(uint32_t itr = 0 ; itr < _RunnableNumber ; itr++)
+    {
+        Runnables[itr].Name = Runnables_Arr[itr].Name;
+        Runnables[itr].CB = Runnables_Arr[itr].CB;
+        Runnables[itr].Class = Runnables_Arr[itr].Class;
+#ifdef TICKLESS_LCD_COOPERATIVE
+        if(itr == LCD_RUNNABLE)
+        {
+            Runnables[itr].Class = SCHED_CLASS_COOPERATIVE;
+        }
+#endif
+        TICKLESS_Class[itr] = Runnables[itr].Class;
+        Runnables[itr].DelayMs = Runnables_Arr[itr].DelayMs;
+        Runnables[itr].PeriodicityMs = Runnables_Arr[itr].Periodicity;
+        Runnables[itr].PeriodicityUs = Runnables_Arr[itr].PeriodicityUs;
+        Runnables[itr].BacklogPolicy = Runnables_Arr[itr].BacklogPolicy;
+        Runnables[itr].Events = Runnables_Arr[itr].Events;
+        Runnables[itr].BudgetUs = Runnables_Arr[itr].BudgetUs;
+        TICKLESS_Calls[itr] = 0;
+    }
+    TICKLESS_Kernel = Kernel;
+    TICKLESS_Log = Log;
+    TICKLESS_LcdPeriod = 1;
+    Kernel->Start(Runnables, _RunnableNumber, TICKLESS_StartTime);
+    Kernel->Run(TICKLESS_TICKS);
+    Log->Interrupts = Kernel->Interrupts();
+    for(uint32_t itr = 0 ; itr < _RunnableNumber ; itr++)
+    {
+        (void)Kernel->GetMissedReleases(Runnables_Arr[itr].Name, &Log->Missed[itr]);
+    }
+}
+
+/*the releases of the periodic kernel up to the last time both kernels reached*/
+static uint32_t TICKLESS_Compare (uint32_t Class)
+{
+    const TICKLESS_Log_t* Periodic = &TICKLESS_Logs[0];
+    const TICKLESS_Log_t* Tickless = &TICKLESS_Logs[1];
+    uint32_t Number = Periodic->TimedNumber[Class];
+    uint32_t Errors = 0;
+    if(Tickless->TimedNumber[Class] < Number)
+    {
+        Number = Tickless->TimedNumber[Class];
+    }
+    if(Number > TICKLESS_MAX_RELEASES)
+    {
+        Number = TICKLESS_MAX_RELEASES;
+    }
+    for(uint32_t itr = 0 ; (itr < Number) && (Errors == 0) ; itr++)
+    {
+        if((Periodic->Timed[Class][itr].ID != Tickless->Timed[Class][itr].ID) ||
+           (Periodic->Timed[Class][itr].Time != Tickless->Timed[Class][itr].Time))
+        {
+            printf("class %u release %u: periodic %s at %u, tickless %s at %u\n", Class, itr,
+                   Runnables_Arr[Periodic->Timed[Class][itr].ID].Name, Periodic->Timed[Class][itr].Time - TICKLESS_StartTime,
+                   Runnables_Arr[Tickless->Timed[Class][itr].ID].Name, Tickless->Timed[Class][itr].Time - TICKLESS_StartTime);
+            Errors++;
+        }
+    }
+    printf("class %u: %u timed releases compared (periodic %u, tickless %u), event releases periodic %u, tickless %u\n",
+           Class, Number, Periodic->TimedNumber[Class], Tickless->TimedNumber[Class],
+           Periodic->EventsNumber[Class], Tickless->EventsNumber[Class]);
+    if(Periodic->EventsNumber[Class] != Tickless->EventsNumber[Class])
+    {
+        Errors++;
+    }
+    return Errors;
+}
+
+/*---------------------------------------------------------------------------------------------------*/
+/*                                           Main:                                                   */
+/*---------------------------------------------------------------------------------------------------*/
+int main (int argc, char* argv[])
+{
+    uint32_t Errors = 0;
+    TICKLESS_StartTime = (argc > 1) ? (uint32_t)strtoul(argv[1], NULL, 0) : (uint32_t)TICKLESS_START_TIME;
+
+    TICKLESS_RunKernel(&TICKLESS_Periodic, &TICKLESS_Logs[0]);
+    TICKLESS_RunKernel(&TICKLESS_Tickless, &TICKLESS_Logs[1]);
+
+    printf("start time %u, %u ticks\n", TICKLESS_StartTime, TICKLESS_TICKS);
+    for(uint32_t Class = 0 ; Class < _SCHED_ClassNumber ; Class++)
+    {
+        Errors += TICKLESS_Compare(Class);
+    }
+    /*the releases coalesced by the backlog policy*/
+    for(uint32_t itr = 0 ; itr < _RunnableNumber ; itr++)
+    {
+        printf("%-18s %s: missed releases periodic %u, tickless %u, worst release latency periodic %u ms, tickless %u ms\n",
+               Runnables_Arr[itr].Name, (TICKLESS_Class[itr] == SCHED_CLASS_PREEMPTIVE) ? "preemptive " : "cooperative",
+               TICKLESS_Logs[0].Missed[itr], TICKLESS_Logs[1].Missed[itr],
+               (TICKLESS_Logs[0].MaxLatency[itr] * SCHED_TICK_US) / 1000, (TICKLESS_Logs[1].MaxLatency[itr] * SCHED_TICK_US) / 1000);
+        if(TICKLESS_Logs[0].Missed[itr] != TICKLESS_Logs[1].Missed[itr])
+        {
+            Errors++;
+        }
+    }
+    for(uint32_t itr = 0 ; itr < 2 ; itr++)
+    {
+        printf("%s: %u systick interrupts, %u early releases\n", (itr == 0) ? TICKLESS_Periodic.Name : TICKLESS_Tickless.Name,
+               TICKLESS_Logs[itr].Interrupts, TICKLESS_Logs[itr].Early);
+        Errors += TICKLESS_Logs[itr].Early;
+    }
+    printf("%s\n", (Errors == 0) ? "same releases" : "releases differ");
+    return (Errors == 0) ? 0 : 1;
+}
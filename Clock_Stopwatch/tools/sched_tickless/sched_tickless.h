@@ -0,0 +1,35 @@
+#ifndef _SCHED_TICKLESS_H
+#define _SCHED_TICKLESS_H
+
+/*the two builds of COMMON/SCHED_KERNEL of tools/sched_tickless (sched_tickless_kernel.c), the periodic one and the
+  tickless one, each runs on its own model of the board*/
+#include <stdint.h>
+#include "SCHED_KERNEL.h"
+
+typedef struct
+{
+    const char* Name;
+    /*init the kernel, give the runnables their IDs in their order and start the scheduler time at StartTime*/
+    void (*Start) (const SCHED_KernelRunnable_t* Runnables, uint32_t Number, uint32_t StartTime);
+    /*run the super loop for the given ticks of the board*/
+    void (*Run) (uint32_t Ticks);
+    /*the time a runnable takes, the interrupts come in the middle*/
+    void (*Elapse) (uint32_t Ticks);
+    void (*PostEvent) (uint32_t Events);
+    SCHED_KernelStatus_t (*Suspend) (uint32_t ID);
+    SCHED_KernelStatus_t (*Resume) (uint32_t ID);
+    SCHED_KernelStatus_t (*SetPeriod) (uint32_t ID, uint32_t PeriodicityMs);
+    SCHED_KernelStatus_t (*GetMissedReleases) (const char* Name, uint32_t* MissedReleases);
+    /*systick interrupts since the start*/
+    uint32_t (*Interrupts) (void);
+}TICKLESS_Kernel_t;
+
+extern const TICKLESS_Kernel_t TICKLESS_Periodic;
+extern const TICKLESS_Kernel_t TICKLESS_Tickless;
+
+/*given by sched_tickless.c: the other interrupts of the board, called at every tick of the board before the systick,
+  and the record of the start of a call with the scheduler time of its class*/
+void TICKLESS_Interrupt (uint32_t Wall);
+void TICKLESS_Record (uint32_t ID, uint32_t Timed, uint32_t Time, uint32_t Wall);
+
+#endif
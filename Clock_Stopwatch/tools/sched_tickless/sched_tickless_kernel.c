@@ -0,0 +1,209 @@
+/*COMMON/SCHED_CORE and COMMON/SCHED_KERNEL built for tools/sched_tickless with the model of the board they run on,
+  this file is built twice: in the periodic mode (TICKLESS_Periodic) and with -DTICKLESS_BUILD_TICKLESS in the
+  tickless mode (TICKLESS_Tickless), the names of the kernel get the prefix of the mode so both builds link together.
+
+  The board counts in ticks of SCHED_TICK_US: the systick fires when its count reaches 0 and reloads the LOAD
+  written last (so a LOAD takes effect at the next reload as on the Cortex-M4), PendSV runs after the interrupt that
+  pended it or at once from the super loop, and the super loop sleeps till the next systick when it has nothing to
+  do (the WFI of the tickless mode, the spin of the periodic one).*/
+
+/*---------------------------------------------------------------------------------------------------*/
+/*                                           Defines:                                                */
+/*---------------------------------------------------------------------------------------------------*/
+#ifdef TICKLESS_BUILD_TICKLESS
+#define TICKLESS_MODE                       SCHED_KERNEL_MODE_TICKLESS
+#define TICKLESS_NAME(Name)                 Tickless_##Name
+#define TICKLESS_KERNEL                     TICKLESS_Tickless
+#define TICKLESS_KERNEL_NAME                "tickless"
+#else
+#define TICKLESS_MODE                       SCHED_KERNEL_MODE_PERIODIC
+#define TICKLESS_NAME(Name)                 Periodic_##Name
+#define TICKLESS_KERNEL                     TICKLESS_Periodic
+#define TICKLESS_KERNEL_NAME                "periodic"
+#endif
+
+#define SCHED_CoreInit                      TICKLESS_NAME(SCHED_CoreInit)
+#define SCHED_CoreAdd                       TICKLESS_NAME(SCHED_CoreAdd)
+#define SCHED_CoreTakeDue                   TICKLESS_NAME(SCHED_CoreTakeDue)
+#define SCHED_CoreIsIdle                    TICKLESS_NAME(SCHED_CoreIsIdle)
+#define SCHED_CoreSuspend                   TICKLESS_NAME(SCHED_CoreSuspend)
+#define SCHED_CoreResume                    TICKLESS_NAME(SCHED_CoreResume)
+#define SCHED_CoreSetRelease                TICKLESS_NAME(SCHED_CoreSetRelease)
+#define SCHED_CoreSetPeriod                 TICKLESS_NAME(SCHED_CoreSetPeriod)
+#define SCHED_CoreNextDeadline              TICKLESS_NAME(SCHED_CoreNextDeadline)
+#define SCHED_CoreIsActive                  TICKLESS_NAME(SCHED_CoreIsActive)
+#define SCHED_CoreGetPeriod                 TICKLESS_NAME(SCHED_CoreGetPeriod)
+#define SCHED_CoreGetMissedReleases         TICKLESS_NAME(SCHED_CoreGetMissedReleases)
+#define PendSV_Handler                      TICKLESS_NAME(PendSV_Handler)
+#define SCHED_KernelInit                    TICKLESS_NAME(SCHED_KernelInit)
+#define SCHED_KernelStart                   TICKLESS_NAME(SCHED_KernelStart)
+#define SCHED_KernelRegister                TICKLESS_NAME(SCHED_KernelRegister)
+#define SCHED_KernelEnterIsr                TICKLESS_NAME(SCHED_KernelEnterIsr)
+#define SCHED_KernelExitIsr                 TICKLESS_NAME(SCHED_KernelExitIsr)
+#define SCHED_KernelPostEvent               TICKLESS_NAME(SCHED_KernelPostEvent)
+#define SCHED_KernelDefer                   TICKLESS_NAME(SCHED_KernelDefer)
+#define SCHED_KernelGetDeferDrops           TICKLESS_NAME(SCHED_KernelGetDeferDrops)
+#define SCHED_KernelSuspend                 TICKLESS_NAME(SCHED_KernelSuspend)
+#define SCHED_KernelResume                  TICKLESS_NAME(SCHED_KernelResume)
+#define SCHED_KernelSetPeriod               TICKLESS_NAME(SCHED_KernelSetPeriod)
+#define SCHED_KernelGetMissedReleases       TICKLESS_NAME(SCHED_KernelGetMissedReleases)
+#define SCHED_KernelSleep                   TICKLESS_NAME(SCHED_KernelSleep)
+#define SCHED_KernelSetBudgetHook           TICKLESS_NAME(SCHED_KernelSetBudgetHook)
+#define SCHED_KernelGetBudgetOverruns       TICKLESS_NAME(SCHED_KernelGetBudgetOverruns)
+#define SCHED_KernelSetSyncHook             TICKLESS_NAME(SCHED_KernelSetSyncHook)
+#define SCHED_KernelSync                    TICKLESS_NAME(SCHED_KernelSync)
+#define SCHED_KernelGetRunnableStats        TICKLESS_NAME(SCHED_KernelGetRunnableStats)
+#define SCHED_KernelGetClassLatency         TICKLESS_NAME(SCHED_KernelGetClassLatency)
+#define SCHED_KernelGetLoad                 TICKLESS_NAME(SCHED_KernelGetLoad)
+
+/*---------------------------------------------------------------------------------------------------*/
+/*                                           Includes:                                               */
+/*---------------------------------------------------------------------------------------------------*/
+#include "sched_tickless.h"
+#include "../../COMMON/src/SCHED_CORE.c"
+#include "../../COMMON/src/SCHED_KERNEL.c"
+
+/*---------------------------------------------------------------------------------------------------*/
+/*                                           Variables:                                              */
+/*---------------------------------------------------------------------------------------------------*/
+static void (*TICKLESS_TickCallBack) (void) = NULL;
+static uint32_t TICKLESS_Load = 0;
+static uint32_t TICKLESS_Count = 0;
+static uint32_t TICKLESS_Running = 0;
+static uint32_t TICKLESS_Interrupts = 0;
+
+static uint32_t TICKLESS_PendSVPending = 0;
+static uint32_t TICKLESS_InInterrupt = 0;
+static uint32_t TICKLESS_InPendSV = 0;
+
+/*ticks of the board since the start*/
+static uint32_t TICKLESS_Wall = 0;
+
+/*---------------------------------------------------------------------------------------------------*/
+/*                                           Static Function:                                        */
+/*---------------------------------------------------------------------------------------------------*/
+static void TICKLESS_TimerInit (void (*CallBack) (void))
+{
+    TICKLESS_TickCallBack = CallBack;
+}
+
+static void TICKLESS_TimerSetUs (uint32_t Us)
+{
+    TICKLESS_Load = Us / SCHED_KERNEL_TICK_US;
+}
+
+static void TICKLESS_TimerStart (void)
+{
+    TICKLESS_Count = TICKLESS_Load;
+    TICKLESS_Running = 1;
+}
+
+/*PendSV has the lowest priority, it waits for the interrupts and never preempts itself*/
+static void TICKLESS_RunPendSV (void)
+{
+    if((TICKLESS_InInterrupt == 0) && (TICKLESS_InPendSV == 0))
+    {
+        TICKLESS_InPendSV = 1;
+        while(TICKLESS_PendSVPending)
+        {
+            TICKLESS_PendSVPending = 0;
+            PendSV_Handler();
+        }
+        TICKLESS_InPendSV = 0;
+    }
+}
+
+static void TICKLESS_PendPreemptive (void)
+{
+    TICKLESS_PendSVPending = 1;
+    TICKLESS_RunPendSV();
+}
+
+/*time passes tick by tick with the interrupts of each tick*/
+static void TICKLESS_Elapse (uint32_t Ticks)
+{
+    while(Ticks--)
+    {
+        TICKLESS_Wall++;
+        TICKLESS_InInterrupt = 1;
+        TICKLESS_Interrupt(TICKLESS_Wall);
+        if(TICKLESS_Running)
+        {
+            TICKLESS_Count--;
+            if(TICKLESS_Count == 0)
+            {
+                TICKLESS_Count = TICKLESS_Load;
+                TICKLESS_Interrupts++;
+                TICKLESS_TickCallBack();
+            }
+        }
+        TICKLESS_InInterrupt = 0;
+        TICKLESS_RunPendSV();
+    }
+}
+
+static void TICKLESS_WaitForInterrupt (void)
+{
+    uint32_t Interrupts = TICKLESS_Interrupts;
+    while(TICKLESS_Interrupts == Interrupts)
+    {
+        TICKLESS_Elapse(1);
+    }
+}
+
+static void TICKLESS_Started (uint32_t ID, uint32_t Timed)
+{
+    TICKLESS_Record(ID, Timed, SCHED_KernelTime[SCHED_KernelRunnables[ID].Class], TICKLESS_Wall);
+}
+
+static void TICKLESS_Start (const SCHED_KernelRunnable_t* Runnables, uint32_t Number, uint32_t StartTime)
+{
+    uint32_t ID = 0;
+    SCHED_KernelInit();
+    SCHED_KernelTime[SCHED_KERNEL_CLASS_COOPERATIVE] = StartTime;
+    SCHED_KernelTime[SCHED_KERNEL_CLASS_PREEMPTIVE] = StartTime;
+    for(uint32_t itr = 0 ; itr < Number ; itr++)
+    {
+        (void)SCHED_KernelRegister(&Runnables[itr], &ID);
+    }
+    SCHED_KernelStartTime();
+}
+
+static void TICKLESS_Run (uint32_t Ticks)
+{
+    uint32_t End = TICKLESS_Wall + Ticks;
+    while(TICKLESS_Wall < End)
+    {
+        SCHED_KernelCooperative();
+#if (SCHED_KERNEL_MODE != SCHED_KERNEL_MODE_TICKLESS)
+        /*the super loop spins till the systick gives it a tick*/
+        if((SCHED_KernelPendingTicks[SCHED_KERNEL_CLASS_COOPERATIVE] == 0) &&
+           (SCHED_KernelPendingEvents[SCHED_KERNEL_CLASS_COOPERATIVE] == 0))
+        {
+            TICKLESS_WaitForInterrupt();
+        }
+#endif
+    }
+}
+
+static uint32_t TICKLESS_GetInterrupts (void)
+{
+    return TICKLESS_Interrupts;
+}
+
+/*---------------------------------------------------------------------------------------------------*/
+/*                                           Variables:                                              */
+/*---------------------------------------------------------------------------------------------------*/
+const TICKLESS_Kernel_t TICKLESS_KERNEL =
+{
+    .Name = TICKLESS_KERNEL_NAME,
+    .Start = TICKLESS_Start,
+    .Run = TICKLESS_Run,
+    .Elapse = TICKLESS_Elapse,
+    .PostEvent = SCHED_KernelPostEvent,
+    .Suspend = SCHED_KernelSuspend,
+    .Resume = SCHED_KernelResume,
+    .SetPeriod = SCHED_KernelSetPeriod,
+    .GetMissedReleases = SCHED_KernelGetMissedReleases,
+    .Interrupts = TICKLESS_GetInterrupts
+};
@@ -0,0 +1,194 @@
+#!/usr/bin/env python3
+"""Simulate the button link of the two boards with and without the scheduler sync.
+
+Both boards poll their buttons in a 200 ms runnable that sends the button
+frame, and handle the frames of the other board in a 200 ms runnable.  With
+SCHED_SYNC (MC1 the master, MC2 the slave) the slots of these runnables are
+fixed by their first delays, MC2 aligns its scheduler time on the sync frame
+MC1 sends every SCHED_SYNC_PERIOD_MS, so a frame arrives right before the slot
+of the runnable that handles it:
+
+    MC2 Switch_check (TX) -> MC1 Switch_Runner -> MC2 Recieve_Runnable
+                                 (handles, TX)        (handles)
+
+Without the sync the schedulers keep the phase they had at power up and the
+HSI of each board drifts, so a frame waits from 0 to a whole period for the
+next slot of the receiver.  The tool reads the slots, the sync period, the
+latency and the deadband from the configuration of both boards, runs the
+slave with the same correction as SCHED_enuSync and prints the latency from
+the TX slot to the handling slot (link) and from the press of the button to
+the handling slot (end to end), over many runs with a random power up phase
+and random clock errors.  The event-triggered handling of the tree without
+the sync (the receive callback posts an event) is printed for reference, it
+handles a frame as soon as it arrives but releases the runnables out of
+their slots.
+
+Usage:
+    tools/sync_sim.py                       # 50 runs of 60 s, clocks within +/-0.5 %
+    tools/sync_sim.py --drift 1 --runs 200  # clocks within +/-1 % (the HSI over temperature)
+
+It exits with 1 if a frame misses the slot right after it with the sync (it waits
+over half a period).
+"""
+
+import argparse
+import bisect
+import random
+import sys
+
+from sched_table import BOARDS, ConfigError, parse_defines, parse_runnables, tick_us
+
+# (board, runnable) that sends and that handles each direction
+LINKS = [("MC2 -> MC1", ("mc2", "Switch_check"), ("mc1", "Switch_Runner")),
+         ("MC1 -> MC2", ("mc1", "Switch_Runner"), ("mc2", "Recieve_Runnable"))]
+
+
+class Node(object):
+    """A board whose systick fires every tick of its own clock, `rate` is the clock speed over the nominal one."""
+
+    def __init__(self, board, rate, start):
+        self.tick = tick_us(BOARDS[board]) / 1000.0
+        self.rate = rate
+        self.start = start
+        self.runnables = dict((name, (delay, period)) for name, delay, period, cb in parse_runnables(BOARDS[board]) if cb)
+
+    def systick(self, index):
+        """Time in ms of the systick of the given index."""
+        return self.start + index * self.tick / self.rate
+
+
+def releases(runnable, times):
+    """Times in ms of the releases of a runnable, `times` holds (time in ms, [scheduler times released then])."""
+    delay, period = runnable
+    return [wall for wall, ticks in times for t in ticks if t >= delay and (t - delay) % period == 0]
+
+
+def master_times(node, duration):
+    """MC1: the tick of the scheduler time 0 is given at the start, the systick n gives the time n."""
+    times = [(node.start, [0])]
+    index = 1
+    while node.systick(index) < duration:
+        times.append((node.systick(index), [index]))
+        index += 1
+    return times
+
+
+def slave_times(node, duration, syncs, period, arrival, deadband):
+    """MC2: the same scheduler as MC1, so the time 0 is given at the start too, plus the corrections of
+    SCHED_enuSync for the sync frames."""
+    times = [(node.start, [0])]
+    now = 0
+    sync_time = 0
+    correction = 0
+    pending = list(syncs)
+    index = 1
+    while node.systick(index) < duration:
+        wall = node.systick(index)
+        while pending and pending[0] < wall:
+            pending.pop(0)
+            error = (arrival + period - sync_time) % period
+            if error > period // 2:
+                error -= period
+            correction = error if abs(error) > deadband else 0
+        ticks = 1
+        if correction > 0:
+            ticks, correction = 2, correction - 1
+        elif correction < 0:
+            ticks, correction = 0, correction + 1
+        sync_time = (sync_time + ticks) % period
+        times.append((wall, list(range(now + 1, now + 1 + ticks))))
+        now += ticks
+        index += 1
+    return times
+
+
+def run(args, rng, synced):
+    """Return {link: ([link latencies], [end to end latencies], misses)} of one run, in ms."""
+    mc1 = Node("mc1", 1 + rng.uniform(-args.drift, args.drift) / 100, 0.0)
+    mc2 = Node("mc2", 1 + rng.uniform(-args.drift, args.drift) / 100, rng.uniform(0, args.period))
+    ticks = int(round(args.period / mc1.tick))
+    frame = args.latency / 1000.0
+
+    times = {"mc1": master_times(mc1, args.duration)}
+    syncs = [wall + frame for wall, t in times["mc1"] if synced and t[0] and t[0] % ticks == 0]
+    times["mc2"] = slave_times(mc2, args.duration, syncs, ticks, int(args.latency // (1000 * mc2.tick)),
+                               args.deadband)
+    nodes = {"mc1": mc1, "mc2": mc2}
+
+    result = {}
+    for name, (tx_board, tx_name), (rx_board, rx_name) in LINKS:
+        tx = releases(nodes[tx_board].runnables[tx_name], times[tx_board])
+        rx = releases(nodes[rx_board].runnables[rx_name], times[rx_board])
+        link, total, misses = [], [], 0
+        # the presses of the settling time are left out, the slave has not caught the master yet
+        for press in sorted(rng.uniform(args.settle, args.duration - 3 * args.period) for _ in range(args.presses)):
+            sent = tx[bisect.bisect_left(tx, press)]
+            handled = rx[bisect.bisect_left(rx, sent + frame)]
+            link.append(handled - sent)
+            total.append(handled - press)
+            if handled - sent > args.period / 2:
+                misses += 1
+        result[name] = (link, total, misses)
+    return result
+
+
+def percentile(values, share):
+    values = sorted(values)
+    return values[min(len(values) - 1, int(share * len(values)))]
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n\n")[0])
+    parser.add_argument("--runs", type=int, default=50, help="runs with a random phase and clock errors (default 50)")
+    parser.add_argument("--duration", type=float, default=60000, help="length of a run in ms (default 60000)")
+    parser.add_argument("--presses", type=int, default=200, help="presses of each board in a run (default 200)")
+    parser.add_argument("--drift", type=float, default=0.5, help="largest clock error of a board in %% (default 0.5)")
+    parser.add_argument("--settle", type=float, default=1000, help="ms after the start without presses (default 1000)")
+    parser.add_argument("--seed", type=int, default=1, help="seed of the random numbers (default 1)")
+    args = parser.parse_args()
+
+    try:
+        master = parse_defines(BOARDS["mc1"]["tick_header"])
+        slave = parse_defines(BOARDS["mc2"]["tick_header"])
+        if master.get("SCHED_SYNC_PERIOD_MS") != slave.get("SCHED_SYNC_PERIOD_MS"):
+            raise ConfigError("SCHED_SYNC_PERIOD_MS differs between %s and %s" % (BOARDS["mc1"]["tick_header"],
+                                                                                 BOARDS["mc2"]["tick_header"]))
+        args.period = master["SCHED_SYNC_PERIOD_MS"]
+        args.latency = slave["SCHED_SYNC_LATENCY_US"]
+        args.deadband = slave["SCHED_SYNC_DEADBAND_TICKS"]
+    except (ConfigError, KeyError, OSError) as error:
+        sys.exit("sync_sim: %s" % error)
+
+    print("sync period %d ms, frame %d us, deadband %d tick(s), clocks within +/-%g %%, %d runs of %g s"
+          % (args.period, args.latency, args.deadband, args.drift, args.runs, args.duration / 1000))
+    print("  %-11s %-9s %26s   %26s   %s" % ("link", "schedule", "TX slot -> handled ms", "press -> handled ms",
+                                             "over half a period"))
+    print("  %-11s %-9s %8s %8s %8s   %8s %8s %8s" % ("", "", "mean", "p99", "max", "mean", "p99", "max"))
+
+    missed = False
+    for synced in (False, True):
+        rng = random.Random(args.seed)
+        merged = {}
+        for _ in range(args.runs):
+            for name, (link, total, misses) in run(args, rng, synced).items():
+                values = merged.setdefault(name, ([], [], [0]))
+                values[0].extend(link)
+                values[1].extend(total)
+                values[2][0] += misses
+        for name, _, _ in LINKS:
+            link, total, misses = merged[name]
+            missed = missed or (synced and misses[0] > 0)
+            print("  %-11s %-9s %8.1f %8.1f %8.1f   %8.1f %8.1f %8.1f   %d of %d" % (
+                name, "sync" if synced else "no sync", sum(link) / len(link), percentile(link, 0.99), max(link),
+                sum(total) / len(total), percentile(total, 0.99), max(total), misses[0], len(link)))
+    # with the events the handling waits for the frame and the dispatch only
+    print("  %-11s %-9s %8.1f %8s %8s   %26s" % ("both", "events", args.latency / 1000.0, "", "",
+                                                 "TX slot wait + %.1f" % (args.latency / 1000.0)))
+
+    if missed:
+        print("a frame missed its slot with the sync, widen the gap between the slots or shorten SCHED_SYNC_PERIOD_MS")
+        sys.exit(1)
+
+
+if __name__ == "__main__":
+    main()
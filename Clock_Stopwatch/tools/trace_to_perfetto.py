@@ -0,0 +1,146 @@
+#!/usr/bin/env python3
+"""Convert a trace dump of MC1 to a Chrome trace JSON file for Perfetto.
+
+With TRACE set to TRACE_ENABLED in MC1/include/SERVICE/TRACE.h, MC1 keeps the
+last TRACE_BUFFER_EVENTS events (runnable start/end, scheduler dispatches,
+SysTick/PendSV/USART1/TIM2 interrupts, LCD and USART requests) in a RAM ring
+stamped with the DWT cycle counter.  TRACE_Dump sends the ring on USART2 (PA2),
+capture it raw and convert it:
+
+    stty -F /dev/ttyUSB0 115200 raw -echo && cat /dev/ttyUSB0 > trace.bin
+    tools/trace_to_perfetto.py trace.bin -o trace.json
+
+then open trace.json in https://ui.perfetto.dev or chrome://tracing.  The
+interrupts, dispatches and runnables nest on one CPU track, the driver requests
+have a track each.  A summary of the time spent in every runnable and
+interrupt is printed as well.
+
+Bytes before the "TRC1" header (a dump caught half way) are skipped.
+"""
+
+import argparse
+import json
+import struct
+import sys
+
+from sched_table import BOARDS, ConfigError, parse_fields
+
+MAGIC = b"TRC1"
+HEADER = struct.Struct("<4sIII")
+EVENT = struct.Struct("<IBBH")
+
+# TRACE_EventType_t, TRACE_ISR_t and TRACE_Driver_t of TRACE.h, in their order
+EVENT_TYPES = ["RUNNABLE_START", "RUNNABLE_END", "DISPATCH_START", "DISPATCH_END",
+               "ISR_ENTRY", "ISR_EXIT", "REQUEST_START", "REQUEST_END"]
+ISRS = ["SysTick", "PendSV", "USART1", "TIM2"]
+DRIVERS = ["LCD", "USART TX", "USART RX"]
+CLASSES = ["cooperative", "preemptive"]
+# request types of MC1/src/HAL/LCD.c, LCD_TRACE_INIT_REQUEST is 0xFF
+LCD_REQUESTS = {0: "clear screen", 1: "set cursor", 2: "write string", 3: "write number", 4: "write command",
+                0xFF: "init"}
+USART_CHANNELS = ["USART1", "USART2", "USART6"]
+
+CPU_TID = 1
+DRIVER_TID = 10
+
+
+class DumpError(Exception):
+    pass
+
+
+def read_dump(data):
+    """Return (cycles per second, lost events, [(cycles, type, id, arg)]) with the counter unwrapped."""
+    start = data.find(MAGIC)
+    if start < 0:
+        raise DumpError("no %s header in the dump" % MAGIC.decode())
+    if len(data) - start < HEADER.size:
+        raise DumpError("the dump ends in its header")
+    _, clock, count, lost = HEADER.unpack_from(data, start)
+    body = data[start + HEADER.size:]
+    if len(body) < count * EVENT.size:
+        print("warning: %d of %d events in the dump" % (len(body) // EVENT.size, count), file=sys.stderr)
+        count = len(body) // EVENT.size
+
+    events = []
+    wraps = 0
+    previous = None
+    for index in range(count):
+        stamp, kind, ident, arg = EVENT.unpack_from(body, index * EVENT.size)
+        # the 32-bit cycle counter wraps every 2^32 / clock seconds (268 s at 16 MHz)
+        if previous is not None and stamp < previous:
+            wraps += 1
+        previous = stamp
+        events.append((stamp + (wraps << 32), kind, ident, arg))
+    return clock, lost, events
+
+
+def name_of(kind, ident, arg, runnables):
+    if kind in (0, 1):
+        return runnables[ident] if ident < len(runnables) else "runnable %d" % ident
+    if kind in (2, 3):
+        return "dispatch %s" % (CLASSES[ident] if ident < len(CLASSES) else ident)
+    if kind in (4, 5):
+        return ISRS[ident] if ident < len(ISRS) else "ISR %d" % ident
+    if ident == 0:
+        return "LCD %s" % LCD_REQUESTS.get(arg, arg)
+    return "%s %s" % (DRIVERS[ident] if ident < len(DRIVERS) else "driver %d" % ident,
+                      USART_CHANNELS[arg] if arg < len(USART_CHANNELS) else arg)
+
+
+def convert(clock, events, runnables):
+    """Return (Chrome trace events, {name: [durations in us]})."""
+    us = 1e6 / clock
+    origin = events[0][0] if events else 0
+    trace = [{"ph": "M", "pid": 1, "name": "process_name", "args": {"name": "MC1"}},
+             {"ph": "M", "pid": 1, "tid": CPU_TID, "name": "thread_name", "args": {"name": "CPU"}}]
+    for index, driver in enumerate(DRIVERS):
+        trace.append({"ph": "M", "pid": 1, "tid": DRIVER_TID + index, "name": "thread_name", "args": {"name": driver}})
+
+    # open slices of every track, the events before the oldest one of the ring have no start and are dropped
+    stacks = {}
+    durations = {}
+    for stamp, kind, ident, arg in events:
+        if kind >= len(EVENT_TYPES):
+            raise DumpError("unknown event type %d" % kind)
+        tid = CPU_TID if kind < 6 else DRIVER_TID + ident
+        name = name_of(kind, ident, arg, runnables)
+        time = (stamp - origin) * us
+        stack = stacks.setdefault(tid, [])
+        if kind % 2 == 0:
+            stack.append((name, time))
+            trace.append({"ph": "B", "pid": 1, "tid": tid, "ts": round(time, 3), "name": name})
+        elif stack:
+            # an LCD request ends with argument 0, so its name comes from the start
+            name, begin = stack.pop()
+            durations.setdefault(name, []).append(time - begin)
+            trace.append({"ph": "E", "pid": 1, "tid": tid, "ts": round(time, 3), "name": name})
+    return trace, durations
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n\n")[0])
+    parser.add_argument("dump", help="raw bytes received from TRACE_Dump")
+    parser.add_argument("-o", "--output", help="Chrome trace JSON file (default: the dump name with .json)")
+    args = parser.parse_args()
+
+    try:
+        runnables, _ = parse_fields(BOARDS["mc1"])
+        with open(args.dump, "rb") as f:
+            clock, lost, events = read_dump(f.read())
+        trace, durations = convert(clock, events, runnables)
+    except (ConfigError, DumpError, OSError) as error:
+        sys.exit("trace_to_perfetto: %s" % error)
+
+    output = args.output or args.dump.rsplit(".", 1)[0] + ".json"
+    with open(output, "w") as f:
+        json.dump({"traceEvents": trace, "displayTimeUnit": "ns"}, f)
+
+    span = (events[-1][0] - events[0][0]) * 1e6 / clock if events else 0
+    print("%d events over %.0f us (%d older events lost), written to %s" % (len(events), span, lost, output))
+    print("  %-28s %6s %10s %10s %10s" % ("", "count", "mean us", "max us", "total us"))
+    for name, values in sorted(durations.items(), key=lambda item: -sum(item[1])):
+        print("  %-28s %6d %10.1f %10.1f %10.1f" % (name, len(values), sum(values) / len(values), max(values), sum(values)))
+
+
+if __name__ == "__main__":
+    main()